@@ -0,0 +1,226 @@
+#include "cfg.h"
+
+/* Function that checks if an instruction ends a basic block (jumps and returns)
+ */
+int is_terminator(Instr* instr) {
+    INSTR_TYPE type = instr->instruct->instruct.type_instruct;
+    return type == I_JMP || type == I_RET || is_cond_jump(type);
+}
+
+/* Function that returns the index of the I_LEAVE that closes the method starting at enter
+ */
+int find_method_end(int enter) {
+    Instr* code = get_intermediate_code();
+    int code_size = get_code_size();
+    for (int i = enter + 1; i < code_size; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_LEAVE) {
+            return i;
+        }
+    }
+    return code_size - 1;
+}
+
+/* Function that returns the index of the definition of label in [from, to] (-1 if not found)
+ */
+int find_label(const char* label, int from, int to) {
+    Instr* code = get_intermediate_code();
+    for (int i = from; i <= to; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_LABEL && strcmp(code[i].var1->id.name, label) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Function that returns the block that contains the instruction at index (-1 if none)
+ * Blocks are sorted by their position, so a binary search is enough
+ */
+int block_of(CFG* cfg, int index) {
+    int low = 0, high = cfg->num_blocks - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        if (index < cfg->blocks[mid].start) {
+            high = mid - 1;
+        } else if (index > cfg->blocks[mid].end) {
+            low = mid + 1;
+        } else {
+            return mid;
+        }
+    }
+    return -1;
+}
+
+/* Adds pred as predecessor of block (each predecessor is saved only once)
+ */
+static void add_pred(BASIC_BLOCK* block, int pred) {
+    for (int i = 0; i < block->num_preds; i++) {
+        if (block->preds[i] == pred) return;
+    }
+    block->preds = realloc(block->preds, (block->num_preds + 1) * sizeof(int));
+    block->preds[block->num_preds++] = pred;
+}
+
+/* Returns the block that starts with the definition of label (-1 if it is not defined in the method)
+ */
+static int label_block(CFG* cfg, const char* label) {
+    int index = find_label(label, cfg->enter, cfg->leave);
+    return index < 0 ? -1 : block_of(cfg, index);
+}
+
+/* Function that builds the control flow graph of the method that starts in the I_ENTER at index enter
+ * Block 0 is the entry block. Blocks are kept in the same order as the intermediate code
+ */
+CFG* build_cfg(int enter) {
+    Instr* code = get_intermediate_code();
+    CFG* cfg = calloc(1, sizeof(CFG));
+    if (!cfg) error_allocate_mem();
+    cfg->enter = enter;
+    cfg->leave = find_method_end(enter);
+    cfg->blocks = calloc(cfg->leave - enter + 1, sizeof(BASIC_BLOCK));
+    if (!cfg->blocks) error_allocate_mem();
+
+    // A block ends before a label, after a jump or return, or at the end of the method
+    int start = enter + 1;
+    for (int i = enter + 1; i < cfg->leave; i++) {
+        if (i + 1 == cfg->leave || code[i + 1].instruct->instruct.type_instruct == I_LABEL || is_terminator(&code[i])) {
+            BASIC_BLOCK* block = &cfg->blocks[cfg->num_blocks++];
+            block->start = start;
+            block->end = i;
+            start = i + 1;
+        }
+    }
+
+    for (int b = 0; b < cfg->num_blocks; b++) {
+        BASIC_BLOCK* block = &cfg->blocks[b];
+        Instr* last = &code[block->end];
+        int next = b + 1 < cfg->num_blocks ? b + 1 : -1; // -1 means falling into I_LEAVE
+        block->succ[0] = -1;
+        block->succ[1] = -1;
+        switch (last->instruct->instruct.type_instruct) {
+            case I_JMP:
+                block->succ[1] = label_block(cfg, last->var1->id.name);
+                break;
+            case I_RET:
+                break;
+            default:
+                block->succ[0] = next;
+                if (is_cond_jump(last->instruct->instruct.type_instruct)) {
+                    block->succ[1] = label_block(cfg, last->reg->id.name);
+                }
+                break;
+        }
+    }
+
+    for (int b = 0; b < cfg->num_blocks; b++) {
+        for (int s = 0; s < 2; s++) {
+            if (cfg->blocks[b].succ[s] >= 0) {
+                add_pred(&cfg->blocks[cfg->blocks[b].succ[s]], b);
+            }
+        }
+    }
+    return cfg;
+}
+
+/* Function that frees the memory used by a control flow graph
+ */
+void free_cfg(CFG* cfg) {
+    if (!cfg) return;
+    for (int b = 0; b < cfg->num_blocks; b++) {
+        free(cfg->blocks[b].preds);
+    }
+    free(cfg->blocks);
+    free(cfg);
+}
+
+/* Depth first search that saves the blocks in postorder
+ */
+static void postorder_visit(CFG* cfg, int block, int* visited, int* order, int* count) {
+    visited[block] = 1;
+    // The jump target is visited first so blocks that follow each other in the code stay together
+    for (int s = 1; s >= 0; s--) {
+        int succ = cfg->blocks[block].succ[s];
+        if (succ >= 0 && !visited[succ]) {
+            postorder_visit(cfg, succ, visited, order, count);
+        }
+    }
+    order[(*count)++] = block;
+}
+
+/* Function that returns the blocks reachable from the entry in reverse postorder, saving how many there are in count
+ */
+int* reverse_postorder(CFG* cfg, int* count) {
+    int* visited = calloc(cfg->num_blocks + 1, sizeof(int));
+    int* order = malloc((cfg->num_blocks + 1) * sizeof(int));
+    if (!visited || !order) error_allocate_mem();
+    *count = 0;
+    if (cfg->num_blocks > 0) {
+        postorder_visit(cfg, 0, visited, order, count);
+    }
+    for (int i = 0; i < *count / 2; i++) {
+        int aux = order[i];
+        order[i] = order[*count - 1 - i];
+        order[*count - 1 - i] = aux;
+    }
+    free(visited);
+    return order;
+}
+
+/* Function that computes the immediate dominator of every block (the entry is its own, -1 for unreachable blocks)
+ * Iterative algorithm of Cooper, Harvey and Kennedy over the reverse postorder
+ */
+int* compute_dominators(CFG* cfg) {
+    int count;
+    int* order = reverse_postorder(cfg, &count);
+    int* rpo_number = malloc((cfg->num_blocks + 1) * sizeof(int));
+    int* idom = malloc((cfg->num_blocks + 1) * sizeof(int));
+    if (!rpo_number || !idom) error_allocate_mem();
+    for (int b = 0; b < cfg->num_blocks; b++) {
+        rpo_number[b] = -1;
+        idom[b] = -1;
+    }
+    for (int i = 0; i < count; i++) {
+        rpo_number[order[i]] = i;
+    }
+    if (count > 0) idom[0] = 0;
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int i = 1; i < count; i++) {
+            BASIC_BLOCK* block = &cfg->blocks[order[i]];
+            int new_idom = -1;
+            for (int p = 0; p < block->num_preds; p++) {
+                int pred = block->preds[p];
+                if (idom[pred] < 0) continue; // Not processed yet or unreachable
+                if (new_idom < 0) {
+                    new_idom = pred;
+                    continue;
+                }
+                // Intersect both paths of the dominator tree
+                int a = pred, b = new_idom;
+                while (a != b) {
+                    while (rpo_number[a] > rpo_number[b]) a = idom[a];
+                    while (rpo_number[b] > rpo_number[a]) b = idom[b];
+                }
+                new_idom = a;
+            }
+            if (idom[order[i]] != new_idom) {
+                idom[order[i]] = new_idom;
+                changed = 1;
+            }
+        }
+    }
+    free(order);
+    free(rpo_number);
+    return idom;
+}
+
+/* Function that checks if block a dominates block b (using the immediate dominators)
+ */
+int dominates(int* idom, int a, int b) {
+    if (b < 0 || idom[b] < 0) return 0;
+    while (b != a) {
+        if (idom[b] == b) return 0; // Reached the entry
+        b = idom[b];
+    }
+    return 1;
+}
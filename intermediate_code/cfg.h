@@ -0,0 +1,55 @@
+#ifndef CFG_H
+#define CFG_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "intermediate_code.h"
+
+// Basic block of a method: the instructions in [start, end] of the intermediate code
+typedef struct BASIC_BLOCK {
+    int start; // Index of the first instruction of the block
+    int end; // Index of the last instruction of the block (inclusive)
+    int succ[2]; // Successor blocks, -1 if not used. succ[0] is the fallthrough, succ[1] the jump target
+    int* preds; // Predecessor blocks
+    int num_preds;
+} BASIC_BLOCK;
+
+// Control flow graph of one method (instructions between I_ENTER and I_LEAVE)
+typedef struct CFG {
+    int enter; // Index of the I_ENTER instruction
+    int leave; // Index of the I_LEAVE instruction
+    BASIC_BLOCK* blocks;
+    int num_blocks;
+} CFG;
+
+/* Function that builds the control flow graph of the method that starts in the I_ENTER at index enter
+ * Block 0 is the entry block. Blocks are kept in the same order as the intermediate code
+ */
+CFG* build_cfg(int enter);
+/* Function that frees the memory used by a control flow graph
+ */
+void free_cfg(CFG* cfg);
+/* Function that returns the block that contains the instruction at index (-1 if none)
+ */
+int block_of(CFG* cfg, int index);
+/* Function that returns the index of the I_LEAVE that closes the method starting at enter
+ */
+int find_method_end(int enter);
+/* Function that returns the index of the definition of label in [from, to] (-1 if not found)
+ */
+int find_label(const char* label, int from, int to);
+/* Function that checks if an instruction ends a basic block (jumps and returns)
+ */
+int is_terminator(Instr* instr);
+/* Function that returns the blocks reachable from the entry in reverse postorder, saving how many there are in count
+ */
+int* reverse_postorder(CFG* cfg, int* count);
+/* Function that computes the immediate dominator of every block (the entry is its own, -1 for unreachable blocks)
+ */
+int* compute_dominators(CFG* cfg);
+/* Function that checks if block a dominates block b (using the immediate dominators)
+ */
+int dominates(int* idom, int a, int b);
+
+#endif
@@ -0,0 +1,220 @@
+#include "evaluate.h"
+#include "purity.h"
+#include <limits.h>
+
+extern int remarks;
+
+// Values of the variables and temporals of a method during an evaluation
+typedef struct FRAME {
+    char** names;
+    long* values;
+    int count;
+    int capacity;
+} FRAME;
+
+// Why an evaluation stopped without a result
+typedef enum {
+    EVAL_OK,
+    EVAL_BUDGET, // Too many instructions or nested calls
+    EVAL_FAILED // Something the evaluator can't reproduce (division by zero, unassigned variable, extern call)
+} EVAL_STATUS;
+
+/* Saves in value the value of the operand name in frame (constants are their own value). Returns 0 if the operand
+ * has no value yet
+ */
+static int read_value(FRAME* frame, const char* name, long* value) {
+    if (is_constant(name)) {
+        *value = strtol(name, NULL, 10);
+        return 1;
+    }
+    for (int n = 0; n < frame->count; n++) {
+        if (strcmp(frame->names[n], name) == 0) {
+            *value = frame->values[n];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Assigns value to the operand name in frame
+ */
+static void write_value(FRAME* frame, char* name, long value) {
+    for (int n = 0; n < frame->count; n++) {
+        if (strcmp(frame->names[n], name) == 0) {
+            frame->values[n] = value;
+            return;
+        }
+    }
+    if (frame->count == frame->capacity) {
+        frame->capacity = frame->capacity ? frame->capacity * 2 : 16;
+        frame->names = realloc(frame->names, frame->capacity * sizeof(char*));
+        frame->values = realloc(frame->values, frame->capacity * sizeof(long));
+        if (!frame->names || !frame->values) error_allocate_mem();
+    }
+    frame->names[frame->count] = name;
+    frame->values[frame->count++] = value;
+}
+
+/* Returns the index of the label name in the method that starts at enter
+ */
+static int find_label(int enter, const char* name) {
+    Instr* code = get_intermediate_code();
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_LABEL && strcmp(code[i].var1->id.name, name) == 0) return i;
+    }
+    return -1;
+}
+
+/* Computes the value of an arithmetic, logic or comparison instruction of type with the operands a and b the way the
+ * object code does (64 bit integers that wrap around). Returns 0 if it can't be computed
+ */
+static int compute(INSTR_TYPE type, long a, long b, long* value) {
+    switch (type) {
+        case I_ADD: *value = (long)((unsigned long)a + (unsigned long)b); return 1;
+        case I_SUB: *value = (long)((unsigned long)a - (unsigned long)b); return 1;
+        case I_MUL: *value = (long)((unsigned long)a * (unsigned long)b); return 1;
+        case I_DIV: case I_MOD:
+            if (b == 0 || (a == LONG_MIN && b == -1)) return 0;
+            *value = type == I_DIV ? a / b : a % b;
+            return 1;
+        case I_SHIFT_RIGHT: *value = a / (1L << b); return 1; // Division by a power of 2 that truncates to zero
+        case I_MIN: *value = (long)(0UL - (unsigned long)a); return 1;
+        case I_NEG: *value = a == 0; return 1;
+        case I_AND: *value = a & b; return 1;
+        case I_OR: *value = a | b; return 1;
+        case I_LES: case I_JLES: *value = a < b; return 1;
+        case I_GRT: case I_JGRT: *value = a > b; return 1;
+        case I_EQ: case I_JEQ: *value = a == b; return 1;
+        case I_NEQ: case I_JNEQ: *value = a != b; return 1;
+        case I_LEQ: case I_JLEQ: *value = a <= b; return 1;
+        case I_GEQ: case I_JGEQ: *value = a >= b; return 1;
+        case I_JMPT: *value = a != 0; return 1;
+        case I_JMPF: *value = a == 0; return 1;
+        default: return 0;
+    }
+}
+
+/* Runs the method name with the arguments args, saving the value it returns in result. steps is the number of
+ * instructions left to run and depth the number of calls being evaluated
+ */
+static EVAL_STATUS run_method(const char* name, long* args, int num_args, long* result, long* steps, int depth) {
+    Instr* code = get_intermediate_code();
+    int enter = find_enter(name);
+    INFO* decl = find_method_decl(name);
+    if (enter < 0 || !decl || decl->method_decl.num_args != num_args) return EVAL_FAILED;
+    if (depth > MAX_EVAL_DEPTH) return EVAL_BUDGET;
+
+    FRAME frame = {NULL, NULL, 0, 0};
+    ARGS_LIST* arg = decl->method_decl.args;
+    for (int a = 0; a < num_args; a++, arg = arg->next) write_value(&frame, arg->arg->name, args[a]);
+    long* params = malloc((get_code_size() + 1) * sizeof(long));
+    if (!params) error_allocate_mem();
+    int num_params = 0;
+
+    EVAL_STATUS status = EVAL_FAILED;
+    int pc = enter + 1;
+    while (1) {
+        if (--*steps < 0) {
+            status = EVAL_BUDGET;
+            break;
+        }
+        Instr* instr = &code[pc++];
+        INSTR_TYPE type = instr->instruct->instruct.type_instruct;
+        long a = 0, b = 0, value;
+        if (type == I_LOAD || type == I_LABEL) continue;
+        if (type == I_JMP) {
+            pc = find_label(enter, instr->var1->id.name);
+            if (pc < 0) break;
+            continue;
+        }
+        if (type == I_LOADVAL || type == I_STORE || type == I_PARAM) {
+            if (!read_value(&frame, instr->var1->id.name, &value)) break;
+            if (type == I_PARAM) params[num_params++] = value;
+            else write_value(&frame, instr->reg->id.name, value);
+            continue;
+        }
+        if (type == I_RET) {
+            if (!instr->var1 || !read_value(&frame, instr->var1->id.name, result)) break;
+            status = EVAL_OK;
+            break;
+        }
+        if (type == I_CALL) {
+            long returned = 0;
+            EVAL_STATUS call = run_method(instr->var1->id.name, params, num_params, &returned, steps, depth + 1);
+            if (call != EVAL_OK) {
+                status = call;
+                break;
+            }
+            num_params = 0;
+            if (instr->reg) write_value(&frame, instr->reg->id.name, returned);
+            continue;
+        }
+        // The rest compute a value from one or two operands, conditional jumps use it to decide
+        if (!instr->var1 || !read_value(&frame, instr->var1->id.name, &a)) break;
+        if (instr->var2 && !read_value(&frame, instr->var2->id.name, &b)) break;
+        if (!compute(type, a, b, &value)) break;
+        if (is_cond_jump(type)) {
+            if (value) pc = find_label(enter, instr->reg->id.name);
+            if (pc < 0) break;
+        } else {
+            write_value(&frame, instr->reg->id.name, value);
+        }
+    }
+    free(frame.names);
+    free(frame.values);
+    free(params);
+    return status;
+}
+
+/* Function that evaluates at compile time the calls to pure methods whose arguments are all constants, running their
+ * intermediate code, and replaces each one by the value it returns. Calls that need more than MAX_EVAL_STEPS
+ * instructions or MAX_EVAL_DEPTH nested calls, or that divide by zero or read a variable before assigning it, are
+ * left as they are
+ */
+void evaluate_pure_calls() {
+    Instr* code = get_intermediate_code();
+    int enter = -1;
+    for (int i = 0; i < get_code_size(); i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_ENTER) enter = i;
+        if (type == I_LEAVE) enter = -1;
+        if (type != I_CALL || enter < 0 || !code[i].reg) continue;
+        char* callee = code[i].var1->id.name;
+        INFO* decl = find_method_decl(callee);
+        if (!decl || decl->method_decl.is_extern) continue;
+        int num_args = decl->method_decl.num_args;
+        int first = i - num_args;
+        if (first <= enter) continue;
+        long args[num_args + 1];
+        int constant = 1;
+        for (int a = 0; a < num_args && constant; a++) {
+            char* value = code[first + a].instruct->instruct.type_instruct == I_PARAM ?
+                          constant_value(first + a, enter, code[first + a].var1->id.name) : NULL;
+            constant = value != NULL;
+            if (value) args[a] = strtol(value, NULL, 10);
+        }
+        if (!constant || !is_pure_method(callee)) continue;
+
+        long result;
+        long steps = MAX_EVAL_STEPS;
+        EVAL_STATUS status = run_method(callee, args, num_args, &result, &steps, 0);
+        // The result is loaded as an immediate, which takes 32 bits
+        if (status == EVAL_OK && (result < INT_MIN || result > INT_MAX)) status = EVAL_FAILED;
+        if (status != EVAL_OK) {
+            if (remarks && status == EVAL_BUDGET) {
+                fprintf(stderr, "Remark: call to %s with constant arguments is not evaluated at compile time, it "
+                        "exceeds the evaluation budget\n", callee);
+            }
+            continue;
+        }
+        if (remarks) fprintf(stderr, "Remark: call to %s evaluated at compile time: %ld\n", callee, result);
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%ld", result);
+        INFO value_info, result_info = *code[i].reg;
+        value_info.type = TABLE_ID;
+        value_info.id.name = my_strdup(buf);
+        for (int k = i; k >= first; k--) remove_instr(k);
+        insert_instr(first, I_LOADVAL, &value_info, NULL, &result_info);
+        i = first;
+    }
+}
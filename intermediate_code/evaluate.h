@@ -0,0 +1,18 @@
+#ifndef EVALUATE_H
+#define EVALUATE_H
+
+#include "intermediate_code.h"
+
+// Most instructions that the evaluation of a call can run
+#define MAX_EVAL_STEPS 1000000
+// Most nested calls that the evaluation of a call can make
+#define MAX_EVAL_DEPTH 200
+
+/* Function that evaluates at compile time the calls to pure methods whose arguments are all constants, running their
+ * intermediate code, and replaces each one by the value it returns. Calls that need more than MAX_EVAL_STEPS
+ * instructions or MAX_EVAL_DEPTH nested calls, or that divide by zero or read a variable before assigning it, are
+ * left as they are
+ */
+void evaluate_pure_calls();
+
+#endif
@@ -0,0 +1,618 @@
+#include "induction.h"
+
+// Derived induction variable of a counted loop: dest = i * factor (+ or - offset), computed in every iteration by
+// a multiplication and an optional addition or subtraction
+typedef struct DERIVED {
+    int mul; // Index of the multiplication
+    int add; // Index of the addition or subtraction of offset (-1 if there is none)
+    char* factor; // Invariant k
+    char* offset; // Invariant b (NULL if there is none)
+    int subtract; // 1 if offset is subtracted
+    char* dest; // Temporal with the value of the derived variable
+} DERIVED;
+
+// Most terms of the additions that update the variables of a loop replaced by its closed form
+#define MAX_TERMS 16
+// Most instructions of the closed form of a loop
+#define MAX_CLOSED_FORM 96
+
+// Term of the value added to an accumulator in every iteration: sign * factor, multiplied by i when with_var
+typedef struct TERM {
+    char* factor; // Invariant
+    int sign;
+    int with_var;
+    int after_step; // 1 if i is read after it changes in the iteration
+} TERM;
+
+// Accumulator of a loop: var = var + the sum of its terms in every iteration
+typedef struct ACCUMULATOR {
+    char* var;
+    TERM terms[MAX_TERMS];
+    int num_terms;
+} ACCUMULATOR;
+
+/* Checks if name is written by an instruction in [from, to]
+ */
+static int defined_in_range(const char* name, int from, int to) {
+    Instr* code = get_intermediate_code();
+    for (int i = from; i <= to; i++) {
+        INFO* dest = get_dest(&code[i]);
+        if (dest && strcmp(dest->id.name, name) == 0) return 1;
+    }
+    return 0;
+}
+
+/* Checks if the operand name has the same value in every iteration of the counted loop
+ */
+static int is_invariant(COUNTED_LOOP* counted, const char* name, int has_calls) {
+    if (is_constant(name)) return labs(strtol(name, NULL, 10)) <= MAX_LOOP_CONSTANT;
+    if (is_temp(name) || (has_calls && is_global(name))) return 0;
+    return !defined_in_range(name, counted->label + 1, counted->test - 1);
+}
+
+/* Saves in uses (if it's not NULL) the indices of the instructions in [from, to] that read name, returns how many
+ * there are
+ */
+static int find_uses(const char* name, int from, int to, int* uses) {
+    Instr* code = get_intermediate_code();
+    int count = 0;
+    for (int i = from; i <= to; i++) {
+        INFO* operands[2];
+        int num_operands = get_uses(&code[i], operands);
+        for (int o = 0; o < num_operands; o++) {
+            if (strcmp(operands[o]->id.name, name) == 0) {
+                if (uses) uses[count] = i;
+                count++;
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+/* Checks if every use of the value defined at index def comes before i changes, so the value matches the one of
+ * the reduced variable at that point
+ */
+static int used_before_step(COUNTED_LOOP* counted, const char* name, int def, int* uses) {
+    int num_uses = find_uses(name, def + 1, counted->test - 1, uses);
+    for (int u = 0; u < num_uses; u++) {
+        if (def < counted->step_index && counted->step_index < uses[u]) return 0;
+    }
+    return num_uses > 0;
+}
+
+/* Finds a derived induction variable in the body of the counted loop. Returns 1 if one was found
+ */
+static int find_derived(COUNTED_LOOP* counted, int has_calls, DERIVED* derived) {
+    Instr* code = get_intermediate_code();
+    int* uses = malloc((counted->test - counted->label + 1) * sizeof(int));
+    if (!uses) error_allocate_mem();
+    int found = 0;
+    for (int m = counted->label + 1; m < counted->test && !found; m++) {
+        if (code[m].instruct->instruct.type_instruct != I_MUL || !is_temp(code[m].reg->id.name)) continue;
+        char* var1 = code[m].var1->id.name;
+        char* var2 = code[m].var2->id.name;
+        if (strcmp(var1, counted->var) == 0 && is_invariant(counted, var2, has_calls)) {
+            derived->factor = var2;
+        } else if (strcmp(var2, counted->var) == 0 && is_invariant(counted, var1, has_calls)) {
+            derived->factor = var1;
+        } else {
+            continue;
+        }
+        derived->mul = m;
+        derived->add = -1;
+        derived->offset = NULL;
+        derived->subtract = 0;
+        derived->dest = code[m].reg->id.name;
+        if (!used_before_step(counted, derived->dest, m, uses)) continue;
+
+        // base + i * k is derived too when the product is only used there
+        int add = uses[0];
+        Instr* next = &code[add];
+        INSTR_TYPE type = next->instruct->instruct.type_instruct;
+        if (find_uses(derived->dest, m + 1, counted->test - 1, uses) == 1 && (type == I_ADD || type == I_SUB) &&
+            is_temp(next->reg->id.name) && strcmp(next->var1->id.name, next->var2->id.name) != 0) {
+            int first = strcmp(next->var1->id.name, derived->dest) == 0;
+            char* other = first ? next->var2->id.name : next->var1->id.name;
+            if ((type == I_ADD || first) && is_invariant(counted, other, has_calls) &&
+                used_before_step(counted, next->reg->id.name, add, uses)) {
+                derived->add = add;
+                derived->offset = other;
+                derived->subtract = type == I_SUB;
+                derived->dest = next->reg->id.name;
+            }
+        }
+        found = !defined_in_range(derived->dest, counted->label + 1, derived->add >= 0 ? derived->add - 1 : m - 1) &&
+                !defined_in_range(derived->dest, (derived->add >= 0 ? derived->add : m) + 1, counted->test - 1);
+    }
+    free(uses);
+    return found;
+}
+
+/* Returns a new name for a value that lives through a loop (temporals can't, their reuse is linear)
+ */
+static char* new_loop_value() {
+    char* temp = new_temp();
+    char* name = malloc(strlen(temp) + 3);
+    if (!name) error_allocate_mem();
+    sprintf(name, "%s.0", temp + 1);
+    free(temp);
+    return name;
+}
+
+/* Returns a constant operand with value
+ */
+static char* constant_name(long value) {
+    char buffer[32];
+    sprintf(buffer, "%ld", value);
+    return my_strdup(buffer);
+}
+
+/* Checks if a block outside the loop reads name before writing it, so its value could be needed after the loop
+ */
+static int is_read_outside(CFG* cfg, LOOP* loop, const char* name) {
+    Instr* code = get_intermediate_code();
+    for (int b = 0; b < cfg->num_blocks; b++) {
+        if (loop->blocks[b]) continue;
+        for (int i = cfg->blocks[b].start; i <= cfg->blocks[b].end; i++) {
+            INFO* uses[2];
+            int num_uses = get_uses(&code[i], uses);
+            for (int u = 0; u < num_uses; u++) {
+                if (strcmp(uses[u]->id.name, name) == 0) return 1;
+            }
+            INFO* dest = get_dest(&code[i]);
+            if (dest && strcmp(dest->id.name, name) == 0) break;
+        }
+    }
+    return 0;
+}
+
+/* Checks if the exit test of the counted loop can compare the reduced variable instead of i: i is only needed by
+ * its step and the test, and every value involved is a known constant small enough to never overflow
+ */
+static int can_rewrite_test(CFG* cfg, LOOP* loop, COUNTED_LOOP* counted, DERIVED* derived) {
+    Instr* code = get_intermediate_code();
+    if (!counted->has_init || !is_constant(counted->bound) || !is_constant(derived->factor) ||
+        (derived->offset && !is_constant(derived->offset)) ||
+        labs(strtol(counted->bound, NULL, 10)) > MAX_LOOP_CONSTANT || strtol(derived->factor, NULL, 10) == 0) {
+        return 0;
+    }
+    for (int i = counted->label + 1; i < counted->test; i++) {
+        if (i == counted->step_index || i == derived->mul) continue;
+        INFO* uses[2];
+        int num_uses = get_uses(&code[i], uses);
+        for (int u = 0; u < num_uses; u++) {
+            if (strcmp(uses[u]->id.name, counted->var) == 0) return 0;
+        }
+    }
+    return !is_read_outside(cfg, loop, counted->var);
+}
+
+/* Checks if the instruction can be removed or run a different number of times without changing what the program
+ * does besides the values it computes
+ */
+static int has_side_effects(Instr* instr) {
+    INFO* dest = get_dest(instr);
+    switch (instr->instruct->instruct.type_instruct) {
+        case I_CALL: case I_PARAM: case I_RET: case I_LOAD:
+            return 1;
+        case I_DIV: case I_MOD: {
+            // Could fault
+            if (!is_constant(instr->var2->id.name)) return 1;
+            long divisor = strtol(instr->var2->id.name, NULL, 10);
+            if (divisor == 0 || divisor == -1) return 1;
+            break;
+        }
+        default:
+            break;
+    }
+    return dest && is_global(dest->id.name);
+}
+
+/* Removes the assignments to name in the method that starts at enter when nothing reads it anymore
+ */
+static void remove_unread_variable(int enter, const char* name) {
+    Instr* code = get_intermediate_code();
+    int leave = find_method_end(enter);
+    if (is_global(name) || find_uses(name, enter + 1, leave - 1, NULL) > 0) return;
+    for (int i = leave - 1; i > enter; i--) {
+        INFO* dest = get_dest(&code[i]);
+        if (dest && strcmp(dest->id.name, name) == 0 && !has_side_effects(&code[i])) {
+            remove_instr(i);
+        }
+    }
+}
+
+/* Returns the conditional jump that gives the same result with its operands multiplied by a negative number
+ */
+static INSTR_TYPE mirror_cond_jump(INSTR_TYPE type) {
+    switch (type) {
+        case I_JLES: return I_JGRT;
+        case I_JLEQ: return I_JGEQ;
+        case I_JGRT: return I_JLES;
+        case I_JGEQ: return I_JLEQ;
+        default: return type;
+    }
+}
+
+/* Replaces a derived induction variable of the counted loop by a variable that is updated next to the step of i.
+ * Returns 1 if the loop changed
+ */
+static int reduce_loop(CFG* cfg, LOOP* loop, COUNTED_LOOP* counted) {
+    Instr* code = get_intermediate_code();
+    int has_calls = 0;
+    for (int i = counted->label + 1; i < counted->test; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_CALL) has_calls = 1;
+    }
+    DERIVED derived;
+    if (get_code_size() + 4 >= MAX_CODE_SIZE || !find_derived(counted, has_calls, &derived)) return 0;
+    int rewrite_test = can_rewrite_test(cfg, loop, counted, &derived);
+
+    INFO value_info, factor_info, offset_info, increment_info, step_info;
+    value_info.type = TABLE_ID;
+    value_info.id.name = new_loop_value();
+    factor_info = *code[derived.mul].var1;
+    factor_info.id.name = derived.factor;
+    offset_info = factor_info;
+    offset_info.id.name = derived.offset;
+    increment_info = factor_info;
+    step_info = factor_info;
+    step_info.id.name = constant_name(counted->step);
+    int constant_factor = is_constant(derived.factor);
+    long factor = constant_factor ? strtol(derived.factor, NULL, 10) : 0;
+    long offset = derived.offset && is_constant(derived.offset) ? strtol(derived.offset, NULL, 10) : 0;
+    if (derived.subtract) offset = -offset;
+
+    // The uses of the derived variable read the new one
+    for (int i = derived.mul + 1; i < counted->test; i++) {
+        INFO* uses[2];
+        int num_uses = get_uses(&code[i], uses);
+        for (int u = 0; u < num_uses; u++) {
+            if (strcmp(uses[u]->id.name, derived.dest) == 0) uses[u]->id.name = value_info.id.name;
+        }
+    }
+
+    // The new variable grows factor * step in every iteration
+    INSTR_TYPE update = I_ADD;
+    int needs_increment = 0;
+    if (constant_factor) {
+        increment_info.id.name = constant_name(factor * counted->step);
+    } else if (counted->step == 1 || counted->step == -1) {
+        increment_info.id.name = derived.factor;
+        if (counted->step < 0) update = I_SUB;
+    } else {
+        increment_info.id.name = new_loop_value();
+        needs_increment = 1;
+    }
+    int step_index = counted->step_index;
+    if (rewrite_test) {
+        // i is not needed anymore: its step becomes the step of the new variable and the test compares it
+        Instr* step = &code[step_index];
+        step->instruct->instruct.type_instruct = update;
+        step->var1->id.name = value_info.id.name;
+        step->var2->id.name = increment_info.id.name;
+        step->reg->id.name = value_info.id.name;
+        Instr* test = &code[counted->test];
+        test->var1->id.name = value_info.id.name;
+        test->var2->id.name = constant_name(strtol(counted->bound, NULL, 10) * factor + offset);
+        if (factor < 0) test->instruct->instruct.type_instruct = mirror_cond_jump(test->instruct->instruct.type_instruct);
+    } else {
+        insert_instr(step_index + 1, update, &value_info, &increment_info, &value_info);
+    }
+    if (derived.add >= 0) remove_instr(derived.add + (derived.add > step_index && !rewrite_test));
+    remove_instr(derived.mul + (derived.mul > step_index && !rewrite_test));
+
+    // Initial value before the loop
+    int position = counted->label;
+    if (counted->has_init && constant_factor && (!derived.offset || is_constant(derived.offset))) {
+        offset_info.id.name = constant_name(counted->init * factor + offset);
+        insert_instr(position++, I_STORE, &offset_info, NULL, &value_info);
+    } else {
+        INFO var_info = factor_info;
+        var_info.id.name = counted->var;
+        insert_instr(position++, I_MUL, &var_info, &factor_info, &value_info);
+        if (derived.offset) {
+            insert_instr(position++, derived.subtract ? I_SUB : I_ADD, &value_info, &offset_info, &value_info);
+        }
+    }
+    if (needs_increment) insert_instr(position++, I_MUL, &factor_info, &step_info, &increment_info);
+    if (rewrite_test) remove_unread_variable(cfg->enter, counted->var);
+    return 1;
+}
+
+/* Function that reduces the strength of the derived induction variables of counted loops: a value computed as
+ * i * k (+ or - b) in every iteration, with k and b invariant, becomes a variable initialized before the loop and
+ * increased by k * step next to i = i + step. When i is then only needed by the exit test, the test is rewritten
+ * onto the new variable and i is removed from the loop. Loops must be rotated and out of SSA form
+ */
+void reduce_induction_variables() {
+    Instr* code = get_intermediate_code();
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER) continue;
+        int changed = 1;
+        while (changed) {
+            changed = 0;
+            CFG* cfg = build_cfg(enter);
+            int* idom = compute_dominators(cfg);
+            int count;
+            LOOP* loops = find_loops(cfg, idom, &count);
+            for (int l = 0; l < count && !changed; l++) {
+                COUNTED_LOOP counted;
+                if (find_counted_loop(cfg, idom, &loops[l], loops, count, &counted)) {
+                    changed = reduce_loop(cfg, &loops[l], &counted);
+                }
+            }
+            free_loops(loops, count);
+            free(idom);
+            free_cfg(cfg);
+        }
+    }
+}
+
+/* Deletes the counted loop when it has no side effects and nothing after it reads the values it computes. Returns
+ * 1 if the loop was deleted
+ */
+static int delete_unused_loop(CFG* cfg, LOOP* loop, COUNTED_LOOP* counted) {
+    Instr* code = get_intermediate_code();
+    for (int i = counted->label + 1; i < counted->test; i++) {
+        if (has_side_effects(&code[i])) return 0;
+        INFO* dest = get_dest(&code[i]);
+        if (dest && !is_temp(dest->id.name) && is_read_outside(cfg, loop, dest->id.name)) return 0;
+    }
+    char** names = malloc((counted->test - counted->label + 1) * sizeof(char*));
+    if (!names) error_allocate_mem();
+    int num_names = 0;
+    for (int i = counted->label + 1; i < counted->test; i++) {
+        INFO* dest = get_dest(&code[i]);
+        if (dest && !is_temp(dest->id.name)) names[num_names++] = dest->id.name;
+    }
+    for (int i = counted->test; i >= counted->label; i--) {
+        remove_instr(i);
+    }
+    // The assignments before the loop are useless too
+    for (int n = 0; n < num_names; n++) {
+        remove_unread_variable(cfg->enter, names[n]);
+    }
+    free(names);
+    return 1;
+}
+
+/* Adds to accumulator the terms of the value of name read at index, marking in used the instructions of the loop
+ * (from counted->label) that compute it. self counts how many times the accumulator itself is added. Returns 0 if
+ * the value is not a sum of invariants, products of i by invariants and the accumulator
+ */
+static int collect_terms(COUNTED_LOOP* counted, ACCUMULATOR* accumulator, char* name, int index, int sign, int has_calls,
+                         char* used, int* self) {
+    Instr* code = get_intermediate_code();
+    if (strcmp(name, accumulator->var) == 0) {
+        (*self)++;
+        return sign > 0;
+    }
+    if (strcmp(name, counted->var) == 0 || is_invariant(counted, name, has_calls)) {
+        if (accumulator->num_terms == MAX_TERMS) return 0;
+        TERM* term = &accumulator->terms[accumulator->num_terms++];
+        term->with_var = strcmp(name, counted->var) == 0;
+        term->factor = term->with_var ? "1" : name;
+        term->sign = sign;
+        term->after_step = index > counted->step_index;
+        return 1;
+    }
+
+    // A temporal computed in the body for this addition only
+    if (!is_temp(name) || find_uses(name, counted->label + 1, counted->test - 1, NULL) != 1) return 0;
+    int def = -1;
+    for (int i = counted->label + 1; i < index; i++) {
+        INFO* dest = get_dest(&code[i]);
+        if (dest && strcmp(dest->id.name, name) == 0) def = i;
+    }
+    if (def < 0 || used[def - counted->label]) return 0;
+    used[def - counted->label] = 1;
+    char* var1 = code[def].var1->id.name;
+    switch (code[def].instruct->instruct.type_instruct) {
+        case I_ADD:
+            return collect_terms(counted, accumulator, var1, def, sign, has_calls, used, self) &&
+                   collect_terms(counted, accumulator, code[def].var2->id.name, def, sign, has_calls, used, self);
+        case I_SUB:
+            return collect_terms(counted, accumulator, var1, def, sign, has_calls, used, self) &&
+                   collect_terms(counted, accumulator, code[def].var2->id.name, def, -sign, has_calls, used, self);
+        case I_MIN:
+            return collect_terms(counted, accumulator, var1, def, -sign, has_calls, used, self);
+        case I_MUL: {
+            char* var2 = code[def].var2->id.name;
+            char* factor = strcmp(var1, counted->var) == 0 ? var2 : strcmp(var2, counted->var) == 0 ? var1 : NULL;
+            if (!factor || !is_invariant(counted, factor, has_calls) || accumulator->num_terms == MAX_TERMS) return 0;
+            TERM* term = &accumulator->terms[accumulator->num_terms++];
+            term->factor = factor;
+            term->sign = sign;
+            term->with_var = 1;
+            term->after_step = def > counted->step_index;
+            return 1;
+        }
+        default:
+            return 0;
+    }
+}
+
+/* Finds the accumulators of the body of the counted loop. Every instruction of the body must be the step of i or
+ * part of the update of an accumulator. Saves how many there are in count, returns 0 if the loop doesn't have that
+ * shape
+ */
+static int find_accumulators(COUNTED_LOOP* counted, ACCUMULATOR* accumulators, int* count) {
+    Instr* code = get_intermediate_code();
+    char* used = calloc(counted->test - counted->label + 1, 1);
+    if (!used) error_allocate_mem();
+    int valid = 1;
+    *count = 0;
+    used[counted->step_index - counted->label] = 1;
+    for (int i = counted->test - 1; i > counted->label && valid; i--) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_LABEL || used[i - counted->label]) continue;
+        INFO* dest = get_dest(&code[i]);
+        if (type == I_CALL || type == I_JMP || is_cond_jump(type) || !dest ||
+            is_temp(dest->id.name) || *count == MAX_TERMS ||
+            find_uses(dest->id.name, counted->label + 1, counted->test - 1, NULL) != 1 ||
+            defined_in_range(dest->id.name, counted->label + 1, i - 1)) {
+            valid = 0;
+            break;
+        }
+        // The accumulator is only read by its own update
+        ACCUMULATOR* accumulator = &accumulators[(*count)++];
+        accumulator->var = dest->id.name;
+        accumulator->num_terms = 0;
+        used[i - counted->label] = 1;
+        int self = 0;
+        INFO* operands[2];
+        int num_operands = get_uses(&code[i], operands);
+        if (type == I_STORE) {
+            valid = collect_terms(counted, accumulator, operands[0]->id.name, i, 1, 0, used, &self);
+        } else if (type == I_ADD || type == I_SUB) {
+            valid = num_operands == 2 &&
+                    collect_terms(counted, accumulator, operands[0]->id.name, i, 1, 0, used, &self) &&
+                    collect_terms(counted, accumulator, operands[1]->id.name, i, type == I_SUB ? -1 : 1, 0, used,
+                                  &self);
+        } else {
+            valid = 0;
+        }
+        valid = valid && self == 1;
+    }
+    for (int i = counted->label + 1; i < counted->test && valid; i++) {
+        if (!used[i - counted->label] && code[i].instruct->instruct.type_instruct != I_LABEL) valid = 0;
+    }
+    free(used);
+    return valid;
+}
+
+/* Inserts at position an instruction that computes var1 op var2 in a new temporal, returns its name
+ * Multiplications by 1 are skipped
+ */
+static char* emit_value(int* position, INSTR_TYPE type, char* var1, char* var2) {
+    if (type == I_MUL && strcmp(var2, "1") == 0) return var1;
+    if (type == I_MUL && strcmp(var1, "1") == 0) return var2;
+    INFO var1_info, var2_info, dest_info;
+    var1_info.type = TABLE_ID;
+    var1_info.id.name = var1;
+    var2_info.type = TABLE_ID;
+    var2_info.id.name = var2;
+    dest_info.type = TABLE_ID;
+    dest_info.id.name = new_temp();
+    insert_instr((*position)++, type, &var1_info, &var2_info, &dest_info);
+    return dest_info.id.name;
+}
+
+/* Inserts at position the addition (sign 1) or subtraction of value to var
+ */
+static void emit_update(int* position, char* var, int sign, char* value) {
+    INFO var_info, value_info;
+    var_info.type = TABLE_ID;
+    var_info.id.name = var;
+    value_info.type = TABLE_ID;
+    value_info.id.name = value;
+    insert_instr((*position)++, sign > 0 ? I_ADD : I_SUB, &var_info, &value_info, &var_info);
+}
+
+/* Inserts at position the computation of how many iterations the counted loop runs, returns its name. The loop is
+ * only entered when its condition holds, so it is at least one
+ */
+static char* emit_trip_count(int* position, COUNTED_LOOP* counted, INSTR_TYPE type) {
+    long step = labs(counted->step);
+    char* distance = counted->step > 0 ? emit_value(position, I_SUB, counted->bound, counted->var)
+                                       : emit_value(position, I_SUB, counted->var, counted->bound);
+    if (type == I_JLEQ || type == I_JGEQ) {
+        if (step > 1) distance = emit_value(position, I_DIV, distance, constant_name(step));
+        return emit_value(position, I_ADD, distance, "1");
+    }
+    if (step == 1) return distance;
+    distance = emit_value(position, I_ADD, distance, constant_name(step - 1));
+    return emit_value(position, I_DIV, distance, constant_name(step));
+}
+
+/* Replaces the counted loop by the final values of its variables when its body only adds invariants and products
+ * of i by invariants to accumulators. With T iterations starting at i0:
+ *     s = s + a * T + b * (T * i0 + step * T * (T - 1) / 2)      (i read before its step)
+ *     i = i0 + step * T
+ * Returns 1 if the loop was replaced
+ */
+static int replace_by_closed_form(COUNTED_LOOP* counted) {
+    ACCUMULATOR* accumulators = malloc(MAX_TERMS * sizeof(ACCUMULATOR));
+    if (!accumulators) error_allocate_mem();
+    int count;
+    if (!find_accumulators(counted, accumulators, &count) ||
+        get_code_size() + MAX_CLOSED_FORM >= MAX_CODE_SIZE) {
+        free(accumulators);
+        return 0;
+    }
+    int num_terms = 0;
+    for (int a = 0; a < count; a++) num_terms += accumulators[a].num_terms;
+    if (num_terms * 2 + 24 > MAX_CLOSED_FORM) {
+        free(accumulators);
+        return 0;
+    }
+
+    char* var = counted->var;
+    INSTR_TYPE test_type = get_intermediate_code()[counted->test].instruct->instruct.type_instruct;
+    for (int i = counted->test; i >= counted->label; i--) {
+        remove_instr(i);
+    }
+
+    int position = counted->label;
+    char* trips = emit_trip_count(&position, counted, test_type);
+    char* sums[2] = {NULL, NULL}; // Sum of the values of i read before and after the step
+    char* triangle = NULL; // T * (T - 1) / 2, halving the even factor so it is exact even if the product wraps
+    for (int a = 0; a < count; a++) {
+        for (int t = 0; t < accumulators[a].num_terms; t++) {
+            TERM* term = &accumulators[a].terms[t];
+            char* value = trips;
+            if (term->with_var) {
+                if (!triangle) {
+                    char* half = emit_value(&position, I_DIV, trips, "2");
+                    char* previous = emit_value(&position, I_SUB, trips, "1");
+                    char* even = emit_value(&position, I_MUL, half, previous);
+                    char* odd = emit_value(&position, I_MUL, emit_value(&position, I_MOD, trips, "2"),
+                                           emit_value(&position, I_DIV, previous, "2"));
+                    triangle = emit_value(&position, I_ADD, even, odd);
+                }
+                if (!sums[term->after_step]) {
+                    char* first = term->after_step ? emit_value(&position, I_ADD, var, constant_name(counted->step))
+                                                   : var;
+                    sums[term->after_step] =
+                        emit_value(&position, I_ADD, emit_value(&position, I_MUL, trips, first),
+                                   emit_value(&position, I_MUL, triangle, constant_name(counted->step)));
+                }
+                value = sums[term->after_step];
+            }
+            value = emit_value(&position, I_MUL, term->factor, value);
+            emit_update(&position, accumulators[a].var, term->sign, value);
+        }
+    }
+    emit_update(&position, var, 1, emit_value(&position, I_MUL, trips, constant_name(counted->step)));
+    free(accumulators);
+    return 1;
+}
+
+/* Function that computes the final values of the counted loops whose body only adds invariants and multiples of i
+ * to accumulators (add recurrences) and replaces the loops by them. Counted loops without side effects whose
+ * values are not read after them are deleted. Loops must be rotated and out of SSA form
+ */
+void replace_computable_loops() {
+    Instr* code = get_intermediate_code();
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER) continue;
+        int changed = 1;
+        while (changed) {
+            changed = 0;
+            CFG* cfg = build_cfg(enter);
+            int* idom = compute_dominators(cfg);
+            int count;
+            LOOP* loops = find_loops(cfg, idom, &count);
+            for (int l = 0; l < count && !changed; l++) {
+                COUNTED_LOOP counted;
+                if (find_counted_loop(cfg, idom, &loops[l], loops, count, &counted)) {
+                    changed = delete_unused_loop(cfg, &loops[l], &counted) || replace_by_closed_form(&counted);
+                }
+            }
+            free_loops(loops, count);
+            free(idom);
+            free_cfg(cfg);
+        }
+    }
+}
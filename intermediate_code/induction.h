@@ -0,0 +1,18 @@
+#ifndef INDUCTION_H
+#define INDUCTION_H
+
+#include "loops.h"
+
+/* Function that reduces the strength of the derived induction variables of counted loops: a value computed as
+ * i * k (+ or - b) in every iteration, with k and b invariant, becomes a variable initialized before the loop and
+ * increased by k * step next to i = i + step. When i is then only needed by the exit test, the test is rewritten
+ * onto the new variable and i is removed from the loop. Loops must be rotated and out of SSA form
+ */
+void reduce_induction_variables();
+/* Function that computes the final values of the counted loops whose body only adds invariants and multiples of i
+ * to accumulators (add recurrences) and replaces the loops by them. Counted loops without side effects whose
+ * values are not read after them are deleted. Loops must be rotated and out of SSA form
+ */
+void replace_computable_loops();
+
+#endif
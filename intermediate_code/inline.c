@@ -0,0 +1,246 @@
+#include "inline.h"
+#include "purity.h"
+
+// Most instructions of a method whose calls are inlined without being marked as inline
+#define INLINE_THRESHOLD 24
+// Most instructions that inlining can add to a method (methods marked as inline are always inlined)
+#define INLINE_GROWTH_BUDGET 256
+// Most operand names a method can have after inlining, the object code maps each one to a stack slot
+#define MAX_INLINED_NAMES 150
+
+extern int remarks;
+
+// Number of the next inlined copy, its locals are renamed to name@number
+static int inline_counter = 0;
+
+/* Checks if an instruction of the method that starts at enter reads or writes a global
+ */
+static int uses_globals(int enter) {
+    Instr* code = get_intermediate_code();
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        INFO* operands[3];
+        int num_operands = get_uses(&code[i], operands);
+        INFO* dest = get_dest(&code[i]);
+        if (dest) operands[num_operands++] = dest;
+        for (int o = 0; o < num_operands; o++) {
+            if (is_global(operands[o]->id.name)) return 1;
+        }
+    }
+    return 0;
+}
+
+/* Counts the different operand names of the method that starts at enter
+ */
+static int count_names(int enter) {
+    Instr* code = get_intermediate_code();
+    int leave = find_leave(enter);
+    char** names = malloc((leave - enter) * 3 * sizeof(char*) + 1);
+    if (!names) error_allocate_mem();
+    int count = 0;
+    for (int i = enter + 1; i < leave; i++) {
+        INFO* operands[3] = {code[i].var1, code[i].var2, code[i].reg};
+        for (int o = 0; o < 3; o++) {
+            if (!operands[o] || is_constant(operands[o]->id.name) || operands[o]->id.name[0] == '_') continue;
+            int seen = 0;
+            for (int n = 0; n < count && !seen; n++) seen = strcmp(names[n], operands[o]->id.name) == 0;
+            if (!seen) names[count++] = operands[o]->id.name;
+        }
+    }
+    free(names);
+    return count;
+}
+
+/* Returns the name an operand of the inlined copy number copy gets: labels and temporals get new ones (saved in
+ * old_names and new_names so every use gets the same one), locals and parameters are renamed to name@copy
+ */
+static char* inline_name(char* name, int copy, char** old_names, char** new_names, int* num_names) {
+    if (is_constant(name) || is_global(name)) return name;
+    for (int n = 0; n < *num_names; n++) {
+        if (strcmp(old_names[n], name) == 0) return new_names[n];
+    }
+    char buf[128];
+    old_names[*num_names] = name;
+    if (name[0] == '_') {
+        new_names[*num_names] = new_label();
+    } else if (is_temp(name)) {
+        new_names[*num_names] = new_temp();
+    } else {
+        snprintf(buf, sizeof(buf), "%s@%d", name, copy);
+        new_names[*num_names] = my_strdup(buf);
+    }
+    return new_names[(*num_names)++];
+}
+
+/* Replaces the call at index by a copy of the body of the method that starts at enter:
+ *     PARAM a1; ...; PARAM an; CALL f, t
+ * becomes
+ *     STORE a1, p1@k; ...; STORE an, pn@k
+ *     body of f, where "RET v" is "STORE v, @k; JMP L_end"
+ *     L_end:
+ *     STORE @k, t
+ * Returns the index of the first instruction of the copy
+ */
+static int inline_call(int call, int enter, INFO* decl) {
+    Instr* code = get_intermediate_code();
+    int leave = find_leave(enter);
+    int size = leave - enter - 1;
+    int num_args = decl->method_decl.num_args;
+    int copy = inline_counter++;
+    Instr* body = malloc((size + 1) * sizeof(Instr));
+    char** old_names = malloc((size * 3 + num_args + 1) * sizeof(char*));
+    char** new_names = malloc((size * 3 + num_args + 1) * sizeof(char*));
+    if (!body || !old_names || !new_names) error_allocate_mem();
+    memcpy(body, &code[enter + 1], size * sizeof(Instr));
+    int num_names = 0;
+
+    INFO result_info, end_info, ret_info = *code[call].reg;
+    char buf[32];
+    snprintf(buf, sizeof(buf), "@%d", copy);
+    result_info.type = TABLE_ID;
+    result_info.id.name = my_strdup(buf);
+    end_info.type = TABLE_ID;
+    end_info.id.name = new_label();
+    int first = call - num_args;
+    remove_instr(call);
+
+    // Arguments are assigned to the renamed parameters
+    ARGS_LIST* arg = decl->method_decl.args;
+    for (int a = 0; a < num_args; a++, arg = arg->next) {
+        INFO value_info = *code[first + a].var1;
+        INFO param_info;
+        param_info.type = TABLE_ID;
+        param_info.id.name = inline_name(arg->arg->name, copy, old_names, new_names, &num_names);
+        remove_instr(first + a);
+        insert_instr(first + a, I_STORE, &value_info, NULL, &param_info);
+    }
+
+    int position = call;
+    int returns_value = 0;
+    for (int k = 0; k < size; k++) {
+        INSTR_TYPE type = body[k].instruct->instruct.type_instruct;
+        INFO* operands[3] = {body[k].var1, body[k].var2, body[k].reg};
+        INFO copies[3];
+        for (int o = 0; o < 3; o++) {
+            if (!operands[o]) continue;
+            copies[o] = *operands[o];
+            if (type != I_CALL || o != 0) {
+                copies[o].id.name = inline_name(operands[o]->id.name, copy, old_names, new_names, &num_names);
+            }
+        }
+        if (type == I_RET) {
+            if (operands[0]) {
+                insert_instr(position++, I_STORE, &copies[0], NULL, &result_info);
+                returns_value = 1;
+            }
+            insert_instr(position++, I_JMP, &end_info, NULL, NULL);
+            continue;
+        }
+        insert_instr(position++, type, operands[0] ? &copies[0] : NULL, operands[1] ? &copies[1] : NULL,
+                     operands[2] ? &copies[2] : NULL);
+    }
+    insert_instr(position++, I_LABEL, &end_info, NULL, NULL);
+    if (returns_value) insert_instr(position, I_STORE, &result_info, NULL, &ret_info);
+    free(body);
+    free(old_names);
+    free(new_names);
+    return first;
+}
+
+/* Checks if the call at index can be replaced by the body of the method it calls from the method caller, with budget
+ * instructions left to add to the caller. Saves the declaration of the callee in decl
+ */
+static int should_inline(int index, int caller_enter, int budget, INFO** decl) {
+    Instr* code = get_intermediate_code();
+    const char* callee = code[index].var1->id.name;
+    *decl = find_method_decl(callee);
+    int enter = find_enter(callee);
+    if (!*decl || (*decl)->method_decl.is_extern || enter < 0 || enter == caller_enter ||
+        (*decl)->method_decl.inline_hint == INLINE_NEVER || !code[index].reg) {
+        return 0;
+    }
+    int num_args = (*decl)->method_decl.num_args;
+    if (index < num_args) return 0;
+    for (int a = index - num_args; a < index; a++) {
+        if (code[a].instruct->instruct.type_instruct != I_PARAM) return 0;
+    }
+    int size = find_leave(enter) - enter - 1;
+    int forced = (*decl)->method_decl.inline_hint == INLINE_ALWAYS;
+    if ((!forced && (size > INLINE_THRESHOLD || size > budget)) || get_code_size() + size + 3 >= MAX_CODE_SIZE ||
+        count_names(caller_enter) + count_names(enter) + 1 > MAX_INLINED_NAMES) {
+        return 0;
+    }
+    return !is_recursive_method(callee) && !uses_globals(enter);
+}
+
+/* Function that replaces the calls to small methods by a copy of their body (inline expansion). Methods defined in
+ * the program that are not recursive and don't access globals are inlined when they have at most INLINE_THRESHOLD
+ * instructions, or always when marked as inline. Methods marked as noinline are never inlined
+ * Calls in the inlined copies are considered too, so chains of small methods are flattened
+ */
+void inline_methods() {
+    Instr* code = get_intermediate_code();
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER) continue;
+        int budget = INLINE_GROWTH_BUDGET;
+        for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+            INFO* decl;
+            if (code[i].instruct->instruct.type_instruct != I_CALL || !should_inline(i, enter, budget, &decl)) continue;
+            int before = get_code_size();
+            i = inline_call(i, find_enter(code[i].var1->id.name), decl) - 1;
+            budget -= get_code_size() - before;
+        }
+    }
+}
+
+/* Marks the method name (by the index of its ENTER or EXTERN) and the methods it calls as reachable
+ */
+static void mark_called(const char* name, char* reachable) {
+    Instr* code = get_intermediate_code();
+    for (int i = 0; i < get_code_size(); i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if ((type != I_ENTER && type != I_EXTERN) || strcmp(code[i].var1->id.name, name) != 0) continue;
+        if (reachable[i]) return;
+        reachable[i] = 1;
+        if (type == I_EXTERN) return;
+        for (int j = i + 1; code[j].instruct->instruct.type_instruct != I_LEAVE; j++) {
+            if (code[j].instruct->instruct.type_instruct == I_CALL) mark_called(code[j].var1->id.name, reachable);
+        }
+        return;
+    }
+}
+
+/* Function that removes the methods and extern declarations that main can no longer reach through calls, because
+ * every call to them was inlined, redirected to a clone or removed
+ */
+void remove_uncalled_methods() {
+    Instr* code = get_intermediate_code();
+    if (find_enter("main") < 0) return;
+    char* reachable = calloc(get_code_size() + 1, 1);
+    if (!reachable) error_allocate_mem();
+    mark_called("main", reachable);
+    // Calls outside methods (initializations of globals) always run
+    int in_method = 0;
+    for (int i = 0; i < get_code_size(); i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_ENTER) in_method = 1;
+        if (type == I_LEAVE) in_method = 0;
+        if (!in_method && type == I_CALL) mark_called(code[i].var1->id.name, reachable);
+    }
+    for (int i = get_code_size() - 1; i >= 0; i--) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_EXTERN && !reachable[i]) {
+            if (remarks) fprintf(stderr, "Remark: extern method %s is no longer called, its .extern is skipped\n",
+                                 code[i].var1->id.name);
+            remove_instr(i);
+        } else if (type == I_LEAVE) {
+            int enter = i;
+            while (code[enter].instruct->instruct.type_instruct != I_ENTER) enter--;
+            if (reachable[enter]) continue;
+            if (remarks) fprintf(stderr, "Remark: method %s is no longer called, it is removed\n",
+                                 code[enter].var1->id.name);
+            for (int k = i; k >= enter; k--) remove_instr(k);
+            i = enter;
+        }
+    }
+    free(reachable);
+}
@@ -0,0 +1,16 @@
+#ifndef INLINE_H
+#define INLINE_H
+
+#include "intermediate_code.h"
+
+/* Function that replaces the calls to small methods by a copy of their body (inline expansion). Methods defined in
+ * the program that are not recursive and don't access globals are inlined when they have at most INLINE_THRESHOLD
+ * instructions, or always when marked as inline. Methods marked as noinline are never inlined
+ */
+void inline_methods();
+/* Function that removes the methods and extern declarations that main can no longer reach through calls, because
+ * every call to them was inlined, redirected to a clone or removed
+ */
+void remove_uncalled_methods();
+
+#endif
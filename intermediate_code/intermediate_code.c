@@ -1,4 +1,5 @@
 #include "intermediate_code.h"
+#include <ctype.h>
 
 // Buffer for save all the instructions (pseudo-assembly)
 Instr code[MAX_CODE_SIZE];
@@ -21,7 +22,7 @@ char* new_temp() {
 
 /* Function to generate new labels for jumps
  */
-static char* new_label() {
+char* new_label() {
     char buf[32];
     sprintf(buf, "_L%d", label_counter++);
     return my_strdup(buf);
@@ -58,7 +59,7 @@ void increase_temp_ap(char* temp) {
         current = current->next;
     }
     // If not found, create a new entry
-    CANT_AP_TEMP* new_entry = malloc(sizeof(CANT_AP_TEMP));
+    CANT_AP_TEMP* new_entry = calloc(1, sizeof(CANT_AP_TEMP));
     new_entry->cant_ap = 1;
     new_entry->temp = my_strdup(temp);
     new_entry->next = NULL;
@@ -116,6 +117,24 @@ void emit(INSTR_TYPE t, INFO* var1, INFO* var2, INFO* reg) {
     code_size++;
 }
 
+/* Function that checks if node is an integer literal that can be used directly as an operand (only with
+ * optimizations)
+ */
+static int constant_operand(AST_NODE* node, int* value) {
+    if (!optimizations || !node || node->info->type != AST_LEAF || node->info->leaf.type != TYPE_INT) {
+        return 0;
+    }
+    *value = node->info->leaf.value->int_value;
+    return 1;
+}
+
+/* Function that checks if node is an integer literal that can be used directly as a divisor (never 0, so the
+ * division by zero is still done at runtime)
+ */
+static int constant_divisor(AST_NODE* node, int* value) {
+    return constant_operand(node, value) && *value != 0;
+}
+
 /* Function that generates code for leaf nodes
  */
 static void gen_code_leaf(AST_NODE* node, INFO* result) {
@@ -161,6 +180,35 @@ static void gen_code_leaf(AST_NODE* node, INFO* result) {
     }
 }
 
+static void gen_code_cond(AST_NODE* node, char* true_label, char* false_label);
+
+/* Function that generates code for && and || used as values: the condition is lowered to jumps
+ * (short-circuit) and the boolean is only materialised at the end
+ */
+static void gen_code_logic_value(AST_NODE* node, INFO* result) {
+    INFO temp_info, false_label_info, end_label_info, value_info;
+    temp_info.type = TABLE_ID;
+    false_label_info.type = TABLE_ID;
+    end_label_info.type = TABLE_ID;
+    value_info.type = TABLE_ID;
+
+    temp_info.id.name = new_temp();
+    temp_info.id.type = TYPE_BOOL;
+    false_label_info.id.name = new_label();
+    end_label_info.id.name = new_label();
+    value_info.id.type = TYPE_BOOL;
+
+    gen_code_cond(node, NULL, false_label_info.id.name);
+    value_info.id.name = my_strdup("1");
+    emit(I_LOADVAL, &value_info, NULL, &temp_info);
+    emit(I_JMP, &end_label_info, NULL, NULL);
+    emit(I_LABEL, &false_label_info, NULL, NULL);
+    value_info.id.name = my_strdup("0");
+    emit(I_LOADVAL, &value_info, NULL, &temp_info);
+    emit(I_LABEL, &end_label_info, NULL, NULL);
+    if (result) *result = temp_info;
+}
+
 /* Function that generates code for common expressions
  */
 static void gen_code_common(AST_NODE* node, INFO* result) {
@@ -193,25 +241,36 @@ static void gen_code_common(AST_NODE* node, INFO* result) {
             if (result) *result = *temp;
             break;
 
-        case OP_MULTIPLICATION:
-            gen_code(node->info->common.left, left);
-            gen_code(node->info->common.right, right);
+        case OP_MULTIPLICATION: {
+            int factor;
+            AST_NODE* other = node->info->common.left;
+            if (constant_operand(node->info->common.right, &factor) ||
+                (constant_operand(node->info->common.left, &factor) && (other = node->info->common.right))) {
+                // A literal factor is kept as the second operand, the object code uses shifts and lea for it
+                char buf[32];
+                gen_code(other, left);
+                sprintf(buf, "%d", factor);
+                right->id.name = my_strdup(buf);
+                right->id.type = TYPE_INT;
+            } else {
+                gen_code(node->info->common.left, left);
+                gen_code(node->info->common.right, right);
+            }
             temp->id.name = new_temp();
             temp->id.type = TYPE_INT;
             emit(I_MUL, left, right, temp);
             if (result) *result = *temp;
             break;
+        }
 
-        case OP_DIVISION:
+        case OP_DIVISION: {
             gen_code(node->info->common.left, left);
-            AST_NODE* right_child = node->info->common.right;
-            if (right_child && right_child->info->type == AST_LEAF && optimizations) {
-                int right_value = right_child->info->leaf.value->int_value;
-                // Check if right_value is a power of 2 using bits operations
-                if (right_value > 0 && (right_value & (right_value - 1)) == 0) {
-                    right = (INFO*) malloc(sizeof(INFO));
-                    char buf[32];
-                    sprintf(buf, "%d", __builtin_ctz(right_value));
+            int divisor;
+            if (constant_divisor(node->info->common.right, &divisor)) {
+                char buf[32];
+                // Check if divisor is a power of 2 using bits operations
+                if (divisor > 0 && (divisor & (divisor - 1)) == 0) {
+                    sprintf(buf, "%d", __builtin_ctz(divisor));
                     right->id.name = my_strdup(buf);
                     right->id.type = TYPE_INT;
                     temp->id.name = new_temp();
@@ -220,22 +279,38 @@ static void gen_code_common(AST_NODE* node, INFO* result) {
                     if (result) *result = *temp;
                     break;
                 }
+                // Other constants are used directly, the object code replaces the division by a multiplication
+                sprintf(buf, "%d", divisor);
+                right->id.name = my_strdup(buf);
+                right->id.type = TYPE_INT;
+            } else {
+                gen_code(node->info->common.right, right);
             }
-            gen_code(node->info->common.right, right);
             temp->id.name = new_temp();
             temp->id.type = TYPE_INT;
             emit(I_DIV, left, right, temp);
             if (result) *result = *temp;
             break;
+        }
 
-        case OP_MOD:
+        case OP_MOD: {
             gen_code(node->info->common.left, left);
-            gen_code(node->info->common.right, right);
+            int divisor;
+            if (constant_divisor(node->info->common.right, &divisor)) {
+                // The object code uses a mask (powers of 2) or a multiplication instead of the division
+                char buf[32];
+                sprintf(buf, "%d", divisor);
+                right->id.name = my_strdup(buf);
+                right->id.type = TYPE_INT;
+            } else {
+                gen_code(node->info->common.right, right);
+            }
             temp->id.name = new_temp();
             temp->id.type = TYPE_INT;
             emit(I_MOD, left, right, temp);
             if (result) *result = *temp;
             break;
+        }
 
         case OP_MINUS:
             gen_code(node->info->common.left, left);
@@ -309,21 +384,8 @@ static void gen_code_common(AST_NODE* node, INFO* result) {
             break;
 
         case OP_AND:
-            gen_code(node->info->common.left, left);
-            gen_code(node->info->common.right, right);
-            temp->id.name = new_temp();
-            temp->id.type = TYPE_BOOL;
-            emit(I_AND, left, right, temp);
-            if (result) *result = *temp;
-            break;
-
         case OP_OR:
-            gen_code(node->info->common.left, left);
-            gen_code(node->info->common.right, right);
-            temp->id.name = new_temp();
-            temp->id.type = TYPE_BOOL;
-            emit(I_OR, left, right, temp);
-            if (result) *result = *temp;
+            gen_code_logic_value(node, result);
             break;
 
         case OP_NEG:
@@ -370,21 +432,113 @@ static void gen_code_common(AST_NODE* node, INFO* result) {
     }
 }
 
+/* Emits a jump to label (if there is one)
+ */
+static void emit_jump(char* label) {
+    if (label) {
+        INFO label_info;
+        label_info.type = TABLE_ID;
+        label_info.id.name = label;
+        emit(I_JMP, &label_info, NULL, NULL);
+    }
+}
+
+/* Emits the conditional jump t on var1 and var2 to true_label and/or false_label.
+ * A NULL label means that case falls through to the next instruction
+ */
+static void emit_cond_jump(INSTR_TYPE t, INFO* var1, INFO* var2, char* true_label, char* false_label) {
+    INFO label_info;
+    label_info.type = TABLE_ID;
+    if (true_label) {
+        label_info.id.name = true_label;
+        emit(t, var1, var2, &label_info);
+        emit_jump(false_label);
+    } else if (false_label) {
+        label_info.id.name = false_label;
+        emit(negate_cond_jump(t), var1, var2, &label_info);
+    }
+}
+
+/* Function that generates code for a condition as control flow (short-circuit evaluation):
+ * jumps to true_label when it holds and to false_label when it doesn't.
+ * One of the labels can be NULL, meaning that case falls through to the next instruction
+ */
+static void gen_code_cond(AST_NODE* node, char* true_label, char* false_label) {
+    INFO left_info, right_info;
+    left_info.type = TABLE_ID;
+    right_info.type = TABLE_ID;
+
+    if (node->info->type == AST_LEAF && node->info->leaf.type == TYPE_BOOL) {
+        emit_jump(node->info->leaf.value->bool_value ? true_label : false_label);
+        return;
+    }
+    if (node->info->type == AST_COMMON) {
+        INSTR_TYPE jump;
+        switch (node->info->common.op) {
+            case OP_AND:
+                if (false_label) {
+                    gen_code_cond(node->info->common.left, NULL, false_label);
+                    gen_code_cond(node->info->common.right, true_label, false_label);
+                } else {
+                    char* skip_label = new_label();
+                    INFO skip_info;
+                    skip_info.type = TABLE_ID;
+                    skip_info.id.name = skip_label;
+                    gen_code_cond(node->info->common.left, NULL, skip_label);
+                    gen_code_cond(node->info->common.right, true_label, NULL);
+                    emit(I_LABEL, &skip_info, NULL, NULL);
+                }
+                return;
+            case OP_OR:
+                if (true_label) {
+                    gen_code_cond(node->info->common.left, true_label, NULL);
+                    gen_code_cond(node->info->common.right, true_label, false_label);
+                } else {
+                    char* skip_label = new_label();
+                    INFO skip_info;
+                    skip_info.type = TABLE_ID;
+                    skip_info.id.name = skip_label;
+                    gen_code_cond(node->info->common.left, skip_label, NULL);
+                    gen_code_cond(node->info->common.right, NULL, false_label);
+                    emit(I_LABEL, &skip_info, NULL, NULL);
+                }
+                return;
+            case OP_NEG:
+                gen_code_cond(node->info->common.left, false_label, true_label);
+                return;
+            case OP_LES: jump = I_JLES; break;
+            case OP_GRT: jump = I_JGRT; break;
+            case OP_EQ:  jump = I_JEQ;  break;
+            case OP_NEQ: jump = I_JNEQ; break;
+            case OP_LEQ: jump = I_JLEQ; break;
+            case OP_GEQ: jump = I_JGEQ; break;
+            default: jump = I_JMPT; break;
+        }
+        if (jump != I_JMPT) {
+            // Comparisons jump directly on their operands, without materialising a boolean
+            gen_code(node->info->common.left, &left_info);
+            gen_code(node->info->common.right, &right_info);
+            emit_cond_jump(jump, &left_info, &right_info, true_label, false_label);
+            return;
+        }
+    }
+    // Boolean values (variables, calls): jump on the value itself
+    gen_code(node, &left_info);
+    emit_cond_jump(I_JMPT, &left_info, NULL, true_label, false_label);
+}
+
 /* Function that generates code for if expressions
  */
 static void gen_code_if(AST_NODE* node, INFO* result) {
-    INFO cond_info, else_label_info, end_label_info;
+    INFO else_label_info, end_label_info;
 
-    cond_info.type = TABLE_ID;
     else_label_info.type = TABLE_ID;
     end_label_info.type = TABLE_ID;
 
-    gen_code(node->info->if_stmt.condition, &cond_info);
-
     else_label_info.id.name = new_label();
     end_label_info.id.name = new_label();
 
-    emit(I_JMPF, &cond_info, NULL, &else_label_info);
+    gen_code_cond(node->info->if_stmt.condition, NULL, else_label_info.id.name);
     gen_code(node->info->if_stmt.then_block, NULL);
     emit(I_JMP, &end_label_info, NULL, NULL);
     emit(I_LABEL, &else_label_info, NULL, NULL);
@@ -397,18 +551,16 @@ static void gen_code_if(AST_NODE* node, INFO* result) {
 /* Function that generates code for while expressions
  */
 static void gen_code_while(AST_NODE* node, INFO* result) {
-    INFO start_label_info, end_label_info, cond_info;
+    INFO start_label_info, end_label_info;
 
     start_label_info.type = TABLE_ID;
     end_label_info.type = TABLE_ID;
-    cond_info.type = TABLE_ID;
 
     start_label_info.id.name = new_label();
     end_label_info.id.name = new_label();
 
     emit(I_LABEL, &start_label_info, NULL, NULL);
-    gen_code(node->info->while_stmt.condition, &cond_info);
-    emit(I_JMPF, &cond_info, NULL, &end_label_info);
+    gen_code_cond(node->info->while_stmt.condition, NULL, end_label_info.id.name);
     gen_code(node->info->while_stmt.block, NULL);
     emit(I_JMP, &start_label_info, NULL, NULL);
     emit(I_LABEL, &end_label_info, NULL, NULL);
@@ -597,13 +749,44 @@ void print_code_to_file(const char *filename) {
                 if (v1 && v1->id.name && reg && reg->id.name)
                     fprintf(f, "JMPF %s, %s\n", v1->id.name, reg->id.name);
                 break;
+            case I_JMPT:
+                if (v1 && v1->id.name && reg && reg->id.name)
+                    fprintf(f, "JMPT %s, %s\n", v1->id.name, reg->id.name);
+                break;
+            case I_JLES:
+                if (v1 && v1->id.name && v2 && v2->id.name && reg && reg->id.name)
+                    fprintf(f, "JLES %s, %s, %s\n", v1->id.name, v2->id.name, reg->id.name);
+                break;
+            case I_JGRT:
+                if (v1 && v1->id.name && v2 && v2->id.name && reg && reg->id.name)
+                    fprintf(f, "JGRT %s, %s, %s\n", v1->id.name, v2->id.name, reg->id.name);
+                break;
+            case I_JEQ:
+                if (v1 && v1->id.name && v2 && v2->id.name && reg && reg->id.name)
+                    fprintf(f, "JEQ %s, %s, %s\n", v1->id.name, v2->id.name, reg->id.name);
+                break;
+            case I_JNEQ:
+                if (v1 && v1->id.name && v2 && v2->id.name && reg && reg->id.name)
+                    fprintf(f, "JNEQ %s, %s, %s\n", v1->id.name, v2->id.name, reg->id.name);
+                break;
+            case I_JLEQ:
+                if (v1 && v1->id.name && v2 && v2->id.name && reg && reg->id.name)
+                    fprintf(f, "JLEQ %s, %s, %s\n", v1->id.name, v2->id.name, reg->id.name);
+                break;
+            case I_JGEQ:
+                if (v1 && v1->id.name && v2 && v2->id.name && reg && reg->id.name)
+                    fprintf(f, "JGEQ %s, %s, %s\n", v1->id.name, v2->id.name, reg->id.name);
+                break;
             case I_PARAM:
                 if (v1 && v1->id.name)
                     fprintf(f, "PARAM %s\n", v1->id.name);
                 break;
             case I_CALL:
-                if (v1 && v1->id.name && reg && reg->id.name)
+                if (v1 && v1->id.name && reg && reg->id.name) {
                     fprintf(f, "CALL %s, %s\n", v1->id.name, reg->id.name);
+                } else if (v1 && v1->id.name) {
+                    fprintf(f, "CALL %s\n", v1->id.name);
+                }
                 break;
             case I_ENTER:
                 if (v1 && v1->id.name)
@@ -694,6 +877,55 @@ void cleanup_code() {
     }
 }
 
+/* Function that renames the global variables to name$global. Identifiers can't have a '$', so a parameter or local
+ * that shadows a global never has its name, and is_global tells them apart by name alone
+ */
+void rename_globals() {
+    for (AST_ROOT* cur = head_ast; cur; cur = cur->next) {
+        INFO* info = cur->sentence->info;
+        if (info->type != AST_COMMON || info->common.op != OP_DECL) continue;
+        AST_NODE* left = info->common.left;
+        if (left->info->type != AST_LEAF || left->info->leaf.type != TYPE_ID || !left->info->leaf.value->id_leaf) continue;
+        INFO* var = left->info->leaf.value->id_leaf->info;
+        char* name = malloc(strlen(var->id.name) + strlen("$global") + 1);
+        if (!name) error_allocate_mem();
+        sprintf(name, "%s$global", var->id.name);
+        var->id.name = name;
+    }
+}
+
+/* Function that moves the code that initializes the global variables, generated outside the methods, to the start
+ * of main, so it runs once before the body of the program
+ */
+void move_global_initializers() {
+    int has_main = 0;
+    for (int i = 0; i < code_size; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_ENTER && strcmp(code[i].var1->id.name, "main") == 0) {
+            has_main = 1;
+        }
+    }
+    if (!has_main) return;
+    Instr* init = malloc((code_size + 1) * sizeof(Instr));
+    Instr* rest = malloc((code_size + 1) * sizeof(Instr));
+    if (!init || !rest) error_allocate_mem();
+    int init_count = 0, rest_count = 0, inside = 0;
+    for (int i = 0; i < code_size; i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_ENTER) inside = 1;
+        if (inside || type == I_EXTERN) rest[rest_count++] = code[i];
+        else init[init_count++] = code[i];
+        if (type == I_LEAVE) inside = 0;
+    }
+    int k = 0;
+    for (int i = 0; i < rest_count; i++) {
+        code[k++] = rest[i];
+        if (rest[i].instruct->instruct.type_instruct != I_ENTER || strcmp(rest[i].var1->id.name, "main") != 0) continue;
+        for (int j = 0; j < init_count; j++) code[k++] = init[j];
+    }
+    free(init);
+    free(rest);
+}
+
 /* Function that returns intermediate code generated
  */
 Instr* get_intermediate_code() {
@@ -706,6 +938,176 @@ int get_code_size() {
     return code_size;
 }
 
+/* Function that checks if an operand name is a numeric constant
+ */
+int is_constant(const char* name) {
+    if (!name) return 0;
+    return isdigit((unsigned char)name[0]) || (name[0] == '-' && isdigit((unsigned char)name[1]));
+}
+
+/* Function that checks if an operand name is a temporal
+ */
+int is_temp(const char* name) {
+    return name && name[0] == '$';
+}
+
+/* Function that checks if name is declared at the top level of the program
+ */
+int is_global(const char* name) {
+    for (AST_ROOT* cur = head_ast; cur; cur = cur->next) {
+        INFO* info = cur->sentence->info;
+        if (info->type != AST_COMMON || info->common.op != OP_DECL) continue;
+        AST_NODE* left = info->common.left;
+        if (left->info->type == AST_LEAF && left->info->leaf.type == TYPE_ID && left->info->leaf.value->id_leaf &&
+            strcmp(left->info->leaf.value->id_leaf->info->id.name, name) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Function that returns the declaration of the method name in the AST (NULL if it isn't declared)
+ */
+INFO* find_method_decl(const char* name) {
+    for (AST_ROOT* cur = head_ast; cur; cur = cur->next) {
+        INFO* info = cur->sentence->info;
+        if (info->type == AST_METHOD_DECL && strcmp(info->method_decl.name, name) == 0) return info;
+    }
+    return NULL;
+}
+
+/* Function that returns the index of the ENTER of the method name (-1 if it is not defined in the program)
+ */
+int find_enter(const char* name) {
+    Instr* code = get_intermediate_code();
+    for (int i = 0; i < get_code_size(); i++) {
+        if (code[i].instruct->instruct.type_instruct == I_ENTER && strcmp(code[i].var1->id.name, name) == 0) return i;
+    }
+    return -1;
+}
+
+/* Function that returns the index of the LEAVE of the method that starts at enter
+ */
+int find_leave(int enter) {
+    Instr* code = get_intermediate_code();
+    int leave = enter + 1;
+    while (code[leave].instruct->instruct.type_instruct != I_LEAVE) leave++;
+    return leave;
+}
+
+/* Function that returns the constant that the operand name has at index of the method that starts at enter (NULL
+ * if it isn't a constant): constants are loaded into temporals, a temporal with a single definition before index
+ * that loads a constant always has it
+ */
+char* constant_value(int index, int enter, char* name) {
+    if (is_constant(name)) return name;
+    if (!is_temp(name)) return NULL;
+    char* value = NULL;
+    int definitions = 0;
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        INFO* dest = get_dest(&code[i]);
+        if (!dest || strcmp(dest->id.name, name) != 0) continue;
+        definitions++;
+        if (i < index && code[i].instruct->instruct.type_instruct == I_LOADVAL && is_constant(code[i].var1->id.name)) {
+            value = code[i].var1->id.name;
+        }
+    }
+    return definitions == 1 ? value : NULL;
+}
+
+/* Function that returns the operand written by an instruction (NULL if it doesn't write any)
+ * For jumps, reg holds the target label so it's not considered a destination
+ */
+INFO* get_dest(Instr* instr) {
+    if (is_cond_jump(instr->instruct->instruct.type_instruct)) {
+        return NULL;
+    }
+    switch (instr->instruct->instruct.type_instruct) {
+        case I_LOAD: case I_RET: case I_LABEL: case I_JMP:
+        case I_PARAM: case I_ENTER: case I_LEAVE: case I_EXTERN:
+            return NULL;
+        default:
+            return instr->reg;
+    }
+}
+
+/* Function that saves in uses the operands read by an instruction (at most 2) and returns how many there are
+ * Labels, method names and the destination are not uses
+ */
+int get_uses(Instr* instr, INFO** uses) {
+    int count = 0;
+    switch (instr->instruct->instruct.type_instruct) {
+        case I_LABEL: case I_JMP: case I_CALL: case I_ENTER: case I_LEAVE: case I_EXTERN:
+            return 0;
+        default:
+            if (instr->var1) uses[count++] = instr->var1;
+            if (instr->var2) uses[count++] = instr->var2;
+            return count;
+    }
+}
+
+/* Function that checks if an instruction type is a conditional jump (the label is saved in reg)
+ */
+int is_cond_jump(INSTR_TYPE t) {
+    switch (t) {
+        case I_JMPF: case I_JMPT: case I_JLES: case I_JGRT:
+        case I_JEQ: case I_JNEQ: case I_JLEQ: case I_JGEQ:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/* Function that returns the conditional jump that jumps exactly when t doesn't
+ */
+INSTR_TYPE negate_cond_jump(INSTR_TYPE t) {
+    switch (t) {
+        case I_JMPF: return I_JMPT;
+        case I_JMPT: return I_JMPF;
+        case I_JLES: return I_JGEQ;
+        case I_JGRT: return I_JLEQ;
+        case I_JEQ:  return I_JNEQ;
+        case I_JNEQ: return I_JEQ;
+        case I_JLEQ: return I_JGRT;
+        case I_JGEQ: return I_JLES;
+        default: return t;
+    }
+}
+
+/* Function that removes the instruction in position index, shifting the following ones
+ */
+void remove_instr(int index) {
+    if (index < 0 || index >= code_size) return;
+    if (code[index].var1) free(code[index].var1);
+    if (code[index].var2) free(code[index].var2);
+    if (code[index].reg) free(code[index].reg);
+    if (code[index].instruct) free(code[index].instruct);
+    memmove(&code[index], &code[index + 1], (code_size - index - 1) * sizeof(Instr));
+    code_size--;
+}
+
+/* Function that inserts a new instruction in position index, shifting the following ones
+ */
+void insert_instr(int index, INSTR_TYPE t, INFO* var1, INFO* var2, INFO* reg) {
+    emit(t, var1, var2, reg); // emit at the end and then rotate it to its place
+    Instr new_instr = code[code_size - 1];
+    memmove(&code[index + 1], &code[index], (code_size - 1 - index) * sizeof(Instr));
+    code[index] = new_instr;
+}
+
+/* Function that moves the instruction in position from to position to, shifting the ones in between
+ */
+void move_instr(int from, int to) {
+    if (from == to || from < 0 || to < 0 || from >= code_size || to >= code_size) return;
+    Instr moved = code[from];
+    if (from < to) {
+        memmove(&code[from], &code[from + 1], (to - from) * sizeof(Instr));
+    } else {
+        memmove(&code[to + 1], &code[to], (from - to) * sizeof(Instr));
+    }
+    code[to] = moved;
+}
+
 /* Function that prints list of temporals used before optimization
  */
 void print_temp_list(CANT_AP_TEMP* head) {
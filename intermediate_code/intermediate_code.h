@@ -58,5 +58,63 @@ int get_code_size();
 /* Function that prints list of temporals used before optimization
  */
 void print_temp_list(CANT_AP_TEMP* head);
+/* Function that renames the global variables to name$global. Identifiers can't have a '$', so a parameter or local
+ * that shadows a global never has its name, and is_global tells them apart by name alone
+ */
+void rename_globals();
+/* Function that moves the code that initializes the global variables, generated outside the methods, to the start
+ * of main, so it runs once before the body of the program
+ */
+void move_global_initializers();
+/* Function to generate new temporary variables
+ */
+char* new_temp();
+/* Function to generate new labels for jumps
+ */
+char* new_label();
+/* Function that checks if an operand name is a numeric constant
+ */
+int is_constant(const char* name);
+/* Function that checks if an operand name is a temporal
+ */
+int is_temp(const char* name);
+/* Function that checks if name is declared at the top level of the program
+ */
+int is_global(const char* name);
+/* Function that returns the declaration of the method name in the AST (NULL if it isn't declared)
+ */
+INFO* find_method_decl(const char* name);
+/* Function that returns the index of the ENTER of the method name (-1 if it is not defined in the program)
+ */
+int find_enter(const char* name);
+/* Function that returns the index of the LEAVE of the method that starts at enter
+ */
+int find_leave(int enter);
+/* Function that returns the constant that the operand name has at index of the method that starts at enter (NULL
+ * if it isn't a constant): constants are loaded into temporals, a temporal with a single definition before index
+ * that loads a constant always has it
+ */
+char* constant_value(int index, int enter, char* name);
+/* Function that checks if an instruction type is a conditional jump (the label is saved in reg)
+ */
+int is_cond_jump(INSTR_TYPE t);
+/* Function that returns the conditional jump that jumps exactly when t doesn't
+ */
+INSTR_TYPE negate_cond_jump(INSTR_TYPE t);
+/* Function that returns the operand written by an instruction (NULL if it doesn't write any)
+ */
+INFO* get_dest(Instr* instr);
+/* Function that saves in uses the operands read by an instruction (at most 2) and returns how many there are
+ */
+int get_uses(Instr* instr, INFO** uses);
+/* Function that removes the instruction in position index, shifting the following ones
+ */
+void remove_instr(int index);
+/* Function that inserts a new instruction in position index, shifting the following ones
+ */
+void insert_instr(int index, INSTR_TYPE t, INFO* var1, INFO* var2, INFO* reg);
+/* Function that moves the instruction in position from to position to, shifting the ones in between
+ */
+void move_instr(int from, int to);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include "layout.h"
+#include "loops.h"
+
+extern int remarks;
+
+// Methods that order_methods placed in the cold section (including copies that have no declaration)
+static char** cold_methods = NULL;
+static int num_cold_methods = 0;
+
+// Call between two methods and how much it weighs (both directions together)
+typedef struct CALL_EDGE {
+    int a;
+    int b;
+    long weight;
+} CALL_EDGE;
+
+/* Returns the position of the method name in names (-1 if it isn't a method of the program)
+ */
+static int method_position(char** names, int count, const char* name) {
+    for (int m = 0; m < count; m++) {
+        if (strcmp(names[m], name) == 0) return m;
+    }
+    return -1;
+}
+
+/* Adds the weight of the calls of the method at position caller to the methods of the program they call, using the
+ * loops around each call
+ */
+static void add_static_weights(int enter, int caller, char** names, int count, long* weights) {
+    Instr* code = get_intermediate_code();
+    CFG* cfg = build_cfg(enter);
+    int* idom = compute_dominators(cfg);
+    int num_loops;
+    LOOP* loops = find_loops(cfg, idom, &num_loops);
+    for (int i = enter + 1; i < cfg->leave; i++) {
+        if (code[i].instruct->instruct.type_instruct != I_CALL) continue;
+        int callee = method_position(names, count, code[i].var1->id.name);
+        if (callee < 0) continue;
+        int block = block_of(cfg, i);
+        long weight = 1;
+        int depth = 0;
+        for (int l = 0; l < num_loops && block >= 0; l++) {
+            if (loops[l].blocks[block] && depth++ < MAX_WEIGHTED_DEPTH) weight *= LOOP_CALL_WEIGHT;
+        }
+        weights[caller * count + callee] += weight;
+    }
+    free_loops(loops, num_loops);
+    free(idom);
+    free_cfg(cfg);
+}
+
+/* Checks if name is the method source_name of the program or one of its copies (name.specN, name.uncached)
+ */
+static int is_copy_of(const char* name, const char* source_name) {
+    size_t length = strlen(source_name);
+    return strncmp(name, source_name, length) == 0 && (name[length] == '\0' || name[length] == '.');
+}
+
+/* Reads the weights of the calls from the profile ("caller callee count" per line, with the names of the source).
+ * Returns 0 if it can't be read
+ */
+static int add_profile_weights(const char* profile, char** names, int count, long* weights) {
+    FILE* file = fopen(profile, "r");
+    if (!file) return 0;
+    char caller[128], callee[128];
+    long calls;
+    while (fscanf(file, "%127s %127s %ld", caller, callee, &calls) == 3) {
+        if (calls <= 0) continue;
+        for (int a = 0; a < count; a++) {
+            if (!is_copy_of(names[a], caller)) continue;
+            for (int b = 0; b < count; b++) {
+                if (is_copy_of(names[b], callee)) weights[a * count + b] += calls;
+            }
+        }
+    }
+    fclose(file);
+    return 1;
+}
+
+/* Orders the edges from the heaviest, ties by the position of their methods so the layout doesn't depend on qsort
+ */
+static int compare_edges(const void* x, const void* y) {
+    const CALL_EDGE* e1 = x;
+    const CALL_EDGE* e2 = y;
+    if (e1->weight != e2->weight) return e1->weight > e2->weight ? -1 : 1;
+    if (e1->a != e2->a) return e1->a - e2->a;
+    return e1->b - e2->b;
+}
+
+/* Function that orders the methods of the program by call-graph affinity, so callers and callees that call each
+ * other often end up next to each other in the text section (Pettis-Hansen: the chains of methods joined by the
+ * heaviest calls are merged first, and the chains are placed from the heaviest). A call weighs LOOP_CALL_WEIGHT for
+ * each loop around it, unless profile names a file with lines "caller callee count", which give the weights instead.
+ * Methods that are never called (by the code, or in the profile) are marked as cold and placed at the end
+ */
+void order_methods(const char* profile) {
+    Instr* code = get_intermediate_code();
+    int size = get_code_size();
+    int count = 0;
+    for (int i = 0; i < size; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_ENTER) count++;
+    }
+    if (count == 0) return;
+    char** names = malloc(count * sizeof(char*));
+    int* enters = malloc(count * sizeof(int));
+    long* weights = calloc((size_t)count * count, sizeof(long));
+    int* chain = malloc(count * sizeof(int)); // Chain of each method, named by its first method
+    int* next = malloc(count * sizeof(int)); // Method that follows each one in its chain (-1 for the last)
+    long* chain_weight = calloc(count, sizeof(long));
+    int* cold = calloc(count, sizeof(int));
+    CALL_EDGE* edges = malloc(((size_t)count * count + 1) * sizeof(CALL_EDGE));
+    Instr* ordered = malloc((size + 1) * sizeof(Instr));
+    if (!names || !enters || !weights || !chain || !next || !chain_weight || !cold || !edges || !ordered) {
+        error_allocate_mem();
+    }
+    int m = 0;
+    for (int i = 0; i < size; i++) {
+        if (code[i].instruct->instruct.type_instruct != I_ENTER) continue;
+        names[m] = code[i].var1->id.name;
+        enters[m++] = i;
+    }
+
+    int profiled = profile && add_profile_weights(profile, names, count, weights);
+    if (profile && !profiled) {
+        fprintf(stderr, "Warning: can't read the profile %s, the calls in the code give the method order\n", profile);
+    }
+    for (m = 0; m < count && !profiled; m++) add_static_weights(enters[m], m, names, count, weights);
+
+    for (m = 0; m < count; m++) {
+        long calls = 0;
+        for (int caller = 0; caller < count; caller++) {
+            if (caller != m) calls += weights[caller * count + m];
+        }
+        cold[m] = calls == 0 && strcmp(names[m], "main") != 0;
+        chain[m] = m;
+        next[m] = -1;
+    }
+    int num_edges = 0;
+    for (int a = 0; a < count; a++) {
+        for (int b = a + 1; b < count; b++) {
+            long weight = weights[a * count + b] + weights[b * count + a];
+            if (weight > 0 && !cold[a] && !cold[b]) edges[num_edges++] = (CALL_EDGE){a, b, weight};
+        }
+    }
+    qsort(edges, num_edges, sizeof(CALL_EDGE), compare_edges);
+    // The chain of b goes after the chain of a, the heaviest calls join their methods first
+    for (int e = 0; e < num_edges; e++) {
+        int first = chain[edges[e].a], second = chain[edges[e].b];
+        chain_weight[first] += edges[e].weight;
+        if (first == second) continue;
+        int last = first;
+        while (next[last] >= 0) last = next[last];
+        next[last] = second;
+        chain_weight[first] += chain_weight[second];
+        for (int k = second; k >= 0; k = next[k]) chain[k] = first;
+    }
+
+    // Instructions outside the methods (extern declarations) stay at the start
+    int position = 0;
+    int inside = 0;
+    for (int i = 0; i < size; i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_ENTER) inside = 1;
+        if (!inside) ordered[position++] = code[i];
+        if (type == I_LEAVE) inside = 0;
+    }
+    // Hot chains from the heaviest, then the cold methods in the order of the source
+    char* placed = calloc(count, 1);
+    if (!placed) error_allocate_mem();
+    for (int round = 0; round < 2; round++) {
+        while (1) {
+            int best = -1;
+            for (m = 0; m < count; m++) {
+                if (placed[m] || chain[m] != m || cold[m] != round) continue;
+                if (best < 0 || chain_weight[m] > chain_weight[best]) best = m;
+            }
+            if (best < 0) break;
+            for (int k = best; k >= 0; k = next[k]) {
+                placed[k] = 1;
+                int leave = find_leave(enters[k]);
+                for (int i = enters[k]; i <= leave; i++) ordered[position++] = code[i];
+                if (cold[k]) {
+                    cold_methods = realloc(cold_methods, (num_cold_methods + 1) * sizeof(char*));
+                    if (!cold_methods) error_allocate_mem();
+                    cold_methods[num_cold_methods++] = names[k];
+                }
+                if (remarks && cold[k]) {
+                    fprintf(stderr, "Remark: method %s is never called%s, it goes to the cold section\n", names[k],
+                            profiled ? " in the profile" : "");
+                }
+            }
+        }
+    }
+    memcpy(code, ordered, position * sizeof(Instr));
+    if (remarks) {
+        fprintf(stderr, "Remark: methods laid out as");
+        for (int i = 0; i < position; i++) {
+            if (code[i].instruct->instruct.type_instruct == I_ENTER) fprintf(stderr, " %s", code[i].var1->id.name);
+        }
+        fprintf(stderr, "\n");
+    }
+    free(placed);
+    free(names);
+    free(enters);
+    free(weights);
+    free(chain);
+    free(next);
+    free(chain_weight);
+    free(cold);
+    free(edges);
+    free(ordered);
+}
+
+/* Function that checks if order_methods placed the method name in the cold section
+ */
+int is_cold_method(const char* name) {
+    for (int m = 0; m < num_cold_methods; m++) {
+        if (strcmp(cold_methods[m], name) == 0) return 1;
+    }
+    return 0;
+}
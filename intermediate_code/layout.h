@@ -0,0 +1,23 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include "intermediate_code.h"
+
+// Weight of a call for each loop that contains it, when the weights come from the code
+#define LOOP_CALL_WEIGHT 10
+// Deepest loop nesting that makes a call weigh more
+#define MAX_WEIGHTED_DEPTH 6
+
+/* Function that orders the methods of the program by call-graph affinity, so callers and callees that call each
+ * other often end up next to each other in the text section (Pettis-Hansen: the chains of methods joined by the
+ * heaviest calls are merged first, and the chains are placed from the heaviest). A call weighs LOOP_CALL_WEIGHT for
+ * each loop around it, unless profile names a file with lines "caller callee count", which give the weights instead.
+ * Methods that are never called (by the code, or in the profile) are marked as cold and placed at the end
+ */
+void order_methods(const char* profile);
+
+/* Function that checks if order_methods placed the method name in the cold section
+ */
+int is_cold_method(const char* name);
+
+#endif
@@ -0,0 +1,942 @@
+#include "loops.h"
+#include "ssa.h"
+
+// Most instructions of a loop header that are copied to the bottom of the loop when it is rotated
+#define MAX_ROTATED_HEADER 8
+// Most instructions of the body of an unrolled loop, counting every copy
+#define MAX_UNROLLED_SIZE 96
+// Most iterations of a loop with a constant trip count that is replaced by copies of its body
+#define MAX_FULL_UNROLL_TRIPS 16
+// Most instructions that unrolling can add to a method
+#define UNROLL_GROWTH_BUDGET 256
+// Instructions added around the copies of an unrolled loop (limit, tests and labels)
+#define UNROLL_EXTRA_INSTRS 8
+// Most instructions of a loop that is copied to unswitch it
+#define MAX_UNSWITCHED_SIZE 64
+// Most instructions that unswitching can add to a method
+#define UNSWITCH_GROWTH_BUDGET 192
+
+extern int unroll_factor;
+
+// State of the search of invariants of one loop
+typedef struct HOIST {
+    CFG* cfg;
+    LOOP* loop;
+    int* instrs; // Indices of the instructions of the loop, in code order
+    int num_instrs;
+    char* hoisted; // 1 for the instructions (same order as instrs) that will be moved to the preheader
+    int* order; // Positions in instrs of the hoisted instructions, in the order they must run
+    int num_hoisted;
+    int has_calls; // Calls in the loop could change globals
+} HOIST;
+
+/* Orders loops from the smallest to the biggest
+ */
+static int compare_loops(const void* a, const void* b) {
+    return ((const LOOP*)a)->num_blocks - ((const LOOP*)b)->num_blocks;
+}
+
+/* Function that finds the natural loops of a method: a jump to a block that dominates its source (back edge)
+ * closes a loop. Loops with the same header are merged. They are sorted from the smallest (innermost) to the
+ * biggest, saving how many there are in count
+ */
+LOOP* find_loops(CFG* cfg, int* idom, int* count) {
+    LOOP* loops = NULL;
+    int* worklist = malloc((cfg->num_blocks + 1) * sizeof(int));
+    if (!worklist) error_allocate_mem();
+    *count = 0;
+    for (int h = 0; h < cfg->num_blocks; h++) {
+        int current = -1;
+        for (int p = 0; p < cfg->blocks[h].num_preds; p++) {
+            int latch = cfg->blocks[h].preds[p];
+            if (!dominates(idom, h, latch)) continue;
+            if (current < 0) {
+                loops = realloc(loops, (*count + 1) * sizeof(LOOP));
+                if (!loops) error_allocate_mem();
+                current = (*count)++;
+                loops[current].header = h;
+                loops[current].blocks = calloc(cfg->num_blocks + 1, 1);
+                if (!loops[current].blocks) error_allocate_mem();
+                loops[current].blocks[h] = 1;
+                loops[current].num_blocks = 1;
+            }
+            // Blocks that reach the latch going backwards without passing through the header
+            LOOP* loop = &loops[current];
+            int pending = 0;
+            if (!loop->blocks[latch]) {
+                loop->blocks[latch] = 1;
+                loop->num_blocks++;
+                worklist[pending++] = latch;
+            }
+            while (pending > 0) {
+                BASIC_BLOCK* block = &cfg->blocks[worklist[--pending]];
+                for (int q = 0; q < block->num_preds; q++) {
+                    int pred = block->preds[q];
+                    if (!loop->blocks[pred] && idom[pred] >= 0) {
+                        loop->blocks[pred] = 1;
+                        loop->num_blocks++;
+                        worklist[pending++] = pred;
+                    }
+                }
+            }
+        }
+    }
+    free(worklist);
+    if (*count > 1) qsort(loops, *count, sizeof(LOOP), compare_loops);
+    return loops;
+}
+
+/* Function that frees the loops found by find_loops
+ */
+void free_loops(LOOP* loops, int count) {
+    for (int l = 0; l < count; l++) {
+        free(loops[l].blocks);
+    }
+    free(loops);
+}
+
+/* Checks if an instruction only computes its destination and can't trap, so it can run even in iterations
+ * (or loops) where it wouldn't
+ */
+static int is_movable(Instr* instr) {
+    switch (instr->instruct->instruct.type_instruct) {
+        case I_LOADVAL: case I_STORE: case I_ADD: case I_SUB: case I_MUL: case I_MIN: case I_NEG:
+        case I_AND: case I_OR: case I_SHIFT_RIGHT:
+        case I_LES: case I_GRT: case I_EQ: case I_NEQ: case I_LEQ: case I_GEQ:
+            return 1;
+        case I_DIV: case I_MOD: {
+            // Only divisions by constants that can't fault
+            if (!is_constant(instr->var2->id.name)) return 0;
+            long divisor = strtol(instr->var2->id.name, NULL, 10);
+            return divisor != 0 && divisor != -1;
+        }
+        default:
+            return 0;
+    }
+}
+
+/* Checks if name is written by an instruction of the loop that stays in it
+ */
+static int defined_in_loop(HOIST* h, const char* name) {
+    Instr* code = get_intermediate_code();
+    for (int k = 0; k < h->num_instrs; k++) {
+        INFO* dest = h->hoisted[k] ? NULL : get_dest(&code[h->instrs[k]]);
+        if (dest && strcmp(dest->id.name, name) == 0) return 1;
+    }
+    return 0;
+}
+
+/* Checks if the operand name has the same value in every iteration of the loop
+ */
+static int is_invariant(HOIST* h, const char* name) {
+    if (is_constant(name)) return 1;
+    return !defined_in_loop(h, name) && !(h->has_calls && is_global(name));
+}
+
+/* Checks if the destination of an instruction is a value written only by it, so it can be computed earlier
+ */
+static int has_single_definition(HOIST* h, INFO* dest) {
+    Instr* code = get_intermediate_code();
+    if (!dest || !is_ssa_value(dest->id.name) || is_global(dest->id.name)) return 0;
+    int definitions = 0;
+    for (int i = h->cfg->enter + 1; i < h->cfg->leave; i++) {
+        INFO* other = get_dest(&code[i]);
+        if (other && strcmp(other->id.name, dest->id.name) == 0) definitions++;
+    }
+    return definitions == 1;
+}
+
+/* Checks if the instruction at position k of the loop can be moved to the preheader
+ */
+static int can_hoist(HOIST* h, int k) {
+    Instr* instr = &get_intermediate_code()[h->instrs[k]];
+    if (!is_movable(instr) || !has_single_definition(h, get_dest(instr))) return 0;
+    INFO* uses[2];
+    int num_uses = get_uses(instr, uses);
+    for (int u = 0; u < num_uses; u++) {
+        if (!is_invariant(h, uses[u]->id.name)) return 0;
+    }
+    return 1;
+}
+
+/* Returns how many arguments the method name takes (-1 if it's not declared)
+ */
+static int method_num_args(const char* name) {
+    for (AST_ROOT* cur = head_ast; cur; cur = cur->next) {
+        INFO* info = cur->sentence->info;
+        if (info->type == AST_METHOD_DECL && strcmp(info->method_decl.name, name) == 0) {
+            return info->method_decl.num_args;
+        }
+    }
+    return -1;
+}
+
+/* Checks if the call at position k of the loop (and its parameters) can be moved to the preheader: the method is
+ * pure, the arguments are invariant and the call runs in the header before anything with side effects, so it
+ * would run at least once whenever the loop is reached. Saves the number of parameters in num_params
+ */
+static int can_hoist_call(HOIST* h, int k, int* num_params) {
+    Instr* code = get_intermediate_code();
+    BASIC_BLOCK* header = &h->cfg->blocks[h->loop->header];
+    int index = h->instrs[k];
+    if (index < header->start || index > header->end || !has_single_definition(h, get_dest(&code[index])) ||
+        !is_pure_method(code[index].var1->id.name)) {
+        return 0;
+    }
+    int params = method_num_args(code[index].var1->id.name);
+    if (params < 0 || index - params <= header->start) return 0;
+    for (int p = 1; p <= params; p++) {
+        if (code[index - p].instruct->instruct.type_instruct != I_PARAM ||
+            !is_invariant(h, code[index - p].var1->id.name)) {
+            return 0;
+        }
+    }
+    for (int j = header->start + 1; j < index - params; j++) {
+        if (!h->hoisted[k - (index - j)] && !is_movable(&code[j])) return 0;
+    }
+    *num_params = params;
+    return 1;
+}
+
+/* Marks the instruction at position k of the loop as hoisted
+ */
+static void mark_hoisted(HOIST* h, int k) {
+    h->hoisted[k] = 1;
+    h->order[h->num_hoisted++] = k;
+}
+
+/* Returns the index of the instruction whose type info is instruct (they are unique for every instruction)
+ */
+static int find_instr(INFO* instruct) {
+    Instr* code = get_intermediate_code();
+    for (int i = 0; i < get_code_size(); i++) {
+        if (code[i].instruct == instruct) return i;
+    }
+    return -1;
+}
+
+/* Moves the hoisted instructions to a new preheader before the loop header. Jumps that enter the loop from
+ * outside go to the preheader. Temporals moved out of the loop are renamed as values because they are live
+ * across iterations, where the reuse of temporals can't take them
+ */
+static void move_to_preheader(HOIST* h) {
+    Instr* code = get_intermediate_code();
+    BASIC_BLOCK* header = &h->cfg->blocks[h->loop->header];
+    INFO preheader_info;
+    preheader_info.type = TABLE_ID;
+    preheader_info.id.name = new_label();
+    char* header_label = code[header->start].var1->id.name;
+
+    for (int p = 0; p < header->num_preds; p++) {
+        int pred = header->preds[p];
+        if (h->loop->blocks[pred]) continue;
+        Instr* last = &code[h->cfg->blocks[pred].end];
+        if (last->instruct->instruct.type_instruct == I_JMP && strcmp(last->var1->id.name, header_label) == 0) {
+            last->var1->id.name = preheader_info.id.name;
+        } else if (is_cond_jump(last->instruct->instruct.type_instruct) && strcmp(last->reg->id.name, header_label) == 0) {
+            last->reg->id.name = preheader_info.id.name;
+        }
+    }
+
+    INFO** moved = malloc((h->num_hoisted + 1) * sizeof(INFO*));
+    if (!moved) error_allocate_mem();
+    for (int m = 0; m < h->num_hoisted; m++) {
+        moved[m] = code[h->instrs[h->order[m]]].instruct;
+    }
+    INFO* header_instr = code[header->start].instruct;
+    int enter = h->cfg->enter;
+    insert_instr(header->start, I_LABEL, &preheader_info, NULL, NULL);
+    for (int m = 0; m < h->num_hoisted; m++) {
+        int from = find_instr(moved[m]);
+        int to = find_instr(header_instr);
+        move_instr(from, from < to ? to - 1 : to);
+    }
+
+    int leave = find_method_end(enter);
+    for (int m = 0; m < h->num_hoisted; m++) {
+        INFO* dest = get_dest(&code[find_instr(moved[m])]);
+        if (!dest || !is_temp(dest->id.name)) continue;
+        char* old_name = dest->id.name;
+        char* new_name = malloc(strlen(old_name) + 3);
+        if (!new_name) error_allocate_mem();
+        sprintf(new_name, "%s.0", old_name + 1);
+        for (int i = enter + 1; i < leave; i++) {
+            INFO* operands[3];
+            int num_operands = get_uses(&code[i], operands);
+            INFO* other = get_dest(&code[i]);
+            if (other) operands[num_operands++] = other;
+            for (int o = 0; o < num_operands; o++) {
+                if (strcmp(operands[o]->id.name, old_name) == 0) operands[o]->id.name = new_name;
+            }
+        }
+    }
+    free(moved);
+}
+
+/* Hoists the invariants of a loop, returns 1 if any instruction was moved
+ */
+static int hoist_loop(CFG* cfg, LOOP* loop) {
+    Instr* code = get_intermediate_code();
+    BASIC_BLOCK* header = &cfg->blocks[loop->header];
+    if (code[header->start].instruct->instruct.type_instruct != I_LABEL) return 0;
+    for (int p = 0; p < header->num_preds; p++) {
+        // A back edge that falls into the header would also run the preheader
+        if (loop->blocks[header->preds[p]] && cfg->blocks[header->preds[p]].succ[0] == loop->header) return 0;
+    }
+
+    HOIST h = {0};
+    h.cfg = cfg;
+    h.loop = loop;
+    h.instrs = malloc((cfg->leave - cfg->enter + 1) * sizeof(int));
+    h.hoisted = calloc(cfg->leave - cfg->enter + 1, 1);
+    h.order = malloc((cfg->leave - cfg->enter + 1) * sizeof(int));
+    if (!h.instrs || !h.hoisted || !h.order) error_allocate_mem();
+    for (int b = 0; b < cfg->num_blocks; b++) {
+        if (!loop->blocks[b]) continue;
+        for (int i = cfg->blocks[b].start; i <= cfg->blocks[b].end; i++) {
+            h.instrs[h.num_instrs++] = i;
+            if (code[i].instruct->instruct.type_instruct == I_CALL) h.has_calls = 1;
+        }
+    }
+
+    // An instruction becomes invariant once the ones that compute its operands are hoisted
+    int found = 1;
+    while (found) {
+        found = 0;
+        for (int k = 0; k < h.num_instrs; k++) {
+            if (h.hoisted[k]) continue;
+            INSTR_TYPE type = code[h.instrs[k]].instruct->instruct.type_instruct;
+            int params;
+            if (type == I_CALL && can_hoist_call(&h, k, &params)) {
+                for (int p = params; p >= 0; p--) mark_hoisted(&h, k - p);
+                found = 1;
+            } else if (type != I_CALL && type != I_PARAM && can_hoist(&h, k)) {
+                mark_hoisted(&h, k);
+                found = 1;
+            }
+        }
+    }
+
+    int hoisted = h.num_hoisted > 0;
+    if (hoisted) move_to_preheader(&h);
+    free(h.instrs);
+    free(h.hoisted);
+    free(h.order);
+    return hoisted;
+}
+
+/* Function that moves the computations that give the same value in every iteration of a loop (loop invariants) to a
+ * preheader block that runs once before entering the loop. Only instructions without side effects are moved, and
+ * calls only when the method is pure and is called in the loop condition
+ * Inner loops go first, so invariants can keep moving out through the preheaders of the enclosing loops
+ */
+void hoist_loop_invariants() {
+    Instr* code = get_intermediate_code();
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER) continue;
+        int changed = 1;
+        while (changed) {
+            changed = 0;
+            CFG* cfg = build_cfg(enter);
+            int* idom = compute_dominators(cfg);
+            int count;
+            LOOP* loops = find_loops(cfg, idom, &count);
+            for (int l = 0; l < count && !changed; l++) {
+                changed = hoist_loop(cfg, &loops[l]);
+            }
+            free_loops(loops, count);
+            free(idom);
+            free_cfg(cfg);
+        }
+    }
+}
+
+/* Checks if the temporals written in the block are only read inside it, so copying the block keeps every use
+ * next to its definition
+ */
+static int temps_stay_in_block(CFG* cfg, BASIC_BLOCK* block) {
+    Instr* code = get_intermediate_code();
+    for (int i = block->start; i <= block->end; i++) {
+        INFO* dest = get_dest(&code[i]);
+        if (!dest || !is_temp(dest->id.name)) continue;
+        for (int j = cfg->enter + 1; j < cfg->leave; j++) {
+            if (j >= block->start && j <= block->end) continue;
+            INFO* uses[2];
+            int num_uses = get_uses(&code[j], uses);
+            for (int u = 0; u < num_uses; u++) {
+                if (strcmp(uses[u]->id.name, dest->id.name) == 0) return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* Makes the label of the block at index start be jumped to, adding one if the block doesn't start with a label.
+ * Returns the name of the label
+ */
+static char* block_label(int start) {
+    Instr* code = get_intermediate_code();
+    if (code[start].instruct->instruct.type_instruct == I_LABEL) return code[start].var1->id.name;
+    INFO label_info;
+    label_info.type = TABLE_ID;
+    label_info.id.name = new_label();
+    insert_instr(start, I_LABEL, &label_info, NULL, NULL);
+    return label_info.id.name;
+}
+
+/* Rotates a loop whose header is a single block that tests the condition and leaves the loop:
+ *     L_h: test, exit if false; body; JMP L_h
+ * becomes
+ *     test, exit if false; L_b: body; L_t: test, back to L_b if true
+ * The original header is kept as the guard of the first iteration. Every latch goes to the test at the bottom, the
+ * last one (in code order) falls into it. Returns 1 if the loop was rotated
+ */
+static int rotate_loop(CFG* cfg, LOOP* loop) {
+    Instr* code = get_intermediate_code();
+    BASIC_BLOCK* header = &cfg->blocks[loop->header];
+    Instr* test = &code[header->end];
+    int length = header->end - header->start;
+    if (code[header->start].instruct->instruct.type_instruct != I_LABEL ||
+        !is_cond_jump(test->instruct->instruct.type_instruct) || length > MAX_ROTATED_HEADER ||
+        header->succ[0] < 0 || header->succ[1] < 0 || !loop->blocks[header->succ[0]] || loop->blocks[header->succ[1]] ||
+        get_code_size() + length + 3 >= MAX_CODE_SIZE || !temps_stay_in_block(cfg, header)) {
+        return 0;
+    }
+
+    // Every latch jumps to the header, the last one becomes the bottom of the loop
+    int last_latch = -1;
+    for (int p = 0; p < header->num_preds; p++) {
+        int pred = header->preds[p];
+        if (!loop->blocks[pred]) continue;
+        Instr* jump = &code[cfg->blocks[pred].end];
+        if (jump->instruct->instruct.type_instruct != I_JMP && !is_cond_jump(jump->instruct->instruct.type_instruct)) {
+            return 0;
+        }
+        if (cfg->blocks[pred].succ[0] == loop->header || pred < loop->header) return 0;
+        if (pred > last_latch) last_latch = pred;
+    }
+    BASIC_BLOCK* bottom = &cfg->blocks[last_latch];
+    if (code[bottom->end].instruct->instruct.type_instruct != I_JMP) return 0;
+
+    char* header_label = code[header->start].var1->id.name;
+    int exit_is_next = last_latch + 1 == header->succ[1];
+    int header_start = header->start;
+    int header_end = header->end;
+    int position = bottom->end;
+    INFO test_label_info, body_label_info, exit_label_info;
+    test_label_info.type = TABLE_ID;
+    test_label_info.id.name = new_label();
+    exit_label_info.type = TABLE_ID;
+    exit_label_info.id.name = test->reg->id.name;
+
+    // The other latches jump to the test at the bottom
+    for (int p = 0; p < header->num_preds; p++) {
+        int pred = header->preds[p];
+        if (!loop->blocks[pred] || pred == last_latch) continue;
+        Instr* jump = &code[cfg->blocks[pred].end];
+        INFO* target = jump->instruct->instruct.type_instruct == I_JMP ? jump->var1 : jump->reg;
+        if (strcmp(target->id.name, header_label) == 0) target->id.name = test_label_info.id.name;
+    }
+
+    // The body was only entered by falling from the header, the test at the bottom needs a label to jump to it
+    body_label_info.type = TABLE_ID;
+    if (code[header_end + 1].instruct->instruct.type_instruct != I_LABEL) position++;
+    body_label_info.id.name = block_label(header_end + 1);
+
+    // The jump back becomes a copy of the header with the condition reversed
+    remove_instr(position);
+    if (!exit_is_next) insert_instr(position, I_JMP, &exit_label_info, NULL, NULL);
+    Instr* header_test = &code[header_end];
+    insert_instr(position, negate_cond_jump(header_test->instruct->instruct.type_instruct), header_test->var1,
+                 header_test->var2, &body_label_info);
+    for (int i = header_end - 1; i > header_start; i--) {
+        insert_instr(position, code[i].instruct->instruct.type_instruct, code[i].var1, code[i].var2, code[i].reg);
+    }
+    insert_instr(position, I_LABEL, &test_label_info, NULL, NULL);
+    return 1;
+}
+
+/* Function that rotates the loops that test their condition at the top and jump back unconditionally, so every
+ * iteration runs a single conditional jump at the bottom. A copy of the test guards the entry to the loop
+ */
+void rotate_loops() {
+    Instr* code = get_intermediate_code();
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER) continue;
+        int changed = 1;
+        while (changed) {
+            changed = 0;
+            CFG* cfg = build_cfg(enter);
+            int* idom = compute_dominators(cfg);
+            int count;
+            LOOP* loops = find_loops(cfg, idom, &count);
+            for (int l = 0; l < count && !changed; l++) {
+                changed = rotate_loop(cfg, &loops[l]);
+            }
+            free_loops(loops, count);
+            free(idom);
+            free_cfg(cfg);
+        }
+    }
+}
+
+/* Checks if name is an operand of an instruction in [from, to]
+ */
+static int name_in_range(const char* name, int from, int to) {
+    Instr* code = get_intermediate_code();
+    for (int i = from; i <= to; i++) {
+        INFO* operands[3] = {code[i].var1, code[i].var2, code[i].reg};
+        for (int o = 0; o < 3; o++) {
+            if (operands[o] && strcmp(operands[o]->id.name, name) == 0) return 1;
+        }
+    }
+    return 0;
+}
+
+/* Checks if the temporals that appear in [from, to] don't appear anywhere else in the method, so a copy of the
+ * range can give them new names
+ */
+static int temps_only_in_range(CFG* cfg, int from, int to) {
+    Instr* code = get_intermediate_code();
+    for (int i = cfg->enter + 1; i < cfg->leave; i++) {
+        if (i >= from && i <= to) continue;
+        INFO* operands[3];
+        int num_operands = get_uses(&code[i], operands);
+        INFO* dest = get_dest(&code[i]);
+        if (dest) operands[num_operands++] = dest;
+        for (int o = 0; o < num_operands; o++) {
+            if (is_temp(operands[o]->id.name) && name_in_range(operands[o]->id.name, from, to)) return 0;
+        }
+    }
+    return 1;
+}
+
+/* Checks if the instruction adds a constant to the induction variable name, saving the constant in step
+ */
+static int is_induction_step(Instr* instr, const char* name, long* step) {
+    INSTR_TYPE type = instr->instruct->instruct.type_instruct;
+    if ((type != I_ADD && type != I_SUB) || strcmp(instr->reg->id.name, name) != 0) return 0;
+    char* var1 = instr->var1->id.name;
+    char* var2 = instr->var2->id.name;
+    if (strcmp(var1, name) == 0 && is_constant(var2)) {
+        *step = strtol(var2, NULL, 10);
+        if (type == I_SUB) *step = -*step;
+    } else if (type == I_ADD && strcmp(var2, name) == 0 && is_constant(var1)) {
+        *step = strtol(var1, NULL, 10);
+    } else {
+        return 0;
+    }
+    return *step != 0 && labs(*step) <= MAX_LOOP_CONSTANT;
+}
+
+/* Function that checks if the loop is an innermost loop laid out as "L_b: body; Jcond i, n, L_b" (the shape
+ * rotate_loops leaves), where the body adds the same constant to i once per iteration and nothing in it changes n.
+ * Saves the loop in counted
+ */
+int find_counted_loop(CFG* cfg, int* idom, LOOP* loop, LOOP* loops, int count, COUNTED_LOOP* counted) {
+    Instr* code = get_intermediate_code();
+    BASIC_BLOCK* header = &cfg->blocks[loop->header];
+    if (code[header->start].instruct->instruct.type_instruct != I_LABEL || header->num_preds != 2) return 0;
+    for (int l = 0; l < count; l++) {
+        if (&loops[l] != loop && loop->blocks[loops[l].header]) return 0;
+    }
+
+    // One block enters the loop falling into it, the other one is the last block of the loop and jumps back
+    int latch = loop->blocks[header->preds[0]] ? header->preds[0] : header->preds[1];
+    int preheader = latch == header->preds[0] ? header->preds[1] : header->preds[0];
+    if (loop->blocks[preheader] || cfg->blocks[preheader].succ[0] != loop->header ||
+        cfg->blocks[preheader].succ[1] == loop->header || latch < loop->header ||
+        loop->num_blocks != latch - loop->header + 1) {
+        return 0;
+    }
+    Instr* test = &code[cfg->blocks[latch].end];
+    INSTR_TYPE test_type = test->instruct->instruct.type_instruct;
+    if ((test_type != I_JLES && test_type != I_JLEQ && test_type != I_JGRT && test_type != I_JGEQ) ||
+        cfg->blocks[latch].succ[1] != loop->header) {
+        return 0;
+    }
+
+    counted->label = header->start;
+    counted->test = cfg->blocks[latch].end;
+    counted->var = test->var1->id.name;
+    counted->bound = test->var2->id.name;
+    if (is_global(counted->var) || is_temp(counted->var) || is_temp(counted->bound) || is_constant(counted->var)) {
+        return 0;
+    }
+
+    int steps = 0, has_calls = 0;
+    for (int i = counted->label + 1; i < counted->test; i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_CALL) has_calls = 1;
+        if (type == I_JMP || is_cond_jump(type)) {
+            char* target = type == I_JMP ? code[i].var1->id.name : code[i].reg->id.name;
+            if (find_label(target, counted->label + 1, counted->test - 1) < 0) return 0;
+        }
+        INFO* dest = get_dest(&code[i]);
+        if (!dest) continue;
+        if (strcmp(dest->id.name, counted->bound) == 0) return 0;
+        if (strcmp(dest->id.name, counted->var) == 0) {
+            // The step must run in every iteration
+            if (!is_induction_step(&code[i], counted->var, &counted->step) ||
+                !dominates(idom, block_of(cfg, i), latch)) {
+                return 0;
+            }
+            counted->step_index = i;
+            steps++;
+        }
+    }
+    if (steps != 1 || (has_calls && is_global(counted->bound))) return 0;
+    int increasing = test_type == I_JLES || test_type == I_JLEQ;
+    if (increasing != (counted->step > 0)) return 0;
+
+    // Temporals of the body can't be live outside of it, every copy gets its own ones
+    if (!temps_only_in_range(cfg, counted->label + 1, counted->test - 1)) return 0;
+
+    // Constant initial value, assigned just before the loop
+    counted->has_init = 0;
+    for (int i = cfg->blocks[preheader].end; i >= cfg->blocks[preheader].start; i--) {
+        INFO* dest = get_dest(&code[i]);
+        if (!dest || strcmp(dest->id.name, counted->var) != 0) continue;
+        if (code[i].instruct->instruct.type_instruct == I_STORE && is_constant(code[i].var1->id.name)) {
+            counted->init = strtol(code[i].var1->id.name, NULL, 10);
+            counted->has_init = labs(counted->init) <= MAX_LOOP_CONSTANT;
+        }
+        break;
+    }
+    return 1;
+}
+
+/* Returns the new name of name in a copy of a loop body, creating it the first time (labels get a new label and
+ * temporals a new temporal, the rest keep their name)
+ */
+static char* copy_name(char* name, char** old_names, char** new_names, int* num_names) {
+    for (int n = 0; n < *num_names; n++) {
+        if (strcmp(old_names[n], name) == 0) return new_names[n];
+    }
+    if (!is_temp(name)) return name;
+    old_names[*num_names] = name;
+    new_names[*num_names] = new_temp();
+    return new_names[(*num_names)++];
+}
+
+/* Inserts at position a copy of the size instructions saved in body. Labels defined in the body and temporals get
+ * new names, so every copy is independent of the others. Returns the position that follows the copy
+ */
+static int copy_body(Instr* body, int size, int position) {
+    char** old_names = malloc((size * 3 + 1) * sizeof(char*));
+    char** new_names = malloc((size * 3 + 1) * sizeof(char*));
+    if (!old_names || !new_names) error_allocate_mem();
+    int num_names = 0;
+    for (int k = 0; k < size; k++) {
+        if (body[k].instruct->instruct.type_instruct == I_LABEL) {
+            old_names[num_names] = body[k].var1->id.name;
+            new_names[num_names++] = new_label();
+        }
+    }
+    for (int k = 0; k < size; k++) {
+        INFO* operands[3] = {body[k].var1, body[k].var2, body[k].reg};
+        INFO copies[3];
+        for (int o = 0; o < 3; o++) {
+            if (!operands[o]) continue;
+            copies[o] = *operands[o];
+            copies[o].id.name = copy_name(operands[o]->id.name, old_names, new_names, &num_names);
+        }
+        insert_instr(position++, body[k].instruct->instruct.type_instruct, operands[0] ? &copies[0] : NULL,
+                     operands[1] ? &copies[1] : NULL, operands[2] ? &copies[2] : NULL);
+    }
+    free(old_names);
+    free(new_names);
+    return position;
+}
+
+/* Returns how many times the body of a counted loop with a constant bound and initial value runs (at least once,
+ * the test is at the bottom)
+ */
+static long trip_count(COUNTED_LOOP* counted) {
+    long bound = strtol(counted->bound, NULL, 10);
+    long distance = counted->step > 0 ? bound - counted->init : counted->init - bound;
+    long step = labs(counted->step);
+    INSTR_TYPE type = get_intermediate_code()[counted->test].instruct->instruct.type_instruct;
+    long trips = type == I_JLEQ || type == I_JGEQ ? distance / step + 1 : (distance + step - 1) / step;
+    return trips < 1 ? 1 : trips;
+}
+
+/* Replaces a counted loop that runs trips times with trips copies of its body
+ */
+static void unroll_fully(COUNTED_LOOP* counted, Instr* body, int size, long trips) {
+    int position = counted->label + 1;
+    for (long t = 1; t < trips; t++) {
+        position = copy_body(body, size, position);
+    }
+    remove_instr(counted->test + (int)(trips - 1) * size);
+}
+
+/* Unrolls a counted loop by factor. A new loop runs factor copies of the body while at least factor iterations are
+ * left (i < n - (factor - 1) * step), the original loop runs the remaining ones:
+ *         Jcond' i, m, L_b          (m = n - (factor - 1) * step)
+ *     L_u: body; ...; body
+ *         Jcond i, m, L_u
+ *         JMP L_c
+ *     L_b: body
+ *     L_c: Jcond i, n, L_b
+ * When n is not a constant the subtraction could overflow, then only the original loop runs
+ */
+static void unroll_partially(COUNTED_LOOP* counted, Instr* body, int size, int factor) {
+    Instr* code = get_intermediate_code();
+    INSTR_TYPE test_type = code[counted->test].instruct->instruct.type_instruct;
+    INFO var_info = *code[counted->test].var1;
+    INFO bound_info = *code[counted->test].var2;
+    INFO body_label_info = *code[counted->label].var1;
+    INFO test_label_info, loop_label_info, limit_info, offset_info;
+    test_label_info.type = TABLE_ID;
+    loop_label_info.type = TABLE_ID;
+    loop_label_info.id.name = new_label();
+    limit_info.type = TABLE_ID;
+    offset_info.type = TABLE_ID;
+    char buffer[32];
+
+    if (code[counted->test - 1].instruct->instruct.type_instruct == I_LABEL) {
+        test_label_info.id.name = code[counted->test - 1].var1->id.name;
+    } else {
+        test_label_info.id.name = new_label();
+        insert_instr(counted->test, I_LABEL, &test_label_info, NULL, NULL);
+    }
+
+    int position = counted->label;
+    long offset = (factor - 1) * counted->step;
+    if (is_constant(counted->bound)) {
+        sprintf(buffer, "%ld", strtol(counted->bound, NULL, 10) - offset);
+        limit_info.id.name = my_strdup(buffer);
+    } else {
+        // The limit is live through the whole loop, so it can't be a temporal
+        char* temp = new_temp();
+        limit_info.id.name = malloc(strlen(temp) + 3);
+        if (!limit_info.id.name) error_allocate_mem();
+        sprintf(limit_info.id.name, "%s.0", temp + 1);
+        sprintf(buffer, "%ld", offset);
+        offset_info.id.name = my_strdup(buffer);
+        insert_instr(position++, I_SUB, &bound_info, &offset_info, &limit_info);
+        insert_instr(position++, counted->step > 0 ? I_JGRT : I_JLES, &limit_info, &bound_info, &body_label_info);
+    }
+    insert_instr(position++, negate_cond_jump(test_type), &var_info, &limit_info, &body_label_info);
+    insert_instr(position++, I_LABEL, &loop_label_info, NULL, NULL);
+    for (int f = 0; f < factor; f++) {
+        position = copy_body(body, size, position);
+    }
+    insert_instr(position++, test_type, &var_info, &limit_info, &loop_label_info);
+    insert_instr(position++, I_JMP, &test_label_info, NULL, NULL);
+}
+
+/* Unrolls the first counted loop of the method found in the CFG that is not in done. Fully when the trip count is
+ * a small constant, else by unroll_factor (less if the body is big). budget is how many instructions can still be
+ * added to the method. Returns 1 if a loop was unrolled
+ */
+static int unroll_loop(CFG* cfg, int* idom, LOOP* loops, int count, char** done, int* num_done, int* budget) {
+    Instr* code = get_intermediate_code();
+    for (int l = 0; l < count; l++) {
+        COUNTED_LOOP counted;
+        if (!find_counted_loop(cfg, idom, &loops[l], loops, count, &counted)) continue;
+        int is_done = 0;
+        for (int d = 0; d < *num_done; d++) {
+            if (strcmp(done[d], code[counted.label].var1->id.name) == 0) is_done = 1;
+        }
+        if (is_done) continue;
+
+        int size = counted.test - counted.label - 1;
+        int room = MAX_CODE_SIZE - get_code_size() - UNROLL_EXTRA_INSTRS;
+        if (*budget < room) room = *budget;
+        int safe_bound = !is_constant(counted.bound) || labs(strtol(counted.bound, NULL, 10)) <= MAX_LOOP_CONSTANT;
+        long trips = counted.has_init && is_constant(counted.bound) && safe_bound ? trip_count(&counted) : -1;
+        Instr* body = malloc((size + 1) * sizeof(Instr));
+        if (!body) error_allocate_mem();
+        memcpy(body, &code[counted.label + 1], size * sizeof(Instr));
+
+        int unrolled = 0;
+        if (trips > 0 && trips <= MAX_FULL_UNROLL_TRIPS && trips * size <= MAX_UNROLLED_SIZE &&
+            (trips - 1) * size <= room) {
+            unroll_fully(&counted, body, size, trips);
+            *budget -= (trips - 1) * size;
+            unrolled = 1;
+        } else {
+            int factor = unroll_factor;
+            while (factor > 1 && (factor * size > MAX_UNROLLED_SIZE || factor * size > room)) factor--;
+            if (factor > 1 && safe_bound && (trips < 0 || trips >= 2 * factor)) {
+                done[(*num_done)++] = code[counted.label].var1->id.name;
+                unroll_partially(&counted, body, size, factor);
+                *budget -= factor * size + UNROLL_EXTRA_INSTRS;
+                unrolled = 1;
+            }
+        }
+        free(body);
+        if (unrolled) return 1;
+    }
+    return 0;
+}
+
+/* Function that unrolls the innermost counted loops ("while (i < n)" with a single i = i + c in every iteration):
+ * loops with a small constant trip count are replaced by copies of their body, the rest run unroll_factor copies of
+ * the body per iteration followed by the original loop for the remaining iterations. Loops must be rotated first
+ */
+void unroll_loops() {
+    if (unroll_factor < 2) return;
+    Instr* code = get_intermediate_code();
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER) continue;
+        int budget = UNROLL_GROWTH_BUDGET;
+        char* done[MAX_CODE_SIZE];
+        int num_done = 0;
+        int changed = 1;
+        while (changed && num_done < MAX_CODE_SIZE) {
+            CFG* cfg = build_cfg(enter);
+            int* idom = compute_dominators(cfg);
+            int count;
+            LOOP* loops = find_loops(cfg, idom, &count);
+            changed = unroll_loop(cfg, idom, loops, count, done, &num_done, &budget);
+            free_loops(loops, count);
+            free(idom);
+            free_cfg(cfg);
+        }
+    }
+}
+
+/* Returns the index of a conditional jump of the loop in [from, to] whose operands have the same value in every
+ * iteration (-1 if there is none)
+ */
+static int find_invariant_branch(int from, int to) {
+    Instr* code = get_intermediate_code();
+    int has_calls = 0;
+    for (int i = from; i <= to; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_CALL) has_calls = 1;
+    }
+    for (int i = from; i <= to; i++) {
+        if (!is_cond_jump(code[i].instruct->instruct.type_instruct)) continue;
+        INFO* uses[2];
+        int num_uses = get_uses(&code[i], uses);
+        int invariant = 1;
+        for (int u = 0; u < num_uses && invariant; u++) {
+            char* name = uses[u]->id.name;
+            if (is_constant(name)) continue;
+            if (is_temp(name) || (has_calls && is_global(name))) invariant = 0;
+            for (int j = from; j <= to && invariant; j++) {
+                INFO* dest = get_dest(&code[j]);
+                if (dest && strcmp(dest->id.name, name) == 0) invariant = 0;
+            }
+        }
+        if (invariant) return i;
+    }
+    return -1;
+}
+
+/* Unswitches a loop laid out as a contiguous range entered by falling into its header that has a branch on an
+ * invariant condition: the condition is tested once before the loop, which runs the original loop without the
+ * branch when it doesn't jump and a copy where the branch always jumps when it does:
+ *         Jcond a, b, L_copy
+ *         guard
+ *     L_h: loop (falls through the branch)
+ *         JMP L_next
+ *     L_copy: copy of the guard and the loop (jumps to the target of the branch)
+ *     L_next:
+ * budget is how many instructions can still be added to the method. Returns 1 if the loop was unswitched
+ */
+static int unswitch_loop(CFG* cfg, LOOP* loop, int* budget) {
+    Instr* code = get_intermediate_code();
+    BASIC_BLOCK* header = &cfg->blocks[loop->header];
+    if (code[header->start].instruct->instruct.type_instruct != I_LABEL) return 0;
+    int last = loop->header;
+    for (int b = 0; b < cfg->num_blocks; b++) {
+        if (!loop->blocks[b]) continue;
+        if (b < loop->header) return 0;
+        last = b;
+    }
+    // Only the header can be entered from outside the range (blocks of the range out of the loop are exits)
+    int entries = 0, entry = -1;
+    for (int b = loop->header; b <= last; b++) {
+        for (int p = 0; p < cfg->blocks[b].num_preds; p++) {
+            int pred = cfg->blocks[b].preds[p];
+            if (pred >= loop->header && pred <= last) continue;
+            if (b != loop->header || cfg->blocks[pred].succ[0] != b || cfg->blocks[pred].succ[1] == b) return 0;
+            entry = pred;
+            entries++;
+        }
+    }
+    if (entries != 1) return 0;
+    // The guard left by rotate_loops is copied too, so both loops are entered falling into them
+    int from = header->start;
+    int guard = cfg->blocks[entry].end;
+    if (guard == from - 1 && is_cond_jump(code[guard].instruct->instruct.type_instruct)) {
+        INFO* uses[2];
+        int num_uses = get_uses(&code[guard], uses);
+        int uses_temps = 0;
+        for (int u = 0; u < num_uses; u++) {
+            if (is_temp(uses[u]->id.name)) uses_temps = 1;
+        }
+        if (!uses_temps) from = guard;
+    }
+    int to = cfg->blocks[last].end;
+    int size = to - from + 1;
+    if (size > MAX_UNSWITCHED_SIZE || size + 4 > *budget || get_code_size() + size + 4 >= MAX_CODE_SIZE ||
+        !temps_only_in_range(cfg, from, to)) {
+        return 0;
+    }
+    int branch = find_invariant_branch(header->start + 1, to);
+    if (branch < 0) return 0;
+
+    Instr* body = malloc(size * sizeof(Instr));
+    if (!body) error_allocate_mem();
+    memcpy(body, &code[from], size * sizeof(Instr));
+    INSTR_TYPE last_type = code[to].instruct->instruct.type_instruct;
+    INFO next_info, copy_info, target_info;
+    next_info.type = TABLE_ID;
+    copy_info.type = TABLE_ID;
+    copy_info.id.name = new_label();
+    target_info.type = TABLE_ID;
+
+    // Copy where the branch always jumps, after the loop
+    int position = to + 1;
+    next_info.id.name = block_label(position);
+    if (last_type != I_JMP && last_type != I_RET) insert_instr(position++, I_JMP, &next_info, NULL, NULL);
+    insert_instr(position++, I_LABEL, &copy_info, NULL, NULL);
+    int copy_start = position;
+    copy_body(body, size, position);
+    int copied_branch = copy_start + branch - from;
+    target_info.id.name = code[copied_branch].reg->id.name;
+    remove_instr(copied_branch);
+    insert_instr(copied_branch, I_JMP, &target_info, NULL, NULL);
+
+    // The test before the loop, the original loop never jumps
+    INFO branch_var1 = *code[branch].var1;
+    INFO branch_var2;
+    if (code[branch].var2) branch_var2 = *code[branch].var2;
+    INSTR_TYPE branch_type = code[branch].instruct->instruct.type_instruct;
+    int has_var2 = code[branch].var2 != NULL;
+    remove_instr(branch);
+    insert_instr(from, branch_type, &branch_var1, has_var2 ? &branch_var2 : NULL, &copy_info);
+    *budget -= size + 4;
+    free(body);
+    return 1;
+}
+
+/* Function that unswitches the loops with a branch on a condition that doesn't change inside them: the condition
+ * is tested once before the loop, which is copied so each copy always takes one side of the branch
+ */
+void unswitch_loops() {
+    Instr* code = get_intermediate_code();
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER) continue;
+        int budget = UNSWITCH_GROWTH_BUDGET;
+        int changed = 1;
+        while (changed) {
+            changed = 0;
+            CFG* cfg = build_cfg(enter);
+            int* idom = compute_dominators(cfg);
+            int count;
+            LOOP* loops = find_loops(cfg, idom, &count);
+            for (int l = 0; l < count && !changed; l++) {
+                changed = unswitch_loop(cfg, &loops[l], &budget);
+            }
+            free_loops(loops, count);
+            free(idom);
+            free_cfg(cfg);
+        }
+    }
+}
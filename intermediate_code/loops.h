@@ -0,0 +1,61 @@
+#ifndef LOOPS_H
+#define LOOPS_H
+
+#include "cfg.h"
+#include "purity.h"
+
+// Natural loop: the header and the blocks that reach one of its back edges without going through the header
+typedef struct LOOP {
+    int header; // Block that dominates every block of the loop
+    char* blocks; // 1 for the blocks of the method that belong to the loop
+    int num_blocks; // Number of blocks of the loop
+} LOOP;
+
+// Biggest constant (in absolute value) used in the arithmetic of counted loops, so it can't overflow
+#define MAX_LOOP_CONSTANT (1L << 30)
+
+// Counted loop laid out as "L_b: body; Jcond i, n, L_b" where every iteration adds step to i
+typedef struct COUNTED_LOOP {
+    int label; // Index of the label of the body
+    int test; // Index of the conditional jump back to the body
+    char* var; // Induction variable (i)
+    char* bound; // Value it is compared with (n), the same in every iteration
+    long step;
+    int step_index; // Index of the instruction that adds step to i
+    int has_init; // 1 if i gets a constant value (init) just before the loop
+    long init;
+} COUNTED_LOOP;
+
+/* Function that finds the natural loops of a method: a jump to a block that dominates its source (back edge)
+ * closes a loop. Loops with the same header are merged. They are sorted from the smallest (innermost) to the
+ * biggest, saving how many there are in count
+ */
+LOOP* find_loops(CFG* cfg, int* idom, int* count);
+/* Function that frees the loops found by find_loops
+ */
+void free_loops(LOOP* loops, int count);
+/* Function that checks if the loop is an innermost loop laid out as "L_b: body; Jcond i, n, L_b" (the shape
+ * rotate_loops leaves), where the body adds the same constant to i once per iteration and nothing in it changes n.
+ * Saves the loop in counted
+ */
+int find_counted_loop(CFG* cfg, int* idom, LOOP* loop, LOOP* loops, int count, COUNTED_LOOP* counted);
+/* Function that moves the computations that give the same value in every iteration of a loop (loop invariants) to a
+ * preheader block that runs once before entering the loop. Only instructions without side effects are moved, and
+ * calls only when the method is pure and is called in the loop condition
+ */
+void hoist_loop_invariants();
+/* Function that rotates the loops that test their condition at the top and jump back unconditionally, so every
+ * iteration runs a single conditional jump at the bottom. A copy of the test guards the entry to the loop
+ */
+void rotate_loops();
+/* Function that unrolls the innermost counted loops ("while (i < n)" with a single i = i + c in every iteration):
+ * loops with a small constant trip count are replaced by copies of their body, the rest run unroll_factor copies of
+ * the body per iteration followed by the original loop for the remaining iterations. Loops must be rotated first
+ */
+void unroll_loops();
+/* Function that unswitches the loops with a branch on a condition that doesn't change inside them: the condition
+ * is tested once before the loop, which is copied so each copy always takes one side of the branch
+ */
+void unswitch_loops();
+
+#endif
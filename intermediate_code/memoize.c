@@ -0,0 +1,152 @@
+#include "memoize.h"
+#include "purity.h"
+
+extern int remarks;
+
+/* Checks if every return of the method that starts at enter returns a value
+ */
+static int returns_value(int enter) {
+    Instr* code = get_intermediate_code();
+    int returns = 0;
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        if (code[i].instruct->instruct.type_instruct != I_RET) continue;
+        if (!code[i].var1) return 0;
+        returns++;
+    }
+    return returns > 0;
+}
+
+/* Adds "EXTERN name" at the start of the code, unless name is already declared
+ */
+static void declare_extern(char* name) {
+    Instr* code = get_intermediate_code();
+    for (int i = 0; i < get_code_size(); i++) {
+        if (code[i].instruct->instruct.type_instruct == I_EXTERN && strcmp(code[i].var1->id.name, name) == 0) return;
+    }
+    INFO name_info;
+    name_info.type = TABLE_ID;
+    name_info.id.name = name;
+    insert_instr(0, I_EXTERN, &name_info, NULL, NULL);
+}
+
+/* Inserts at position the PARAMs of a call to a function of the memo table: the number of the method, its arguments
+ * (0 for the missing ones up to MAX_MEMO_ARGS) and the result when it isn't NULL. Returns the position that follows
+ */
+static int insert_memo_params(int position, char* id, INFO* decl, INFO* result) {
+    INFO param_info;
+    param_info.type = TABLE_ID;
+    param_info.id.name = id;
+    insert_instr(position++, I_PARAM, &param_info, NULL, NULL);
+    ARGS_LIST* arg = decl->method_decl.args;
+    for (int a = 0; a < MAX_MEMO_ARGS; a++) {
+        param_info.id.name = arg ? arg->arg->name : "0";
+        insert_instr(position++, I_PARAM, &param_info, NULL, NULL);
+        if (arg) arg = arg->next;
+    }
+    if (result) insert_instr(position++, I_PARAM, result, NULL, NULL);
+    return position;
+}
+
+/* Moves the body of the method that starts at enter to name.uncached and puts before it the method that checks the
+ * memo table (id is the number of the method in the table):
+ *     ENTER f
+ *     PARAM id; PARAM a1; ...; CALL ctds_memo_find, t
+ *     JEQ t, 0, L_miss
+ *     CALL ctds_memo_value, v
+ *     RET v
+ *     L_miss:
+ *     PARAM a1; ...; CALL f.uncached, r
+ *     PARAM id; PARAM a1; ...; PARAM r; CALL ctds_memo_store, s
+ *     RET s
+ *     LEAVE f
+ * The recursive calls of the body still call f, so they use the table too
+ */
+static void memoize_method(int enter, INFO* decl, int id) {
+    Instr* code = get_intermediate_code();
+    char* name = code[enter].var1->id.name;
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s.uncached", name);
+    char* uncached = my_strdup(buf);
+    add_sentence(new_method_clone_node(decl, uncached, decl->method_decl.args, decl->method_decl.num_args));
+    code[find_leave(enter)].var1->id.name = uncached;
+    code[enter].var1->id.name = uncached;
+
+    snprintf(buf, sizeof(buf), "%d", id);
+    char* id_name = my_strdup(buf);
+    INFO method_info, uncached_info, find_info, value_info, store_info, zero_info, miss_info;
+    INFO found_info, cached_info, result_info, saved_info;
+    INFO* infos[] = {&method_info, &uncached_info, &find_info, &value_info, &store_info, &zero_info, &miss_info,
+                     &found_info, &cached_info, &result_info, &saved_info};
+    for (int k = 0; k < 11; k++) infos[k]->type = TABLE_ID;
+    method_info.id.name = name;
+    uncached_info.id.name = uncached;
+    find_info.id.name = "ctds_memo_find";
+    value_info.id.name = "ctds_memo_value";
+    store_info.id.name = "ctds_memo_store";
+    zero_info.id.name = "0";
+    miss_info.id.name = new_label();
+    found_info.id.name = new_temp();
+    cached_info.id.name = new_temp();
+    result_info.id.name = new_temp();
+    saved_info.id.name = new_temp();
+
+    int position = enter;
+    insert_instr(position++, I_ENTER, &method_info, NULL, NULL);
+    position = insert_memo_params(position, id_name, decl, NULL);
+    insert_instr(position++, I_CALL, &find_info, NULL, &found_info);
+    insert_instr(position++, I_JEQ, &found_info, &zero_info, &miss_info);
+    insert_instr(position++, I_CALL, &value_info, NULL, &cached_info);
+    insert_instr(position++, I_RET, &cached_info, NULL, NULL);
+    insert_instr(position++, I_LABEL, &miss_info, NULL, NULL);
+    INFO param_info;
+    param_info.type = TABLE_ID;
+    for (ARGS_LIST* arg = decl->method_decl.args; arg; arg = arg->next) {
+        param_info.id.name = arg->arg->name;
+        insert_instr(position++, I_PARAM, &param_info, NULL, NULL);
+    }
+    insert_instr(position++, I_CALL, &uncached_info, NULL, &result_info);
+    position = insert_memo_params(position, id_name, decl, &result_info);
+    insert_instr(position++, I_CALL, &store_info, NULL, &saved_info);
+    insert_instr(position++, I_RET, &saved_info, NULL, NULL);
+    insert_instr(position, I_LEAVE, &method_info, NULL, NULL);
+}
+
+/* Function that memoizes the pure recursive methods with at most MAX_MEMO_ARGS arguments: their body moves to the
+ * method name.uncached, and name looks up its arguments in the memo table of the runtime (libraries/ctdsio.c) before
+ * calling it, saving the result for the next calls. The table has a fixed size, a new result replaces the one saved
+ * in its entry
+ */
+void memoize_methods() {
+    Instr* code = get_intermediate_code();
+    // Purity is decided before changing any method, the memoized ones call the runtime
+    char** names = malloc((get_code_size() + 1) * sizeof(char*));
+    if (!names) error_allocate_mem();
+    int count = 0;
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER) continue;
+        char* name = code[enter].var1->id.name;
+        INFO* decl = find_method_decl(name);
+        if (!decl || strcmp(name, "main") == 0 || !returns_value(enter) || !is_recursive_method(name) ||
+            !is_pure_method(name)) {
+            continue;
+        }
+        if (decl->method_decl.num_args == 0 || decl->method_decl.num_args > MAX_MEMO_ARGS) {
+            if (remarks) {
+                fprintf(stderr, "Remark: pure recursive method %s is not memoized, it takes %d arguments (1 to %d "
+                        "are supported)\n", name, decl->method_decl.num_args, MAX_MEMO_ARGS);
+            }
+            continue;
+        }
+        names[count++] = name;
+    }
+    if (count > 0) {
+        declare_extern("ctds_memo_find");
+        declare_extern("ctds_memo_value");
+        declare_extern("ctds_memo_store");
+    }
+    for (int m = 0; m < count; m++) {
+        memoize_method(find_enter(names[m]), find_method_decl(names[m]), m);
+        if (remarks) fprintf(stderr, "Remark: pure recursive method %s is memoized\n", names[m]);
+    }
+    free(names);
+}
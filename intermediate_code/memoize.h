@@ -0,0 +1,16 @@
+#ifndef MEMOIZE_H
+#define MEMOIZE_H
+
+#include "intermediate_code.h"
+
+// Most arguments of a memoized method, the table of the runtime keeps this many of them
+#define MAX_MEMO_ARGS 3
+
+/* Function that memoizes the pure recursive methods with at most MAX_MEMO_ARGS arguments: their body moves to the
+ * method name.uncached, and name looks up its arguments in the memo table of the runtime (libraries/ctdsio.c) before
+ * calling it, saving the result for the next calls. The table has a fixed size, a new result replaces the one saved
+ * in its entry
+ */
+void memoize_methods();
+
+#endif
@@ -89,4 +89,417 @@ void check_optimize(CANT_AP_TEMP* tmp_list, char* name) {
 			actual_temp->locked = 1;
 		}
 	}
-}
\ No newline at end of file
+}
+
+/* Returns the label a jump instruction goes to (NULL if the instruction is not a jump)
+ */
+static char* jump_target(Instr* instr) {
+	INSTR_TYPE type = instr->instruct->instruct.type_instruct;
+	if (type == I_JMP) {
+		return instr->var1->id.name;
+	}
+	if (is_cond_jump(type)) {
+		return instr->reg->id.name;
+	}
+	return NULL;
+}
+
+/* Changes the label a jump instruction goes to
+ */
+static void set_jump_target(Instr* instr, char* label) {
+	if (instr->instruct->instruct.type_instruct == I_JMP) {
+		instr->var1->id.name = label;
+	} else {
+		instr->reg->id.name = label;
+	}
+}
+
+/* Describes the condition of a conditional jump or comparison as "var1 compared with var2 gives one of the results
+ * in the returned mask". JMPF and JMPT compare their operand with 0
+ */
+static int cond_mask(Instr* instr, char** var1, char** var2) {
+	*var1 = instr->var1->id.name;
+	*var2 = instr->var2 ? instr->var2->id.name : "0";
+	return relation_mask(instr->instruct->instruct.type_instruct);
+}
+
+/* Returns the result of comparing two constants as one of the REL_ values
+ */
+static int compare_values(long value1, long value2) {
+	return value1 < value2 ? REL_LES : value1 == value2 ? REL_EQ : REL_GRT;
+}
+
+/* Returns the index of the first instruction that is not a label starting from index
+ */
+static int skip_labels(int index) {
+	Instr* code = get_intermediate_code();
+	while (index < get_code_size() && code[index].instruct->instruct.type_instruct == I_LABEL) {
+		index++;
+	}
+	return index;
+}
+
+/* Checks if the jump at index goes to the instruction that follows it (only labels in the middle)
+ */
+static int jumps_to_next(int index) {
+	Instr* code = get_intermediate_code();
+	char* target = jump_target(&code[index]);
+	for (int i = index + 1; i < get_code_size() && code[i].instruct->instruct.type_instruct == I_LABEL; i++) {
+		if (strcmp(code[i].var1->id.name, target) == 0) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* Returns 1 and saves in value the constant that name holds just before the instruction at index.
+ * Only the basic block of the instruction is inspected, so values coming from other blocks are unknown, and a
+ * global is unknown after a call
+ */
+static int known_value(const char* name, int index, long* value) {
+	Instr* code = get_intermediate_code();
+	if (is_constant(name)) {
+		*value = strtol(name, NULL, 10);
+		return 1;
+	}
+	int global = is_global(name);
+	for (int i = index - 1; i >= 0; i--) {
+		INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+		if (type == I_LABEL || type == I_ENTER || is_terminator(&code[i])) {
+			return 0;
+		}
+		if (type == I_CALL && global) {
+			return 0; // The callee may change it
+		}
+		INFO* dest = get_dest(&code[i]);
+		if (dest && strcmp(dest->id.name, name) == 0) {
+			if ((type == I_LOADVAL || type == I_STORE) && is_constant(code[i].var1->id.name)) {
+				*value = strtol(code[i].var1->id.name, NULL, 10);
+				return 1;
+			}
+			return 0;
+		}
+	}
+	return 0;
+}
+
+/* Returns 1 if the conditional jump dest will jump, 0 if it won't and -1 if it is unknown, when dest is
+ * reached right after the jump src (jumped = 1 when src jumped, 0 when it fell through) with nothing in the middle.
+ * src can be NULL when only the constants known at index are used
+ */
+static int known_outcome(Instr* src, int jumped, Instr* dest, int index) {
+	char *dest_var1, *dest_var2;
+	int dest_mask = cond_mask(dest, &dest_var1, &dest_var2);
+	long value1, value2;
+	if (known_value(dest_var1, index, &value1) && known_value(dest_var2, index, &value2)) {
+		return (compare_values(value1, value2) & dest_mask) != 0;
+	}
+	if (!src || !is_cond_jump(src->instruct->instruct.type_instruct)) {
+		return -1;
+	}
+	char *src_var1, *src_var2;
+	int src_mask = cond_mask(src, &src_var1, &src_var2);
+	if (!jumped) {
+		src_mask = ~src_mask & REL_ALL;
+	}
+	if (strcmp(src_var1, dest_var2) == 0 && strcmp(src_var2, dest_var1) == 0) {
+		// Same operands in the opposite order: mirror the known results
+		src_mask = (src_mask & REL_EQ) | ((src_mask & REL_LES) ? REL_GRT : 0) | ((src_mask & REL_GRT) ? REL_LES : 0);
+	} else if (strcmp(src_var1, dest_var1) != 0 || strcmp(src_var2, dest_var2) != 0) {
+		return -1;
+	}
+	if ((src_mask & dest_mask) == src_mask) return 1;
+	if ((src_mask & dest_mask) == 0) return 0;
+	return -1;
+}
+
+/* Replaces conditional jumps whose result is already known (constant operands, or the same condition tested by
+ * the jump right before) by an unconditional jump when they always jump, or removes them when they never do
+ */
+static int fold_constant_jumps(int enter) {
+	Instr* code = get_intermediate_code();
+	int changed = 0;
+	for (int i = enter + 1; i < find_method_end(enter); i++) {
+		if (!is_cond_jump(code[i].instruct->instruct.type_instruct)) continue;
+		Instr* previous = code[i - 1].instruct->instruct.type_instruct == I_ENTER ? NULL : &code[i - 1];
+		int outcome = known_outcome(previous, 0, &code[i], i);
+		if (outcome == 1) {
+			INFO label = *code[i].reg;
+			remove_instr(i);
+			insert_instr(i, I_JMP, &label, NULL, NULL);
+			changed = 1;
+		} else if (outcome == 0) {
+			remove_instr(i);
+			i--;
+			changed = 1;
+		}
+	}
+	return changed;
+}
+
+/* Makes jumps skip blocks that only jump somewhere else and blocks whose condition is already known
+ * when arriving from the jump. Jumps to a block that only returns are replaced by the return itself
+ */
+static int thread_jumps(int enter) {
+	Instr* code = get_intermediate_code();
+	int changed = 0;
+	for (int i = enter + 1; i < find_method_end(enter); i++) {
+		Instr* jump = &code[i];
+		char* target = jump_target(jump);
+		if (!target) continue;
+		int is_cond = is_cond_jump(jump->instruct->instruct.type_instruct);
+		char* new_target = target;
+		for (int hops = 0; hops < 16; hops++) {
+			int label_idx = find_label(new_target, enter, find_method_end(enter));
+			if (label_idx < 0) break;
+			int next = skip_labels(label_idx);
+			Instr* dest = &code[next];
+			INSTR_TYPE dest_type = dest->instruct->instruct.type_instruct;
+			if (next == i) break;
+			if (dest_type == I_JMP && strcmp(dest->var1->id.name, new_target) != 0) {
+				// Empty block: go directly to its target
+				new_target = dest->var1->id.name;
+				continue;
+			}
+			if (is_cond_jump(dest_type)) {
+				// Condition already known when arriving from this jump (only jumps were followed, so values didn't change)
+				int outcome = known_outcome(is_cond ? jump : NULL, 1, dest, i);
+				if (outcome == 1) {
+					new_target = dest->reg->id.name;
+					continue;
+				}
+				if (outcome == 0) {
+					// The jump of dest is never taken, continue right after it
+					if (code[next + 1].instruct->instruct.type_instruct != I_LABEL) {
+						INFO label;
+						label.type = TABLE_ID;
+						label.id.name = new_label();
+						insert_instr(next + 1, I_LABEL, &label, NULL, NULL);
+						if (next + 1 <= i) i++;
+						jump = &code[i];
+					}
+					new_target = code[next + 1].var1->id.name;
+				}
+				break;
+			}
+			if (dest_type == I_RET && !is_cond && (!dest->var1 || !is_temp(dest->var1->id.name))) {
+				// Duplicate the return instead of jumping to it
+				INFO ret_value;
+				int has_value = dest->var1 != NULL;
+				if (has_value) ret_value = *dest->var1;
+				remove_instr(i);
+				insert_instr(i, I_RET, has_value ? &ret_value : NULL, NULL, NULL);
+				changed = 1;
+				new_target = NULL;
+			}
+			break;
+		}
+		if (new_target && strcmp(new_target, target) != 0) {
+			set_jump_target(jump, new_target);
+			changed = 1;
+		}
+	}
+	return changed;
+}
+
+/* Removes jumps whose target is the instruction that follows them. A conditional jump over an
+ * unconditional one is inverted so only one jump remains
+ */
+static int remove_fallthrough_jumps(int enter) {
+	Instr* code = get_intermediate_code();
+	int changed = 0;
+	for (int i = enter + 1; i < find_method_end(enter); i++) {
+		if (jump_target(&code[i]) && jumps_to_next(i)) {
+			remove_instr(i);
+			i--;
+			changed = 1;
+		} else if (is_cond_jump(code[i].instruct->instruct.type_instruct)
+				&& code[i + 1].instruct->instruct.type_instruct == I_JMP && jumps_to_next(i + 1) == 0) {
+			// JCOND a, b, L1; JMP L2; L1: -> JNOTCOND a, b, L2; L1:
+			char* cond_target = code[i].reg->id.name;
+			int label_idx = skip_labels(i + 2);
+			int over = 0;
+			for (int j = i + 2; j < label_idx; j++) {
+				over |= strcmp(code[j].var1->id.name, cond_target) == 0;
+			}
+			if (over) {
+				code[i].instruct->instruct.type_instruct = negate_cond_jump(code[i].instruct->instruct.type_instruct);
+				code[i].reg->id.name = code[i + 1].var1->id.name;
+				remove_instr(i + 1);
+				changed = 1;
+			}
+		}
+	}
+	return changed;
+}
+
+/* Removes the blocks that can't be reached from the entry of the method
+ */
+static int remove_unreachable_blocks(int enter) {
+	CFG* cfg = build_cfg(enter);
+	int* reachable = calloc(cfg->num_blocks + 1, sizeof(int));
+	int* stack = malloc((cfg->num_blocks + 1) * sizeof(int));
+	int top = 0;
+	int changed = 0;
+	if (cfg->num_blocks > 0) {
+		stack[top++] = 0;
+		reachable[0] = 1;
+	}
+	while (top > 0) {
+		BASIC_BLOCK* block = &cfg->blocks[stack[--top]];
+		for (int s = 0; s < 2; s++) {
+			if (block->succ[s] >= 0 && !reachable[block->succ[s]]) {
+				reachable[block->succ[s]] = 1;
+				stack[top++] = block->succ[s];
+			}
+		}
+	}
+	// Remove from the last block to the first one so indexes of pending blocks don't change
+	for (int b = cfg->num_blocks - 1; b >= 0; b--) {
+		if (!reachable[b]) {
+			for (int i = cfg->blocks[b].end; i >= cfg->blocks[b].start; i--) {
+				remove_instr(i);
+			}
+			changed = 1;
+		}
+	}
+	free(stack);
+	free(reachable);
+	free_cfg(cfg);
+	return changed;
+}
+
+/* Merges a block with its only predecessor when that predecessor reaches it with an unconditional jump, moving the
+ * block right after the jump so it becomes a fallthrough. Only blocks that don't fall into the next one are moved
+ * (they end with a jump or a return, or end the method), so no other fallthrough breaks
+ */
+static int merge_single_pred_blocks(int enter) {
+	Instr* code = get_intermediate_code();
+	CFG* cfg = build_cfg(enter);
+	int changed = 0;
+	for (int b = 1; b < cfg->num_blocks && !changed; b++) {
+		BASIC_BLOCK* block = &cfg->blocks[b];
+		if (block->num_preds != 1) continue;
+		int pred = block->preds[0];
+		BASIC_BLOCK* pred_block = &cfg->blocks[pred];
+		INSTR_TYPE last_type = code[block->end].instruct->instruct.type_instruct;
+		int ends_method = b == cfg->num_blocks - 1 && !is_terminator(&code[block->end]);
+		if (pred == b - 1 || pred == b || (last_type != I_JMP && last_type != I_RET && !ends_method)) continue;
+		if (code[pred_block->end].instruct->instruct.type_instruct != I_JMP) continue;
+		if (cfg->blocks[b - 1].succ[0] == b) continue; // The previous block falls into this one
+
+		int size = block->end - block->start + 1;
+		Instr* moved = malloc(size * sizeof(Instr));
+		memcpy(moved, &code[block->start], size * sizeof(Instr));
+		if (block->start > pred_block->end) {
+			memmove(&code[pred_block->end + 1 + size], &code[pred_block->end + 1], (block->start - pred_block->end - 1) * sizeof(Instr));
+			memcpy(&code[pred_block->end + 1], moved, size * sizeof(Instr));
+		} else {
+			memmove(&code[block->start], &code[block->end + 1], (pred_block->end - block->end) * sizeof(Instr));
+			memcpy(&code[pred_block->end + 1 - size], moved, size * sizeof(Instr));
+		}
+		free(moved);
+		if (ends_method) {
+			// The block used to fall into the end of the method, now it has to return explicitly
+			int new_end = block->start > pred_block->end ? pred_block->end + size : pred_block->end;
+			insert_instr(new_end + 1, I_RET, NULL, NULL, NULL);
+		}
+		changed = 1;
+	}
+	free_cfg(cfg);
+	return changed;
+}
+
+/* Removes the labels of the method that are not the target of any jump
+ */
+static int remove_unused_labels(int enter) {
+	Instr* code = get_intermediate_code();
+	int changed = 0;
+	for (int i = enter + 1; i < find_method_end(enter); i++) {
+		if (code[i].instruct->instruct.type_instruct != I_LABEL) continue;
+		int used = 0;
+		for (int j = enter + 1; j < find_method_end(enter) && !used; j++) {
+			char* target = jump_target(&code[j]);
+			used = target && strcmp(target, code[i].var1->id.name) == 0;
+		}
+		if (!used) {
+			remove_instr(i);
+			i--;
+			changed = 1;
+		}
+	}
+	return changed;
+}
+
+/* Replaces the conditional jumps and comparisons whose result is the same for every value their operands can
+ * hold (found with the value range analysis) by an unconditional jump, nothing, or the constant result
+ */
+static int fold_range_comparisons(int enter) {
+	Instr* code = get_intermediate_code();
+	RANGE_INFO* info = analyze_ranges(enter);
+	int leave = info->cfg->leave;
+	int* outcome = malloc((leave - enter + 1) * sizeof(int));
+	if (!outcome) error_allocate_mem();
+	for (int i = enter; i <= leave; i++) {
+		INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+		outcome[i - enter] = -1;
+		if (!is_cond_jump(type) && (type < I_LES || type > I_GEQ)) continue;
+		char *var1, *var2;
+		int mask = cond_mask(&code[i], &var1, &var2);
+		int possible = possible_relations(range_before(info, i, var1), range_before(info, i, var2));
+		if ((possible & ~mask) == 0) {
+			outcome[i - enter] = 1;
+		} else if ((possible & mask) == 0) {
+			outcome[i - enter] = 0;
+		}
+	}
+	free_ranges(info);
+
+	// From the end to the start so the indexes of the pending instructions don't change
+	int changed = 0;
+	for (int i = leave; i > enter; i--) {
+		if (outcome[i - enter] < 0) continue;
+		if (is_cond_jump(code[i].instruct->instruct.type_instruct)) {
+			INFO label = *code[i].reg;
+			remove_instr(i);
+			if (outcome[i - enter] == 1) {
+				insert_instr(i, I_JMP, &label, NULL, NULL);
+			}
+		} else {
+			INFO value, dest = *code[i].reg;
+			value.type = TABLE_ID;
+			value.id.name = my_strdup(outcome[i - enter] ? "1" : "0");
+			value.id.type = TYPE_BOOL;
+			remove_instr(i);
+			insert_instr(i, I_LOADVAL, &value, NULL, &dest);
+		}
+		changed = 1;
+	}
+	free(outcome);
+	return changed;
+}
+
+/* Function that simplifies the control flow graph of every method: folds jumps with known conditions,
+ * threads jumps through empty blocks, removes jumps to the fallthrough, unreachable blocks and unused
+ * labels, and merges straight-line blocks. Comparisons proved by the value ranges are folded too.
+ * Repeats until nothing changes
+ */
+void simplify_cfg() {
+	Instr* code = get_intermediate_code();
+	for (int i = 0; i < get_code_size(); i++) {
+		if (code[i].instruct->instruct.type_instruct != I_ENTER) continue;
+		int changed = 1;
+		while (changed) {
+			changed = fold_constant_jumps(i);
+			changed |= thread_jumps(i);
+			changed |= remove_fallthrough_jumps(i);
+			changed |= remove_unreachable_blocks(i);
+			changed |= merge_single_pred_blocks(i);
+			changed |= remove_unused_labels(i);
+			if (!changed) {
+				changed = fold_range_comparisons(i);
+			}
+		}
+		i = find_method_end(i);
+	}
+}
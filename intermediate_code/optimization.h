@@ -8,9 +8,16 @@
 #include "symbol.h"
 #include <string.h>
 #include "intermediate_code.h"
+#include "cfg.h"
+#include "range_analysis.h"
 
 /* Functions that optimizes memory by reutilizing temporals
  */
 void optimize_memory(CANT_AP_TEMP* tmp_list);
+/* Function that simplifies the control flow graph of every method (jump threading, removal of
+ * jumps to the fallthrough, unreachable blocks and unused labels, merge of straight-line blocks).
+ * Comparisons whose result is proved by the value range analysis are folded
+ */
+void simplify_cfg();
 
 #endif
\ No newline at end of file
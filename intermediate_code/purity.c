@@ -0,0 +1,90 @@
+#include "purity.h"
+
+/* Returns the position of name in methods (-1 if it's not a method defined in the program)
+ */
+static int method_position(Instr* code, int* methods, int count, const char* name) {
+    for (int m = 0; m < count; m++) {
+        if (strcmp(code[methods[m]].var1->id.name, name) == 0) return m;
+    }
+    return -1;
+}
+
+/* Checks if the method that starts at enter reads or writes a global, or calls a method marked as impure
+ */
+static int has_effects(Instr* code, int enter, int* methods, char* impure, int count) {
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_CALL) {
+            int callee = method_position(code, methods, count, code[i].var1->id.name);
+            if (callee < 0 || impure[callee]) return 1;
+        }
+        INFO* operands[3];
+        int num_operands = get_uses(&code[i], operands);
+        INFO* dest = get_dest(&code[i]);
+        if (dest) operands[num_operands++] = dest;
+        for (int o = 0; o < num_operands; o++) {
+            if (is_global(operands[o]->id.name)) return 1;
+        }
+    }
+    return 0;
+}
+
+/* Function that checks if the method name is pure: it is defined in the program (not extern), doesn't read or
+ * write globals and only calls pure methods, so its result only depends on its arguments and calling it has no
+ * other effect
+ * Every method starts as pure and the ones with effects are discarded until nothing changes, so recursive methods
+ * can be pure
+ */
+int is_pure_method(const char* name) {
+    Instr* code = get_intermediate_code();
+    int* methods = malloc((get_code_size() + 1) * sizeof(int));
+    if (!methods) error_allocate_mem();
+    int count = 0;
+    for (int i = 0; i < get_code_size(); i++) {
+        if (code[i].instruct->instruct.type_instruct == I_ENTER) {
+            methods[count++] = i;
+        }
+    }
+    char* impure = calloc(count + 1, 1);
+    if (!impure) error_allocate_mem();
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int m = 0; m < count; m++) {
+            if (!impure[m] && has_effects(code, methods[m], methods, impure, count)) {
+                impure[m] = 1;
+                changed = 1;
+            }
+        }
+    }
+    int position = method_position(code, methods, count, name);
+    int pure = position >= 0 && !impure[position];
+    free(methods);
+    free(impure);
+    return pure;
+}
+
+/* Checks if the method name can reach a call to target through the methods it calls. visited marks the methods
+ * (by the index of their ENTER) already explored
+ */
+static int reaches_call(const char* name, const char* target, char* visited) {
+    Instr* code = get_intermediate_code();
+    int enter = find_enter(name);
+    if (enter < 0 || visited[enter]) return 0;
+    visited[enter] = 1;
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        if (code[i].instruct->instruct.type_instruct != I_CALL) continue;
+        const char* callee = code[i].var1->id.name;
+        if (strcmp(callee, target) == 0 || reaches_call(callee, target, visited)) return 1;
+    }
+    return 0;
+}
+
+/* Function that checks if the method name calls itself, directly or through other methods of the call graph
+ */
+int is_recursive_method(const char* name) {
+    char* visited = calloc(get_code_size() + 1, 1);
+    if (!visited) error_allocate_mem();
+    int recursive = reaches_call(name, name, visited);
+    free(visited);
+    return recursive;
+}
@@ -0,0 +1,15 @@
+#ifndef PURITY_H
+#define PURITY_H
+
+#include "intermediate_code.h"
+
+/* Function that checks if the method name is pure: it is defined in the program (not extern), doesn't read or
+ * write globals and only calls pure methods, so its result only depends on its arguments and calling it has no
+ * other effect
+ */
+int is_pure_method(const char* name);
+/* Function that checks if the method name calls itself, directly or through other methods of the call graph
+ */
+int is_recursive_method(const char* name);
+
+#endif
@@ -0,0 +1,389 @@
+#include "range_analysis.h"
+
+// Times a block start can change before its ranges are widened to make the analysis finish
+#define WIDEN_AFTER 3
+
+static const RANGE full_range = {LONG_MIN, LONG_MAX};
+
+/* Function that returns the results (REL_ mask) for which a comparison or conditional jump is true.
+ * JMPF and JMPT compare their operand with 0
+ */
+int relation_mask(INSTR_TYPE t) {
+    switch (t) {
+        case I_LES: case I_JLES: return REL_LES;
+        case I_GRT: case I_JGRT: return REL_GRT;
+        case I_EQ: case I_JEQ: case I_JMPF: return REL_EQ;
+        case I_NEQ: case I_JNEQ: case I_JMPT: return REL_LES | REL_GRT;
+        case I_LEQ: case I_JLEQ: return REL_LES | REL_EQ;
+        case I_GEQ: case I_JGEQ: return REL_GRT | REL_EQ;
+        default: return REL_ALL;
+    }
+}
+
+/* Function that returns the results (REL_ mask) that comparing a value of range a with a value of range b can give
+ */
+int possible_relations(RANGE a, RANGE b) {
+    int mask = 0;
+    if (a.low < b.high) mask |= REL_LES;
+    if (a.low <= b.high && b.low <= a.high) mask |= REL_EQ;
+    if (a.high > b.low) mask |= REL_GRT;
+    return mask;
+}
+
+/* Returns the index of name in the names of the method (-1 if it is not there)
+ */
+static int name_index(RANGE_INFO* info, const char* name) {
+    for (int i = 0; i < info->num_names; i++) {
+        if (strcmp(info->names[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+/* Returns the index of the operand in the names of the method, adding it if it's a variable or temporal seen for
+ * the first time. Constants and labels return -1
+ */
+static int add_name(RANGE_INFO* info, INFO* var) {
+    if (!var || !var->id.name || is_constant(var->id.name) || var->id.name[0] == '_') return -1;
+    int index = name_index(info, var->id.name);
+    if (index >= 0) return index;
+    info->names = realloc(info->names, (info->num_names + 1) * sizeof(char*));
+    info->global = realloc(info->global, (info->num_names + 1) * sizeof(int));
+    if (!info->names || !info->global) error_allocate_mem();
+    info->names[info->num_names] = var->id.name;
+    info->global[info->num_names] = is_global(var->id.name);
+    return info->num_names++;
+}
+
+/* Range of an operand of the instruction (constants have a range with only their value)
+ */
+static RANGE operand_range(RANGE* state, INFO* var, int index) {
+    if (index >= 0) return state[index];
+    if (var && is_constant(var->id.name)) {
+        long value = strtol(var->id.name, NULL, 10);
+        RANGE range = {value, value};
+        return range;
+    }
+    return full_range;
+}
+
+/* Arithmetic over ranges. When a bound overflows the result can wrap around, so nothing is known about it
+ */
+static RANGE range_add(RANGE a, RANGE b) {
+    RANGE result;
+    if (__builtin_add_overflow(a.low, b.low, &result.low) || __builtin_add_overflow(a.high, b.high, &result.high)) {
+        return full_range;
+    }
+    return result;
+}
+
+static RANGE range_sub(RANGE a, RANGE b) {
+    RANGE result;
+    if (__builtin_sub_overflow(a.low, b.high, &result.low) || __builtin_sub_overflow(a.high, b.low, &result.high)) {
+        return full_range;
+    }
+    return result;
+}
+
+static RANGE range_mul(RANGE a, RANGE b) {
+    long products[4];
+    if (__builtin_mul_overflow(a.low, b.low, &products[0]) || __builtin_mul_overflow(a.low, b.high, &products[1]) ||
+        __builtin_mul_overflow(a.high, b.low, &products[2]) || __builtin_mul_overflow(a.high, b.high, &products[3])) {
+        return full_range;
+    }
+    RANGE result = {products[0], products[0]};
+    for (int i = 1; i < 4; i++) {
+        if (products[i] < result.low) result.low = products[i];
+        if (products[i] > result.high) result.high = products[i];
+    }
+    return result;
+}
+
+/* Division truncating towards zero. It's monotonic in both operands while the divisor keeps its sign,
+ * so the bounds come from the corners
+ */
+static RANGE range_div(RANGE a, RANGE b) {
+    if (b.low <= 0 && b.high >= 0) return full_range;
+    if (b.high < 0 && a.low == LONG_MIN) return full_range; // LONG_MIN / -1 overflows
+    long quotients[4] = {a.low / b.low, a.low / b.high, a.high / b.low, a.high / b.high};
+    RANGE result = {quotients[0], quotients[0]};
+    for (int i = 1; i < 4; i++) {
+        if (quotients[i] < result.low) result.low = quotients[i];
+        if (quotients[i] > result.high) result.high = quotients[i];
+    }
+    return result;
+}
+
+/* The remainder has the sign of the dividend and is smaller than the divisor in absolute value
+ */
+static RANGE range_mod(RANGE a, RANGE b) {
+    if (b.low == LONG_MIN) return full_range;
+    long max_divisor = b.high > -b.low ? b.high : -b.low;
+    long bound = max_divisor > 0 ? max_divisor - 1 : 0;
+    RANGE result = {-bound, bound};
+    if (a.low >= 0) {
+        result.low = 0;
+        if (a.high < bound) result.high = a.high;
+    } else if (a.high <= 0) {
+        result.high = 0;
+        if (a.low > -bound) result.low = a.low;
+    }
+    return result;
+}
+
+static RANGE range_neg(RANGE a) {
+    if (a.low == LONG_MIN) return full_range;
+    RANGE result = {-a.high, -a.low};
+    return result;
+}
+
+/* Updates state with the effect of the instruction at index (only the operand it writes changes, and the globals
+ * after a call)
+ */
+static void transfer(RANGE_INFO* info, RANGE* state, int index) {
+    Instr* instr = &get_intermediate_code()[index];
+    int* ops = &info->operands[3 * (index - info->cfg->enter)];
+    if (instr->instruct->instruct.type_instruct == I_CALL) {
+        // The callee may change any global
+        for (int v = 0; v < info->num_names; v++) {
+            if (info->global[v]) state[v] = full_range;
+        }
+    }
+    INFO* dest = get_dest(instr);
+    if (!dest || ops[2] < 0) return;
+    RANGE a = operand_range(state, instr->var1, ops[0]);
+    RANGE b = operand_range(state, instr->var2, ops[1]);
+    RANGE result = full_range;
+    RANGE boolean = {0, 1};
+    switch (instr->instruct->instruct.type_instruct) {
+        case I_LOADVAL: case I_STORE:
+            result = a;
+            break;
+        case I_ADD: result = range_add(a, b); break;
+        case I_SUB: result = range_sub(a, b); break;
+        case I_MUL: result = range_mul(a, b); break;
+        case I_DIV: result = range_div(a, b); break;
+        case I_MOD: result = range_mod(a, b); break;
+        case I_MIN: result = range_neg(a); break;
+        case I_SHIFT_RIGHT: {
+            // Division by a power of 2 that truncates towards zero
+            if (b.low == b.high && b.low >= 0 && b.low < 63) {
+                RANGE divisor = {1L << b.low, 1L << b.low};
+                result = range_div(a, divisor);
+            }
+            break;
+        }
+        case I_LES: case I_GRT: case I_EQ: case I_NEQ: case I_LEQ: case I_GEQ: case I_NEG:
+            result = boolean;
+            break;
+        case I_AND: case I_OR:
+            if (a.low >= 0 && a.high <= 1 && b.low >= 0 && b.high <= 1) result = boolean;
+            break;
+        default:
+            break;
+    }
+    state[ops[2]] = result;
+}
+
+/* Narrows a and b knowing that comparing them gives one of the results in mask.
+ * Returns 0 if that is impossible
+ */
+static int narrow(RANGE* a, RANGE* b, int mask) {
+    if (!(possible_relations(*a, *b) & mask)) return 0;
+    switch (mask) {
+        case REL_LES:
+            if (b->high - 1 < a->high) a->high = b->high - 1;
+            if (a->low + 1 > b->low) b->low = a->low + 1;
+            break;
+        case REL_LES | REL_EQ:
+            if (b->high < a->high) a->high = b->high;
+            if (a->low > b->low) b->low = a->low;
+            break;
+        case REL_GRT:
+            return narrow(b, a, REL_LES);
+        case REL_GRT | REL_EQ:
+            return narrow(b, a, REL_LES | REL_EQ);
+        case REL_EQ:
+            if (b->low > a->low) a->low = b->low;
+            if (b->high < a->high) a->high = b->high;
+            *b = *a;
+            break;
+        case REL_LES | REL_GRT:
+            // Different values: only a bound equal to a known value of the other operand can be removed
+            if (b->low == b->high && a->low == b->low) a->low++;
+            else if (b->low == b->high && a->high == b->low) a->high--;
+            if (a->low == a->high && b->low == a->low) b->low++;
+            else if (a->low == a->high && b->high == a->low) b->high--;
+            break;
+        default:
+            break;
+    }
+    return a->low <= a->high && b->low <= b->high;
+}
+
+/* Narrows the ranges of state with the condition of the jump at index, knowing if it jumped or not.
+ * Returns 0 if the jump can never go that way
+ */
+static int refine(RANGE_INFO* info, RANGE* state, int index, int jumped) {
+    Instr* instr = &get_intermediate_code()[index];
+    int* ops = &info->operands[3 * (index - info->cfg->enter)];
+    int mask = relation_mask(instr->instruct->instruct.type_instruct);
+    if (!jumped) mask = ~mask & REL_ALL;
+    INFO zero;
+    zero.id.name = "0";
+    INFO* var2 = instr->var2 ? instr->var2 : &zero;
+    if (ops[0] >= 0 && ops[0] == ops[1]) return (mask & REL_EQ) != 0;
+    RANGE a = operand_range(state, instr->var1, ops[0]);
+    RANGE b = operand_range(state, var2, ops[1]);
+    if (!narrow(&a, &b, mask)) return 0;
+    if (ops[0] >= 0) state[ops[0]] = a;
+    if (ops[1] >= 0) state[ops[1]] = b;
+    return 1;
+}
+
+/* Checks if block is the header of a loop (it's reached by a jump from itself or from a block after it)
+ */
+static int is_loop_header(CFG* cfg, int block) {
+    for (int p = 0; p < cfg->blocks[block].num_preds; p++) {
+        if (cfg->blocks[block].preds[p] >= block) return 1;
+    }
+    return 0;
+}
+
+/* Joins state into the ranges at the start of block. After some changes the bounds that keep growing in a
+ * loop header are widened to infinity so loops reach a fixpoint. Returns 1 if the start of the block changed
+ */
+static int merge_into(RANGE_INFO* info, int block, RANGE* state, int* changes) {
+    RANGE* in = &info->in[block * info->num_names];
+    if (!info->reached[block]) {
+        memcpy(in, state, info->num_names * sizeof(RANGE));
+        info->reached[block] = 1;
+        return 1;
+    }
+    int widen = changes[block] >= WIDEN_AFTER && is_loop_header(info->cfg, block);
+    int changed = 0;
+    for (int v = 0; v < info->num_names; v++) {
+        RANGE joined = in[v];
+        if (state[v].low < joined.low) joined.low = widen ? LONG_MIN : state[v].low;
+        if (state[v].high > joined.high) joined.high = widen ? LONG_MAX : state[v].high;
+        if (joined.low != in[v].low || joined.high != in[v].high) {
+            in[v] = joined;
+            changed = 1;
+        }
+    }
+    if (changed) changes[block]++;
+    return changed;
+}
+
+/* Function that computes the ranges of values of the variables and temporals of the method that starts in the
+ * I_ENTER at index enter. Ranges are narrowed by arithmetic and by the conditions of the jumps leading to each block
+ * The result is only valid while the code of the method is not modified
+ */
+RANGE_INFO* analyze_ranges(int enter) {
+    Instr* code = get_intermediate_code();
+    RANGE_INFO* info = calloc(1, sizeof(RANGE_INFO));
+    if (!info) error_allocate_mem();
+    info->cfg = build_cfg(enter);
+    CFG* cfg = info->cfg;
+    int size = cfg->leave - enter + 1;
+    info->operands = malloc(3 * size * sizeof(int));
+    if (!info->operands) error_allocate_mem();
+    for (int i = enter; i <= cfg->leave; i++) {
+        int* ops = &info->operands[3 * (i - enter)];
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        int has_names = type != I_ENTER && type != I_LEAVE && type != I_LABEL && type != I_JMP;
+        // The first operand of a call is the name of the method
+        ops[0] = has_names && type != I_CALL ? add_name(info, code[i].var1) : -1;
+        ops[1] = has_names ? add_name(info, code[i].var2) : -1;
+        ops[2] = has_names && !is_cond_jump(type) ? add_name(info, code[i].reg) : -1;
+    }
+
+    int num_blocks = cfg->num_blocks;
+    int num_names = info->num_names;
+    info->in = malloc((num_blocks * num_names + 1) * sizeof(RANGE));
+    info->reached = calloc(num_blocks + 1, sizeof(int));
+    int* pending = calloc(num_blocks + 1, sizeof(int));
+    int* changes = calloc(num_blocks + 1, sizeof(int));
+    RANGE* state = malloc((num_names + 1) * sizeof(RANGE));
+    RANGE* edge = malloc((num_names + 1) * sizeof(RANGE));
+    if (!info->in || !info->reached || !pending || !changes || !state || !edge) error_allocate_mem();
+    if (num_blocks == 0) {
+        free(pending); free(changes); free(state); free(edge);
+        return info;
+    }
+
+    // Nothing is known about parameters and variables when the method starts
+    for (int v = 0; v < num_names; v++) info->in[v] = full_range;
+    info->reached[0] = 1;
+    pending[0] = 1;
+
+    // Blocks are visited in the order of the code, which follows the structure of the program
+    int any_pending = 1;
+    while (any_pending) {
+        any_pending = 0;
+        for (int b = 0; b < num_blocks; b++) {
+            if (!pending[b]) continue;
+            pending[b] = 0;
+            BASIC_BLOCK* block = &cfg->blocks[b];
+            memcpy(state, &info->in[b * num_names], num_names * sizeof(RANGE));
+            for (int i = block->start; i <= block->end; i++) {
+                transfer(info, state, i);
+            }
+            int cond = is_cond_jump(code[block->end].instruct->instruct.type_instruct);
+            for (int s = 0; s < 2; s++) {
+                int succ = block->succ[s];
+                if (succ < 0) continue;
+                memcpy(edge, state, num_names * sizeof(RANGE));
+                if (cond && !refine(info, edge, block->end, s == 1)) continue;
+                if (merge_into(info, succ, edge, changes)) {
+                    pending[succ] = 1;
+                    any_pending = 1;
+                }
+            }
+        }
+    }
+    free(pending);
+    free(changes);
+    free(state);
+    free(edge);
+    return info;
+}
+
+/* Function that frees the memory used by the result of the analysis
+ */
+void free_ranges(RANGE_INFO* info) {
+    if (!info) return;
+    free_cfg(info->cfg);
+    free(info->names);
+    free(info->global);
+    free(info->operands);
+    free(info->in);
+    free(info->reached);
+    free(info);
+}
+
+/* Function that returns the range of the operand name right before the instruction at index is executed
+ */
+RANGE range_before(RANGE_INFO* info, int index, const char* name) {
+    INFO var;
+    var.id.name = (char*) name;
+    int block = block_of(info->cfg, index);
+    int name_idx = name_index(info, name);
+    if (name_idx < 0 || block < 0 || !info->reached[block]) {
+        return operand_range(NULL, &var, -1);
+    }
+    RANGE* state = malloc(info->num_names * sizeof(RANGE));
+    if (!state) error_allocate_mem();
+    memcpy(state, &info->in[block * info->num_names], info->num_names * sizeof(RANGE));
+    for (int i = info->cfg->blocks[block].start; i < index; i++) {
+        transfer(info, state, i);
+    }
+    RANGE result = state[name_idx];
+    free(state);
+    return result;
+}
+
+/* Function that checks if the operand name is never negative right before the instruction at index
+ */
+int is_non_negative(RANGE_INFO* info, int index, const char* name) {
+    return range_before(info, index, name).low >= 0;
+}
@@ -0,0 +1,52 @@
+#ifndef RANGE_ANALYSIS_H
+#define RANGE_ANALYSIS_H
+
+#include <limits.h>
+#include "cfg.h"
+
+// Possible results of comparing two values, a condition is described as the mask of results that make it true
+#define REL_LES 1
+#define REL_EQ 2
+#define REL_GRT 4
+#define REL_ALL (REL_LES | REL_EQ | REL_GRT)
+
+// Interval of values an operand can hold (low <= value <= high). LONG_MIN and LONG_MAX mean unbounded
+typedef struct RANGE {
+    long low;
+    long high;
+} RANGE;
+
+// Value ranges of every variable and temporal of one method, at the start of each basic block
+typedef struct RANGE_INFO {
+    CFG* cfg;
+    char** names; // Variables and temporals of the method
+    int* global; // 1 for the names that are globals, a call may change them
+    int num_names;
+    int* operands; // For each instruction of the method, index in names of var1, var2 and reg (-1 if not a name)
+    RANGE* in; // Ranges at the start of each block (num_names entries per block)
+    int* reached; // 0 for the blocks the analysis proved unreachable
+} RANGE_INFO;
+
+/* Function that returns the results (REL_ mask) for which a comparison or conditional jump is true.
+ * JMPF and JMPT compare their operand with 0
+ */
+int relation_mask(INSTR_TYPE t);
+/* Function that returns the results (REL_ mask) that comparing a value of range a with a value of range b can give
+ */
+int possible_relations(RANGE a, RANGE b);
+/* Function that computes the ranges of values of the variables and temporals of the method that starts in the
+ * I_ENTER at index enter. Ranges are narrowed by arithmetic and by the conditions of the jumps leading to each block
+ * The result is only valid while the code of the method is not modified
+ */
+RANGE_INFO* analyze_ranges(int enter);
+/* Function that frees the memory used by the result of the analysis
+ */
+void free_ranges(RANGE_INFO* info);
+/* Function that returns the range of the operand name right before the instruction at index is executed
+ */
+RANGE range_before(RANGE_INFO* info, int index, const char* name);
+/* Function that checks if the operand name is never negative right before the instruction at index
+ */
+int is_non_negative(RANGE_INFO* info, int index, const char* name);
+
+#endif
@@ -0,0 +1,229 @@
+#include "signatures.h"
+#include "purity.h"
+
+extern int remarks;
+
+/* Checks if the method that starts at enter is only called from the program: it is not main and it isn't extern.
+ * Saves its declaration in decl
+ */
+static int is_internal(int enter, INFO** decl) {
+    const char* name = get_intermediate_code()[enter].var1->id.name;
+    *decl = find_method_decl(name);
+    return *decl && !(*decl)->method_decl.is_extern && strcmp(name, "main") != 0;
+}
+
+/* Checks if every call to the method name passes its num_args arguments with the PARAMs right before the CALL
+ */
+static int has_regular_calls(const char* name, int num_args) {
+    Instr* code = get_intermediate_code();
+    for (int i = 0; i < get_code_size(); i++) {
+        if (code[i].instruct->instruct.type_instruct != I_CALL || strcmp(code[i].var1->id.name, name) != 0) continue;
+        if (i < num_args) return 0;
+        for (int a = i - num_args; a < i; a++) {
+            if (code[a].instruct->instruct.type_instruct != I_PARAM) return 0;
+        }
+    }
+    return 1;
+}
+
+/* Checks if an instruction of the method that starts at enter reads name
+ */
+static int is_read(int enter, const char* name) {
+    Instr* code = get_intermediate_code();
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_LOAD) continue;
+        INFO* uses[2];
+        int num_uses = get_uses(&code[i], uses);
+        for (int u = 0; u < num_uses; u++) {
+            if (strcmp(uses[u]->id.name, name) == 0) return 1;
+        }
+    }
+    return 0;
+}
+
+/* Removes the parameters that the method that starts at enter never reads from its declaration and the arguments
+ * of its calls. The arguments are still computed, later passes remove them when they have no side effects
+ */
+static void remove_dead_parameters(int enter, INFO* decl) {
+    Instr* code = get_intermediate_code();
+    const char* name = code[enter].var1->id.name;
+    int num_args = decl->method_decl.num_args;
+    if (num_args == 0 || !has_regular_calls(name, num_args)) return;
+    char* dead = calloc(num_args + 1, 1);
+    if (!dead) error_allocate_mem();
+    ARGS_LIST* args = NULL;
+    ARGS_LIST* last = NULL;
+    int num_dead = 0;
+    ARGS_LIST* arg = decl->method_decl.args;
+    for (int a = 0; a < num_args; a++, arg = arg->next) {
+        dead[a] = !is_read(enter, arg->arg->name);
+        if (dead[a]) {
+            num_dead++;
+            if (remarks) {
+                fprintf(stderr, "Remark: parameter %s of %s is never read, it is removed\n", arg->arg->name, name);
+            }
+            continue;
+        }
+        ARGS_LIST* node = allocate_args_list_mem();
+        node->arg = arg->arg;
+        if (last) last->next = node;
+        else args = node;
+        last = node;
+    }
+    if (num_dead > 0) {
+        decl->method_decl.args = args;
+        decl->method_decl.num_args = num_args - num_dead;
+        for (int i = 0; i < get_code_size(); i++) {
+            INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+            if (type != I_CALL || strcmp(code[i].var1->id.name, name) != 0) continue;
+            int first = i - num_args;
+            for (int a = num_args - 1; a >= 0; a--) {
+                if (!dead[a]) continue;
+                remove_instr(first + a);
+                i--;
+            }
+        }
+    }
+    free(dead);
+}
+
+/* Returns the constant that every return of the method that starts at enter returns (NULL if they don't return the
+ * same constant)
+ */
+static char* constant_return(int enter) {
+    Instr* code = get_intermediate_code();
+    char* value = NULL;
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        if (code[i].instruct->instruct.type_instruct != I_RET) continue;
+        char* returned = code[i].var1 ? constant_value(i, enter, code[i].var1->id.name) : NULL;
+        if (!returned || (value && strcmp(value, returned) != 0)) return NULL;
+        value = returned;
+    }
+    return value;
+}
+
+/* Replaces the results of the calls to the method name by value, which it always returns:
+ *     CALL f, t
+ * becomes
+ *     CALL f
+ *     LOADVAL value, t
+ */
+static void propagate_return_value(const char* name, char* value) {
+    Instr* code = get_intermediate_code();
+    for (int i = 0; i < get_code_size(); i++) {
+        if (code[i].instruct->instruct.type_instruct != I_CALL || !code[i].reg ||
+            strcmp(code[i].var1->id.name, name) != 0) {
+            continue;
+        }
+        INFO method_info = *code[i].var1;
+        INFO result_info = *code[i].reg;
+        INFO value_info;
+        value_info.type = TABLE_ID;
+        value_info.id.name = value;
+        remove_instr(i);
+        insert_instr(i, I_CALL, &method_info, NULL, NULL);
+        insert_instr(++i, I_LOADVAL, &value_info, NULL, &result_info);
+    }
+}
+
+/* Checks if an instruction of the method that starts at enter other than the one at index refers to name
+ */
+static int is_referenced(int enter, int index, const char* name) {
+    Instr* code = get_intermediate_code();
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        INFO* operands[3] = {code[i].var1, code[i].var2, code[i].reg};
+        for (int o = 0; o < 3 && i != index; o++) {
+            if (operands[o] && strcmp(operands[o]->id.name, name) == 0) return 1;
+        }
+    }
+    return 0;
+}
+
+/* Removes the result of the calls whose result is never used, the object code doesn't save it. Calls to pure
+ * methods are removed with their arguments, they have no other effect. Returns 1 if a call changed
+ */
+static int remove_unused_results() {
+    Instr* code = get_intermediate_code();
+    int changed = 0;
+    int enter = -1;
+    for (int i = 0; i < get_code_size(); i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_ENTER) enter = i;
+        if (type == I_LEAVE) enter = -1;
+        if (type != I_CALL || enter < 0 || !code[i].reg || !is_temp(code[i].reg->id.name) ||
+            is_referenced(enter, i, code[i].reg->id.name)) {
+            continue;
+        }
+        changed = 1;
+        char* callee = code[i].var1->id.name;
+        INFO* decl = find_method_decl(callee);
+        int first = decl ? i - decl->method_decl.num_args : -1;
+        if (first > enter && has_regular_calls(callee, decl->method_decl.num_args) && is_pure_method(callee)) {
+            if (remarks) fprintf(stderr, "Remark: call to the pure method %s removed, its result is unused\n", callee);
+            for (int k = i; k >= first; k--) remove_instr(k);
+            i = first - 1;
+            continue;
+        }
+        INFO method_info = *code[i].var1;
+        remove_instr(i);
+        insert_instr(i, I_CALL, &method_info, NULL, NULL);
+    }
+    return changed;
+}
+
+/* Removes the value of the returns of the internal methods whose result no call uses. Returns 1 if a method changed
+ */
+static int remove_unused_returns() {
+    Instr* code = get_intermediate_code();
+    int changed = 0;
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        INFO* decl;
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER || !is_internal(enter, &decl)) continue;
+        const char* name = code[enter].var1->id.name;
+        int used = 0;
+        for (int i = 0; i < get_code_size() && !used; i++) {
+            used = code[i].instruct->instruct.type_instruct == I_CALL && code[i].reg &&
+                   strcmp(code[i].var1->id.name, name) == 0;
+        }
+        if (used) continue;
+        int leave = find_leave(enter);
+        int removed = 0;
+        for (int i = enter + 1; i < leave; i++) {
+            if (code[i].instruct->instruct.type_instruct != I_RET || !code[i].var1) continue;
+            remove_instr(i);
+            insert_instr(i, I_RET, NULL, NULL, NULL);
+            removed = 1;
+        }
+        if (removed && remarks) fprintf(stderr, "Remark: the result of %s is never used, it isn't returned\n", name);
+        changed |= removed;
+    }
+    return changed;
+}
+
+/* Function that adjusts the interface between the methods defined in the program (except main) and their calls:
+ * parameters that are never read are removed from the method and its calls, calls to methods that always return
+ * the same constant use the constant, and calls whose result is unused don't save it, or are removed when the method
+ * is pure (a method whose result no call uses doesn't return it either)
+ */
+void optimize_signatures() {
+    Instr* code = get_intermediate_code();
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        INFO* decl;
+        if (code[enter].instruct->instruct.type_instruct != I_ENTER || !is_internal(enter, &decl)) continue;
+        char* name = code[enter].var1->id.name;
+        remove_dead_parameters(enter, decl);
+        enter = find_enter(name);
+        char* value = constant_return(enter);
+        if (value) {
+            if (remarks) fprintf(stderr, "Remark: %s always returns %s, its calls use the constant\n", name, value);
+            propagate_return_value(name, value);
+            enter = find_enter(name);
+        }
+    }
+    // Methods that stop returning their result can leave other calls unused (a call in a return)
+    int changed = 1;
+    while (changed) {
+        changed = remove_unused_results();
+        changed |= remove_unused_returns();
+    }
+}
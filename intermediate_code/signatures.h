@@ -0,0 +1,13 @@
+#ifndef SIGNATURES_H
+#define SIGNATURES_H
+
+#include "intermediate_code.h"
+
+/* Function that adjusts the interface between the methods defined in the program (except main) and their calls:
+ * parameters that are never read are removed from the method and its calls, calls to methods that always return
+ * the same constant use the constant, and calls whose result is unused don't save it, or are removed when the method
+ * is pure (a method whose result no call uses doesn't return it either)
+ */
+void optimize_signatures();
+
+#endif
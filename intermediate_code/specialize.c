@@ -0,0 +1,284 @@
+#include "specialize.h"
+
+// Most clones the pass creates
+#define MAX_CLONES 8
+// Most instructions of a method that is cloned
+#define MAX_SPECIALIZED_SIZE 200
+// Most instructions all the clones can add to the program
+#define CLONE_GROWTH_BUDGET 600
+// Most different constant-argument patterns that are considered
+#define MAX_PATTERNS 64
+
+extern int remarks;
+
+// Calls to a method with the same constant arguments, and the clone that runs them
+typedef struct SPECIALIZATION {
+    INFO* decl; // Declaration of the method
+    char** constants; // Constant passed as each argument (NULL for the arguments that aren't constants)
+    int num_calls; // Calls with these constants
+    int in_loop; // 1 if one of the calls is inside a loop
+    char* clone; // Name of the clone (NULL if there is no clone)
+} SPECIALIZATION;
+
+// Number of the next clone, it is named method.spec<number>
+static int clone_counter = 0;
+
+/* Checks if an instruction of the method that starts at enter reads or writes a global. Each method keeps its own
+ * copy of the globals it uses, so a clone couldn't share them with the original
+ */
+static int uses_globals(int enter) {
+    Instr* code = get_intermediate_code();
+    for (int i = enter + 1; code[i].instruct->instruct.type_instruct != I_LEAVE; i++) {
+        INFO* operands[3];
+        int num_operands = get_uses(&code[i], operands);
+        INFO* dest = get_dest(&code[i]);
+        if (dest) operands[num_operands++] = dest;
+        for (int o = 0; o < num_operands; o++) {
+            if (is_global(operands[o]->id.name)) return 1;
+        }
+    }
+    return 0;
+}
+
+/* Saves in constants the constant passed as each argument of the call at index of the method that starts at enter
+ * (NULL for the rest). Returns how many arguments are constants, 0 if the call can't be specialized
+ */
+static int call_constants(int index, int enter, INFO** decl, char** constants) {
+    Instr* code = get_intermediate_code();
+    *decl = find_method_decl(code[index].var1->id.name);
+    if (!*decl || (*decl)->method_decl.is_extern || strcmp((*decl)->method_decl.name, "main") == 0) return 0;
+    int num_args = (*decl)->method_decl.num_args;
+    if (index < num_args) return 0;
+    int count = 0;
+    for (int a = 0; a < num_args; a++) {
+        Instr* param = &code[index - num_args + a];
+        if (param->instruct->instruct.type_instruct != I_PARAM) return 0;
+        constants[a] = constant_value(index, enter, param->var1->id.name);
+        count += constants[a] != NULL;
+    }
+    return count;
+}
+
+/* Checks if the call at index runs inside a loop of the method that starts at enter: a label before it is the
+ * target of a jump after it
+ */
+static int is_in_loop(int index, int enter) {
+    Instr* code = get_intermediate_code();
+    int leave = find_leave(enter);
+    for (int j = index + 1; j < leave; j++) {
+        INSTR_TYPE type = code[j].instruct->instruct.type_instruct;
+        INFO* target = type == I_JMP ? code[j].var1 : is_cond_jump(type) ? code[j].reg : NULL;
+        if (!target) continue;
+        for (int k = enter + 1; k < index; k++) {
+            if (code[k].instruct->instruct.type_instruct == I_LABEL &&
+                strcmp(code[k].var1->id.name, target->id.name) == 0) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Returns the pattern of the calls to decl with the given constants (NULL if there is none)
+ */
+static SPECIALIZATION* find_pattern(SPECIALIZATION* patterns, int count, INFO* decl, char** constants) {
+    for (int p = 0; p < count; p++) {
+        if (patterns[p].decl != decl) continue;
+        int same = 1;
+        for (int a = 0; a < decl->method_decl.num_args && same; a++) {
+            char* c = patterns[p].constants[a];
+            same = (!c && !constants[a]) || (c && constants[a] && strcmp(c, constants[a]) == 0);
+        }
+        if (same) return &patterns[p];
+    }
+    return NULL;
+}
+
+/* Returns the name an operand of the clone gets: labels and temporals get new ones (saved in old_names and new_names
+ * so every use gets the same one), the rest keep their name
+ */
+static char* clone_name(char* name, char** old_names, char** new_names, int* num_names) {
+    if (name[0] != '_' && !is_temp(name)) return name;
+    for (int n = 0; n < *num_names; n++) {
+        if (strcmp(old_names[n], name) == 0) return new_names[n];
+    }
+    old_names[*num_names] = name;
+    new_names[*num_names] = name[0] == '_' ? new_label() : new_temp();
+    return new_names[(*num_names)++];
+}
+
+/* Returns the constant of the pattern s that the parameter name keeps in the whole body of size instructions (NULL
+ * if it doesn't get a constant or the body assigns it)
+ */
+static char* fixed_constant(SPECIALIZATION* s, Instr* body, int size, const char* name) {
+    char* constant = NULL;
+    ARGS_LIST* arg = s->decl->method_decl.args;
+    for (int a = 0; a < s->decl->method_decl.num_args; a++, arg = arg->next) {
+        if (strcmp(arg->arg->name, name) == 0) constant = s->constants[a];
+    }
+    if (!constant) return NULL;
+    for (int k = 0; k < size; k++) {
+        INFO* dest = get_dest(&body[k]);
+        if (dest && strcmp(dest->id.name, name) == 0) return NULL;
+    }
+    return constant;
+}
+
+/* Creates the clone of the method that starts at enter for the pattern s, right after the method:
+ *     ENTER f.specK
+ *     STORE c, p            (for each parameter p that gets a constant c)
+ *     body of f
+ *     LEAVE f.specK
+ * The declaration of the clone takes only the parameters that don't get constants. Arguments of the body that pass
+ * one of them unchanged pass its constant instead, so the recursive calls of the clone can call the clone too
+ */
+static void create_clone(SPECIALIZATION* s, int enter) {
+    Instr* code = get_intermediate_code();
+    INFO* decl = s->decl;
+    int leave = find_leave(enter);
+    int size = leave - enter - 1;
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s.spec%d", decl->method_decl.name, clone_counter++);
+    s->clone = my_strdup(buf);
+
+    ARGS_LIST* args = NULL;
+    ARGS_LIST* last = NULL;
+    int num_args = 0;
+    ARGS_LIST* arg = decl->method_decl.args;
+    for (int a = 0; a < decl->method_decl.num_args; a++, arg = arg->next) {
+        if (s->constants[a]) continue;
+        ARGS_LIST* node = allocate_args_list_mem();
+        node->arg = arg->arg;
+        if (last) last->next = node;
+        else args = node;
+        last = node;
+        num_args++;
+    }
+    add_sentence(new_method_clone_node(decl, s->clone, args, num_args));
+
+    Instr* body = malloc((size + 1) * sizeof(Instr));
+    char** old_names = malloc((size * 3 + 1) * sizeof(char*));
+    char** new_names = malloc((size * 3 + 1) * sizeof(char*));
+    if (!body || !old_names || !new_names) error_allocate_mem();
+    memcpy(body, &code[enter + 1], size * sizeof(Instr));
+    int num_names = 0;
+
+    int position = leave + 1;
+    INFO method_info = *code[enter].var1;
+    method_info.id.name = s->clone;
+    insert_instr(position++, I_ENTER, &method_info, NULL, NULL);
+    arg = decl->method_decl.args;
+    for (int a = 0; a < decl->method_decl.num_args; a++, arg = arg->next) {
+        if (!s->constants[a]) continue;
+        INFO value_info, param_info;
+        value_info.type = TABLE_ID;
+        value_info.id.name = s->constants[a];
+        param_info.type = TABLE_ID;
+        param_info.id.name = arg->arg->name;
+        insert_instr(position++, I_STORE, &value_info, NULL, &param_info);
+    }
+    for (int k = 0; k < size; k++) {
+        INSTR_TYPE type = body[k].instruct->instruct.type_instruct;
+        INFO* operands[3] = {body[k].var1, body[k].var2, body[k].reg};
+        INFO copies[3];
+        for (int o = 0; o < 3; o++) {
+            if (!operands[o]) continue;
+            copies[o] = *operands[o];
+            if (type != I_CALL || o != 0) {
+                copies[o].id.name = clone_name(operands[o]->id.name, old_names, new_names, &num_names);
+            }
+        }
+        if (type == I_PARAM) {
+            char* constant = fixed_constant(s, body, size, operands[0]->id.name);
+            if (constant) copies[0].id.name = constant;
+        }
+        insert_instr(position++, type, operands[0] ? &copies[0] : NULL, operands[1] ? &copies[1] : NULL,
+                     operands[2] ? &copies[2] : NULL);
+    }
+    insert_instr(position, I_LEAVE, &method_info, NULL, NULL);
+    free(body);
+    free(old_names);
+    free(new_names);
+}
+
+/* Function that clones the methods called with the same constant arguments from several call sites (or from a call
+ * inside a loop): the clone takes only the other arguments and assigns the constants to its parameters at the start,
+ * so the optimizations fold them into its body. Matching calls are redirected to the clone
+ * Each pattern (method and constant arguments) gets a single clone, at most MAX_CLONES clones are created and they
+ * can add at most CLONE_GROWTH_BUDGET instructions
+ */
+void specialize_methods() {
+    Instr* code = get_intermediate_code();
+    SPECIALIZATION patterns[MAX_PATTERNS];
+    int num_patterns = 0;
+    char* constants[MAX_CODE_SIZE];
+    int enter = -1;
+    for (int i = 0; i < get_code_size(); i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_ENTER) enter = i;
+        if (type == I_LEAVE) enter = -1;
+        INFO* decl;
+        if (type != I_CALL || enter < 0 || !call_constants(i, enter, &decl, constants)) continue;
+        SPECIALIZATION* s = find_pattern(patterns, num_patterns, decl, constants);
+        if (!s) {
+            if (num_patterns == MAX_PATTERNS) continue;
+            s = &patterns[num_patterns++];
+            s->decl = decl;
+            s->constants = malloc((decl->method_decl.num_args + 1) * sizeof(char*));
+            if (!s->constants) error_allocate_mem();
+            memcpy(s->constants, constants, decl->method_decl.num_args * sizeof(char*));
+            s->num_calls = 0;
+            s->in_loop = 0;
+            s->clone = NULL;
+        }
+        s->num_calls++;
+        s->in_loop |= is_in_loop(i, enter);
+    }
+
+    int num_clones = 0;
+    int budget = CLONE_GROWTH_BUDGET;
+    for (int p = 0; p < num_patterns && num_clones < MAX_CLONES; p++) {
+        SPECIALIZATION* s = &patterns[p];
+        if (s->num_calls < 2 && !s->in_loop) continue;
+        int callee = find_enter(s->decl->method_decl.name);
+        if (callee < 0) continue;
+        int size = find_leave(callee) - callee - 1;
+        int growth = size + 2 + s->decl->method_decl.num_args;
+        if (size > MAX_SPECIALIZED_SIZE || growth > budget || get_code_size() + growth >= MAX_CODE_SIZE ||
+            uses_globals(callee)) {
+            continue;
+        }
+        create_clone(s, callee);
+        budget -= growth;
+        num_clones++;
+        if (remarks) {
+            fprintf(stderr, "Remark: method %s specialized as %s for the constant arguments (",
+                    s->decl->method_decl.name, s->clone);
+            for (int a = 0; a < s->decl->method_decl.num_args; a++) {
+                fprintf(stderr, "%s%s", a ? ", " : "", s->constants[a] ? s->constants[a] : "_");
+            }
+            fprintf(stderr, ") of %d call%s%s\n", s->num_calls, s->num_calls == 1 ? "" : "s",
+                    s->in_loop ? " (called in a loop)" : "");
+        }
+    }
+
+    // Calls with the constants of a clone (also the ones inside the clones) drop them and call the clone
+    enter = -1;
+    for (int i = 0; i < get_code_size(); i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_ENTER) enter = i;
+        if (type == I_LEAVE) enter = -1;
+        INFO* decl;
+        if (type != I_CALL || enter < 0 || !call_constants(i, enter, &decl, constants)) continue;
+        SPECIALIZATION* s = find_pattern(patterns, num_patterns, decl, constants);
+        if (!s || !s->clone) continue;
+        int first = i - decl->method_decl.num_args;
+        for (int a = decl->method_decl.num_args - 1; a >= 0; a--) {
+            if (!constants[a]) continue;
+            remove_instr(first + a);
+            i--;
+        }
+        code[i].var1->id.name = s->clone;
+    }
+    for (int p = 0; p < num_patterns; p++) free(patterns[p].constants);
+}
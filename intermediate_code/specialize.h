@@ -0,0 +1,12 @@
+#ifndef SPECIALIZE_H
+#define SPECIALIZE_H
+
+#include "intermediate_code.h"
+
+/* Function that clones the methods called with the same constant arguments from several call sites (or from a call
+ * inside a loop): the clone takes only the other arguments and assigns the constants to its parameters at the start,
+ * so the optimizations fold them into its body. Matching calls are redirected to the clone
+ */
+void specialize_methods();
+
+#endif
@@ -0,0 +1,769 @@
+#include "ssa.h"
+
+// Merge of the versions of a variable that reach a block from each of its predecessors
+typedef struct PHI {
+    int var; // Index of the promoted variable
+    char* result; // Version defined by the phi
+    char** incoming; // Version that reaches from each predecessor (same order as the preds of the block)
+    char* alias; // Version that replaces the phi when all its incoming versions are the same
+    struct PHI* next;
+} PHI;
+
+// State of the promotion of the variables of one method
+typedef struct SSA_METHOD {
+    CFG* cfg;
+    int* idom;
+    char** vars; // Promoted variables
+    int num_vars;
+    int* counters; // Last version number of each variable
+    char*** stacks; // Versions of each variable that reach the block being renamed
+    int* heights;
+    PHI** phis; // Phis of each block
+    int** children; // Blocks immediately dominated by each block
+    int* num_children;
+} SSA_METHOD;
+
+// Pending copy that replaces a phi in a predecessor
+typedef struct PHI_COPY {
+    int pos;
+    char* src;
+    char* dest;
+} PHI_COPY;
+
+/* Function that checks if an operand name is a local variable or parameter of a method (not a temporal,
+ * constant, label or global)
+ */
+int is_local_variable(const char* name) {
+    return name && !is_temp(name) && !is_constant(name) && name[0] != '_' && !is_global(name);
+}
+
+/* Function that checks if name is a value meant to be defined once in the method: a temporal or a version of a
+ * variable
+ */
+int is_ssa_value(const char* name) {
+    return is_temp(name) || strchr(name, '.') != NULL;
+}
+
+/* Returns the index of name among the promoted variables (-1 if it is not one of them)
+ */
+static int var_index(SSA_METHOD* m, const char* name) {
+    for (int v = 0; v < m->num_vars; v++) {
+        if (strcmp(m->vars[v], name) == 0) return v;
+    }
+    return -1;
+}
+
+/* Adds the operand to the promoted variables if it is a local variable not seen before
+ */
+static void add_var(SSA_METHOD* m, INFO* operand) {
+    if (!operand || !is_local_variable(operand->id.name) || var_index(m, operand->id.name) >= 0) return;
+    m->vars = realloc(m->vars, (m->num_vars + 1) * sizeof(char*));
+    if (!m->vars) error_allocate_mem();
+    m->vars[m->num_vars++] = operand->id.name;
+}
+
+/* Returns the version of variable v that reaches the current point of the renaming (the variable itself before
+ * any assignment, which is the value of the parameter or of the variable at the start of the method)
+ */
+static char* current_version(SSA_METHOD* m, int v) {
+    return m->heights[v] > 0 ? m->stacks[v][m->heights[v] - 1] : m->vars[v];
+}
+
+/* Creates a new version of variable v and makes it the current one
+ */
+static char* new_version(SSA_METHOD* m, int v) {
+    char* name = malloc(strlen(m->vars[v]) + 16);
+    if (!name) error_allocate_mem();
+    sprintf(name, "%s.%d", m->vars[v], ++m->counters[v]);
+    m->stacks[v][m->heights[v]++] = name;
+    return name;
+}
+
+/* Returns the position of pred among the predecessors of block
+ */
+static int pred_position(BASIC_BLOCK* block, int pred) {
+    for (int p = 0; p < block->num_preds; p++) {
+        if (block->preds[p] == pred) return p;
+    }
+    return -1;
+}
+
+/* Renames the operands of block and of the blocks it dominates, so every use reads the version defined by the
+ * closest dominating assignment, and saves the versions that leave the block in the phis of its successors
+ */
+static void rename_block(SSA_METHOD* m, int b) {
+    Instr* code = get_intermediate_code();
+    BASIC_BLOCK* block = &m->cfg->blocks[b];
+    int* saved = malloc((m->num_vars + 1) * sizeof(int));
+    if (!saved) error_allocate_mem();
+    memcpy(saved, m->heights, m->num_vars * sizeof(int));
+
+    for (PHI* phi = m->phis[b]; phi; phi = phi->next) {
+        phi->result = new_version(m, phi->var);
+    }
+    for (int i = block->start; i <= block->end; i++) {
+        INFO* uses[2];
+        int num_uses = get_uses(&code[i], uses);
+        for (int u = 0; u < num_uses; u++) {
+            int v = var_index(m, uses[u]->id.name);
+            if (v >= 0) uses[u]->id.name = current_version(m, v);
+        }
+        INFO* dest = get_dest(&code[i]);
+        int v = dest ? var_index(m, dest->id.name) : -1;
+        if (v >= 0) dest->id.name = new_version(m, v);
+    }
+    for (int s = 0; s < 2; s++) {
+        int succ = block->succ[s];
+        if (succ < 0 || (s == 1 && succ == block->succ[0])) continue;
+        int position = pred_position(&m->cfg->blocks[succ], b);
+        for (PHI* phi = m->phis[succ]; phi; phi = phi->next) {
+            phi->incoming[position] = current_version(m, phi->var);
+        }
+    }
+    for (int c = 0; c < m->num_children[b]; c++) {
+        rename_block(m, m->children[b][c]);
+    }
+
+    memcpy(m->heights, saved, m->num_vars * sizeof(int));
+    free(saved);
+}
+
+/* Places a phi for each variable in the blocks of the dominance frontier of its assignments where it is live
+ * (pruned SSA)
+ */
+static void place_phis(SSA_METHOD* m) {
+    Instr* code = get_intermediate_code();
+    CFG* cfg = m->cfg;
+    int nb = cfg->num_blocks, nv = m->num_vars;
+    char* defs = calloc(nb * nv + 1, 1);
+    char* upward_uses = calloc(nb * nv + 1, 1);
+    char* live_in = calloc(nb * nv + 1, 1);
+    char* frontier = calloc(nb * nb + 1, 1);
+    if (!defs || !upward_uses || !live_in || !frontier) error_allocate_mem();
+
+    for (int b = 0; b < nb; b++) {
+        for (int i = cfg->blocks[b].start; i <= cfg->blocks[b].end; i++) {
+            INFO* uses[2];
+            int num_uses = get_uses(&code[i], uses);
+            for (int u = 0; u < num_uses; u++) {
+                int v = var_index(m, uses[u]->id.name);
+                if (v >= 0 && !defs[b * nv + v]) upward_uses[b * nv + v] = 1;
+            }
+            INFO* dest = get_dest(&code[i]);
+            int v = dest ? var_index(m, dest->id.name) : -1;
+            if (v >= 0) defs[b * nv + v] = 1;
+        }
+    }
+
+    // Liveness at the start of each block
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int b = nb - 1; b >= 0; b--) {
+            for (int v = 0; v < nv; v++) {
+                if (live_in[b * nv + v]) continue;
+                int live = upward_uses[b * nv + v];
+                for (int s = 0; s < 2 && !live; s++) {
+                    int succ = cfg->blocks[b].succ[s];
+                    live = succ >= 0 && live_in[succ * nv + v] && !defs[b * nv + v];
+                }
+                if (live) {
+                    live_in[b * nv + v] = 1;
+                    changed = 1;
+                }
+            }
+        }
+    }
+
+    // Dominance frontiers: walk up from the predecessors of each join until its immediate dominator
+    for (int b = 0; b < nb; b++) {
+        if (cfg->blocks[b].num_preds < 2 || m->idom[b] < 0) continue;
+        for (int p = 0; p < cfg->blocks[b].num_preds; p++) {
+            int runner = cfg->blocks[b].preds[p];
+            if (m->idom[runner] < 0) continue;
+            while (runner != m->idom[b]) {
+                frontier[runner * nb + b] = 1;
+                runner = m->idom[runner];
+            }
+        }
+    }
+
+    int* worklist = malloc((nb + 1) * sizeof(int));
+    char* queued = malloc(nb + 1);
+    char* has_phi = malloc(nb + 1);
+    if (!worklist || !queued || !has_phi) error_allocate_mem();
+    for (int v = 0; v < nv; v++) {
+        int count = 0;
+        memset(queued, 0, nb);
+        memset(has_phi, 0, nb);
+        for (int b = 0; b < nb; b++) {
+            if (defs[b * nv + v] && m->idom[b] >= 0) {
+                worklist[count++] = b;
+                queued[b] = 1;
+            }
+        }
+        while (count > 0) {
+            int b = worklist[--count];
+            for (int d = 0; d < nb; d++) {
+                if (!frontier[b * nb + d] || has_phi[d] || !live_in[d * nv + v]) continue;
+                PHI* phi = calloc(1, sizeof(PHI));
+                if (!phi) error_allocate_mem();
+                phi->var = v;
+                phi->incoming = calloc(cfg->blocks[d].num_preds + 1, sizeof(char*));
+                if (!phi->incoming) error_allocate_mem();
+                phi->next = m->phis[d];
+                m->phis[d] = phi;
+                has_phi[d] = 1;
+                if (!queued[d]) {
+                    worklist[count++] = d;
+                    queued[d] = 1;
+                }
+            }
+        }
+    }
+
+    free(worklist);
+    free(queued);
+    free(has_phi);
+    free(defs);
+    free(upward_uses);
+    free(live_in);
+    free(frontier);
+}
+
+/* Returns the version that name stands for once the trivial phis are removed
+ */
+static char* resolve_version(SSA_METHOD* m, char* name) {
+    int found = 1;
+    while (name && found) {
+        found = 0;
+        for (int b = 0; b < m->cfg->num_blocks && !found; b++) {
+            for (PHI* phi = m->phis[b]; phi; phi = phi->next) {
+                if (phi->alias && phi->result == name) {
+                    name = phi->alias;
+                    found = 1;
+                    break;
+                }
+            }
+        }
+    }
+    return name;
+}
+
+/* Removes the phis whose incoming versions are all the same (or the phi itself), replacing them by that version
+ */
+static void remove_trivial_phis(SSA_METHOD* m) {
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int b = 0; b < m->cfg->num_blocks; b++) {
+            for (PHI* phi = m->phis[b]; phi; phi = phi->next) {
+                if (phi->alias) continue;
+                char* same = NULL;
+                int trivial = 1;
+                for (int p = 0; p < m->cfg->blocks[b].num_preds && trivial; p++) {
+                    char* incoming = resolve_version(m, phi->incoming[p]);
+                    if (!incoming || incoming == phi->result) continue;
+                    if (!same) {
+                        same = incoming;
+                    } else if (strcmp(same, incoming) != 0) {
+                        trivial = 0;
+                    }
+                }
+                if (trivial && same) {
+                    phi->alias = same;
+                    changed = 1;
+                }
+            }
+        }
+    }
+}
+
+/* Orders the copies from the last position to the first so inserting one doesn't move the others
+ */
+static int compare_copies(const void* a, const void* b) {
+    return ((const PHI_COPY*)b)->pos - ((const PHI_COPY*)a)->pos;
+}
+
+/* Replaces each phi by copies of its incoming versions at the end of the predecessors. A copy goes after a
+ * conditional jump when the block is its fallthrough, and before the jump otherwise (phi results are fresh
+ * versions that are not live in the other successor)
+ */
+static void lower_phis(SSA_METHOD* m) {
+    Instr* code = get_intermediate_code();
+    CFG* cfg = m->cfg;
+    PHI_COPY* copies = NULL;
+    int num_copies = 0;
+    for (int b = 0; b < cfg->num_blocks; b++) {
+        for (PHI* phi = m->phis[b]; phi; phi = phi->next) {
+            if (phi->alias) continue;
+            for (int p = 0; p < cfg->blocks[b].num_preds; p++) {
+                char* src = resolve_version(m, phi->incoming[p]);
+                if (!src || strcmp(src, phi->result) == 0) continue;
+                BASIC_BLOCK* pred = &cfg->blocks[cfg->blocks[b].preds[p]];
+                Instr* last = &code[pred->end];
+                int pos = pred->end + 1;
+                if (is_cond_jump(last->instruct->instruct.type_instruct)) {
+                    if (pred->succ[1] == b) pos = pred->end;
+                } else if (is_terminator(last)) {
+                    pos = pred->end;
+                }
+                copies = realloc(copies, (num_copies + 1) * sizeof(PHI_COPY));
+                if (!copies) error_allocate_mem();
+                copies[num_copies].pos = pos;
+                copies[num_copies].src = src;
+                copies[num_copies].dest = phi->result;
+                num_copies++;
+            }
+        }
+    }
+
+    // Uses of removed phis read the version they stand for
+    for (int i = cfg->enter + 1; i < cfg->leave; i++) {
+        INFO* uses[2];
+        int num_uses = get_uses(&code[i], uses);
+        for (int u = 0; u < num_uses; u++) {
+            uses[u]->id.name = resolve_version(m, uses[u]->id.name);
+        }
+    }
+
+    qsort(copies, num_copies, sizeof(PHI_COPY), compare_copies);
+    for (int c = 0; c < num_copies; c++) {
+        INFO src_info, dest_info;
+        src_info.type = TABLE_ID;
+        src_info.id.name = copies[c].src;
+        src_info.id.type = TYPE_INT;
+        dest_info.type = TABLE_ID;
+        dest_info.id.name = copies[c].dest;
+        dest_info.id.type = TYPE_INT;
+        insert_instr(copies[c].pos, I_STORE, &src_info, NULL, &dest_info);
+    }
+    free(copies);
+}
+
+/* Returns how many instructions of the method in [enter, leave] read (uses) or write (!uses) name
+ */
+static int count_refs(int enter, int leave, const char* name, int uses) {
+    Instr* code = get_intermediate_code();
+    int count = 0;
+    for (int i = enter + 1; i < leave; i++) {
+        if (uses) {
+            INFO* operands[2];
+            int num_uses = get_uses(&code[i], operands);
+            for (int u = 0; u < num_uses; u++) {
+                if (strcmp(operands[u]->id.name, name) == 0) count++;
+            }
+        } else {
+            INFO* dest = get_dest(&code[i]);
+            if (dest && strcmp(dest->id.name, name) == 0) count++;
+        }
+    }
+    return count;
+}
+
+/* Writes the result of an instruction directly in the variable when the temporal it defines is only copied to it
+ * by the next instruction
+ */
+static int forward_temps(int enter) {
+    Instr* code = get_intermediate_code();
+    int leave = find_method_end(enter);
+    int changed = 0;
+    for (int i = enter + 1; i + 1 < leave; i++) {
+        Instr* copy = &code[i + 1];
+        INFO* dest = get_dest(&code[i]);
+        if (!dest || !is_temp(dest->id.name) || copy->instruct->instruct.type_instruct != I_STORE ||
+            strcmp(copy->var1->id.name, dest->id.name) != 0 || !is_local_variable(copy->reg->id.name) ||
+            count_refs(enter, leave, dest->id.name, 1) != 1 || count_refs(enter, leave, dest->id.name, 0) != 1) {
+            continue;
+        }
+        dest->id.name = copy->reg->id.name;
+        remove_instr(i + 1);
+        leave--;
+        changed = 1;
+    }
+    return changed;
+}
+
+/* Replaces the uses of values defined once with a constant by the constant itself
+ */
+static int propagate_constants(int enter) {
+    Instr* code = get_intermediate_code();
+    int leave = find_method_end(enter);
+    int changed = 0;
+    for (int i = enter + 1; i < leave; i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        INFO* dest = get_dest(&code[i]);
+        if ((type != I_LOADVAL && type != I_STORE) || !is_constant(code[i].var1->id.name) ||
+            !is_ssa_value(dest->id.name) || count_refs(enter, leave, dest->id.name, 0) != 1) {
+            continue;
+        }
+        for (int j = enter + 1; j < leave; j++) {
+            INFO* uses[2];
+            int num_uses = get_uses(&code[j], uses);
+            for (int u = 0; u < num_uses; u++) {
+                if (strcmp(uses[u]->id.name, dest->id.name) == 0) {
+                    uses[u]->id.name = code[i].var1->id.name;
+                    changed = 1;
+                }
+            }
+        }
+    }
+    return changed;
+}
+
+/* Checks if an instruction only computes its destination (it can be removed when the result is not used).
+ * Divisions are kept because they can trap
+ */
+static int is_pure_instr(INSTR_TYPE type) {
+    switch (type) {
+        case I_LOADVAL: case I_STORE: case I_ADD: case I_SUB: case I_MUL: case I_MIN: case I_NEG:
+        case I_AND: case I_OR: case I_SHIFT_RIGHT:
+        case I_LES: case I_GRT: case I_EQ: case I_NEQ: case I_LEQ: case I_GEQ:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/* Removes the instructions that define values that are never used
+ */
+static int remove_dead_values(int enter) {
+    Instr* code = get_intermediate_code();
+    int leave = find_method_end(enter);
+    int changed = 0;
+    for (int i = leave - 1; i > enter; i--) {
+        INFO* dest = get_dest(&code[i]);
+        if (dest && is_pure_instr(code[i].instruct->instruct.type_instruct) && is_ssa_value(dest->id.name) &&
+            count_refs(enter, leave, dest->id.name, 1) == 0) {
+            remove_instr(i);
+            leave--;
+            changed = 1;
+        }
+    }
+    return changed;
+}
+
+/* Builds the dominator tree of the method
+ */
+static void build_dominator_tree(SSA_METHOD* m) {
+    int nb = m->cfg->num_blocks;
+    m->idom = compute_dominators(m->cfg);
+    m->children = calloc(nb + 1, sizeof(int*));
+    m->num_children = calloc(nb + 1, sizeof(int));
+    if (!m->children || !m->num_children) error_allocate_mem();
+    for (int b = 1; b < nb; b++) {
+        int parent = m->idom[b];
+        if (parent < 0) continue;
+        m->children[parent] = realloc(m->children[parent], (m->num_children[parent] + 1) * sizeof(int));
+        if (!m->children[parent]) error_allocate_mem();
+        m->children[parent][m->num_children[parent]++] = b;
+    }
+}
+
+/* Frees the memory used to promote the variables of a method
+ */
+static void free_ssa_method(SSA_METHOD* m) {
+    for (int b = 0; b < m->cfg->num_blocks; b++) {
+        PHI* phi = m->phis[b];
+        while (phi) {
+            PHI* next = phi->next;
+            free(phi->incoming);
+            free(phi);
+            phi = next;
+        }
+        free(m->children[b]);
+    }
+    for (int v = 0; v < m->num_vars; v++) {
+        free(m->stacks[v]);
+    }
+    free(m->phis);
+    free(m->children);
+    free(m->num_children);
+    free(m->stacks);
+    free(m->heights);
+    free(m->counters);
+    free(m->idom);
+    free_cfg(m->cfg);
+}
+
+/* Converts the variables saved in m to SSA form, lowering the phis to copies
+ */
+static void rename_variables(SSA_METHOD* m, int enter) {
+    // The entry block can't be a join, the values of the variables at the start of the method flow into it
+    m->cfg = build_cfg(enter);
+    if (m->cfg->blocks[0].num_preds > 0) {
+        INFO label_info;
+        label_info.type = TABLE_ID;
+        label_info.id.name = new_label();
+        insert_instr(enter + 1, I_LABEL, &label_info, NULL, NULL);
+        free_cfg(m->cfg);
+        m->cfg = build_cfg(enter);
+    }
+
+    int nb = m->cfg->num_blocks;
+    build_dominator_tree(m);
+    m->phis = calloc(nb + 1, sizeof(PHI*));
+    m->counters = calloc(m->num_vars, sizeof(int));
+    m->heights = calloc(m->num_vars, sizeof(int));
+    m->stacks = calloc(m->num_vars, sizeof(char**));
+    if (!m->phis || !m->counters || !m->heights || !m->stacks) error_allocate_mem();
+    for (int v = 0; v < m->num_vars; v++) {
+        m->stacks[v] = malloc((m->cfg->leave - enter + nb + 1) * sizeof(char*));
+        if (!m->stacks[v]) error_allocate_mem();
+    }
+
+    place_phis(m);
+    rename_block(m, 0);
+    remove_trivial_phis(m);
+    lower_phis(m);
+    free_ssa_method(m);
+}
+
+/* Promotes the local variables and parameters of the method that starts in the I_ENTER at index enter
+ */
+static void promote_method(int enter) {
+    Instr* code = get_intermediate_code();
+    int leave = find_method_end(enter);
+
+    // Instructions read variables directly, I_LOAD does nothing
+    for (int i = leave - 1; i > enter; i--) {
+        if (code[i].instruct->instruct.type_instruct == I_LOAD) {
+            remove_instr(i);
+        }
+    }
+    leave = find_method_end(enter);
+
+    SSA_METHOD m = {0};
+    for (int i = enter + 1; i < leave; i++) {
+        INFO* uses[2];
+        int num_uses = get_uses(&code[i], uses);
+        for (int u = 0; u < num_uses; u++) {
+            add_var(&m, uses[u]);
+        }
+        add_var(&m, get_dest(&code[i]));
+    }
+    if (m.num_vars > 0 && leave > enter + 1) {
+        rename_variables(&m, enter);
+    }
+    free(m.vars);
+
+    int changed = 1;
+    while (changed) {
+        changed = forward_temps(enter);
+        changed |= propagate_constants(enter);
+        changed |= remove_dead_values(enter);
+    }
+}
+
+/* Function that promotes the local variables and parameters of every method to SSA values: every assignment
+ * defines a new version (x.1, x.2, ...) and the versions that reach a join are merged by copies at the end of the
+ * predecessors. Versions with a constant value are propagated and dead definitions removed
+ * Globals are never promoted
+ */
+void promote_variables() {
+    Instr* code = get_intermediate_code();
+    for (int i = 0; i < get_code_size(); i++) {
+        if (code[i].instruct->instruct.type_instruct == I_ENTER) {
+            promote_method(i);
+        }
+    }
+}
+
+/* Returns the index of name in names (-1 if it's not there)
+ */
+static int name_index(char** names, int count, const char* name) {
+    for (int n = 0; n < count; n++) {
+        if (strcmp(names[n], name) == 0) return n;
+    }
+    return -1;
+}
+
+/* Checks if a and b are versions of the same variable
+ */
+static int same_variable(const char* a, const char* b) {
+    size_t length_a = strcspn(a, "."), length_b = strcspn(b, ".");
+    return length_a == length_b && strncmp(a, b, length_a) == 0;
+}
+
+/* Returns the representative of the group of versions that contains n
+ */
+static int find_group(int* group, int n) {
+    while (group[n] != n) n = group[n];
+    return n;
+}
+
+/* Joins the groups of a and b if none of their versions are live at the same time
+ */
+static void try_coalesce(int* group, char* interferes, int count, int a, int b) {
+    a = find_group(group, a);
+    b = find_group(group, b);
+    if (a == b || interferes[a * count + b]) return;
+    group[b] = a;
+    for (int n = 0; n < count; n++) {
+        if (interferes[b * count + n]) {
+            interferes[a * count + n] = 1;
+            interferes[n * count + a] = 1;
+        }
+    }
+}
+
+/* Takes the method that starts in the I_ENTER at index enter out of SSA form
+ */
+static void leave_method(int enter) {
+    Instr* code = get_intermediate_code();
+    int leave = find_method_end(enter);
+    char** names = NULL;
+    int count = 0;
+    for (int i = enter + 1; i < leave; i++) {
+        INFO* operands[3];
+        int num_operands = get_uses(&code[i], operands);
+        INFO* dest = get_dest(&code[i]);
+        if (dest) operands[num_operands++] = dest;
+        for (int o = 0; o < num_operands; o++) {
+            char* name = operands[o]->id.name;
+            if (is_local_variable(name) && name_index(names, count, name) < 0) {
+                names = realloc(names, (count + 1) * sizeof(char*));
+                if (!names) error_allocate_mem();
+                names[count++] = name;
+            }
+        }
+    }
+    if (count == 0) return;
+
+    CFG* cfg = build_cfg(enter);
+    int nb = cfg->num_blocks;
+    char* live_in = calloc(nb * count + 1, 1);
+    char* live_out = calloc(nb * count + 1, 1);
+    char* live = malloc(count + 1);
+    char* interferes = calloc(count * count + 1, 1);
+    if (!live_in || !live_out || !live || !interferes) error_allocate_mem();
+
+    // Liveness of every version, walking each block backwards from its live out
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int b = nb - 1; b >= 0; b--) {
+            for (int s = 0; s < 2; s++) {
+                int succ = cfg->blocks[b].succ[s];
+                if (succ < 0) continue;
+                for (int n = 0; n < count; n++) {
+                    live_out[b * count + n] |= live_in[succ * count + n];
+                }
+            }
+            memcpy(live, &live_out[b * count], count);
+            for (int i = cfg->blocks[b].end; i >= cfg->blocks[b].start; i--) {
+                INFO* dest = get_dest(&code[i]);
+                int d = dest ? name_index(names, count, dest->id.name) : -1;
+                if (d >= 0) {
+                    // A copy doesn't make its source and destination interfere, they hold the same value
+                    int src = code[i].instruct->instruct.type_instruct == I_STORE ?
+                              name_index(names, count, code[i].var1->id.name) : -1;
+                    for (int n = 0; n < count; n++) {
+                        if (live[n] && n != d && n != src) {
+                            interferes[d * count + n] = 1;
+                            interferes[n * count + d] = 1;
+                        }
+                    }
+                    live[d] = 0;
+                }
+                INFO* uses[2];
+                int num_uses = get_uses(&code[i], uses);
+                for (int u = 0; u < num_uses; u++) {
+                    int n = name_index(names, count, uses[u]->id.name);
+                    if (n >= 0) live[n] = 1;
+                }
+            }
+            if (memcmp(live, &live_in[b * count], count) != 0) {
+                memcpy(&live_in[b * count], live, count);
+                changed = 1;
+            }
+        }
+    }
+    // Parameters and variables read before any assignment all get their value at the start of the method
+    for (int a = 0; nb > 0 && a < count; a++) {
+        for (int b = 0; b < count; b++) {
+            if (a != b && live_in[a] && live_in[b]) interferes[a * count + b] = 1;
+        }
+    }
+
+    // Versions only join versions of the same variable: copies first so they disappear, then everything else
+    int* group = malloc(count * sizeof(int));
+    if (!group) error_allocate_mem();
+    for (int n = 0; n < count; n++) group[n] = n;
+    for (int i = enter + 1; i < leave; i++) {
+        if (code[i].instruct->instruct.type_instruct != I_STORE) continue;
+        int src = name_index(names, count, code[i].var1->id.name);
+        int dest = name_index(names, count, code[i].reg->id.name);
+        if (src >= 0 && dest >= 0 && same_variable(names[src], names[dest])) {
+            try_coalesce(group, interferes, count, src, dest);
+        }
+    }
+    for (int a = 0; a < count; a++) {
+        for (int b = a + 1; b < count; b++) {
+            if (same_variable(names[a], names[b])) try_coalesce(group, interferes, count, a, b);
+        }
+    }
+
+    // Each group takes the name of the variable if it holds it, or if no group of that variable does
+    char** group_name = calloc(count, sizeof(char*));
+    if (!group_name) error_allocate_mem();
+    for (int n = 0; n < count; n++) {
+        if (!strchr(names[n], '.')) group_name[find_group(group, n)] = names[n];
+    }
+    for (int n = 0; n < count; n++) {
+        int g = find_group(group, n);
+        if (group_name[g]) continue;
+        int taken = 0;
+        for (int other = 0; other < count && !taken; other++) {
+            taken = group_name[other] && !strchr(group_name[other], '.') && same_variable(group_name[other], names[n]);
+        }
+        size_t length = strcspn(names[n], ".");
+        char* base = malloc(length + 1);
+        if (!base) error_allocate_mem();
+        memcpy(base, names[n], length);
+        base[length] = '\0';
+        if (taken || is_global(base)) {
+            free(base);
+            group_name[g] = names[g];
+        } else {
+            group_name[g] = base;
+        }
+    }
+
+    for (int i = enter + 1; i < leave; i++) {
+        INFO* operands[3];
+        int num_operands = get_uses(&code[i], operands);
+        INFO* dest = get_dest(&code[i]);
+        if (dest) operands[num_operands++] = dest;
+        for (int o = 0; o < num_operands; o++) {
+            int n = name_index(names, count, operands[o]->id.name);
+            if (n >= 0) operands[o]->id.name = group_name[find_group(group, n)];
+        }
+    }
+    for (int i = leave - 1; i > enter; i--) {
+        if (code[i].instruct->instruct.type_instruct == I_STORE && strcmp(code[i].var1->id.name, code[i].reg->id.name) == 0) {
+            remove_instr(i);
+        }
+    }
+
+    free(group_name);
+    free(group);
+    free(names);
+    free(live);
+    free(live_in);
+    free(live_out);
+    free(interferes);
+    free_cfg(cfg);
+}
+
+/* Function that takes the code out of SSA form: versions of the same variable that are never live at the same time
+ * share its name again, and the copies between them are removed
+ */
+void leave_ssa() {
+    Instr* code = get_intermediate_code();
+    for (int i = 0; i < get_code_size(); i++) {
+        if (code[i].instruct->instruct.type_instruct == I_ENTER) {
+            leave_method(i);
+        }
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef SSA_H
+#define SSA_H
+
+#include "cfg.h"
+
+/* Function that promotes the local variables and parameters of every method to SSA values: every assignment
+ * defines a new version (x.1, x.2, ...) and the versions that reach a join are merged by copies at the end of the
+ * predecessors. Versions with a constant value are propagated and dead definitions removed
+ * Globals are never promoted
+ */
+void promote_variables();
+/* Function that takes the code out of SSA form: versions of the same variable that are never live at the same time
+ * share its name again, and the copies between them are removed
+ */
+void leave_ssa();
+/* Function that checks if an operand name is a local variable or parameter of a method (not a temporal,
+ * constant, label or global)
+ */
+int is_local_variable(const char* name);
+/* Function that checks if name is a value meant to be defined once in the method: a temporal or a version of a
+ * variable
+ */
+int is_ssa_value(const char* name);
+
+#endif
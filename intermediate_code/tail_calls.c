@@ -0,0 +1,179 @@
+#include "tail_calls.h"
+
+extern int remarks;
+
+// Recursive call of a method that can become a jump to its start
+typedef struct TAIL_CALL {
+    int call; // Index of the call
+    int ret; // Index of the return of its result
+    INSTR_TYPE op; // I_ADD or I_MUL when the result is combined with other before returning, else I_RET
+    INFO* other; // Operand combined with the result
+} TAIL_CALL;
+
+/* Returns the index of the first instruction after index that is not a LOAD (they don't generate code)
+ */
+static int next_instr(int index) {
+    Instr* code = get_intermediate_code();
+    index++;
+    while (code[index].instruct->instruct.type_instruct == I_LOAD) index++;
+    return index;
+}
+
+/* Checks if the call at index to the method that contains it is a tail call (its result is returned) or an
+ * accumulator call (its result plus or times a value computed before the call is returned). Saves it in tail
+ */
+static int find_tail_call(int index, int num_args, TAIL_CALL* tail) {
+    Instr* code = get_intermediate_code();
+    if (index < num_args) return 0;
+    for (int a = index - num_args; a < index; a++) {
+        if (code[a].instruct->instruct.type_instruct != I_PARAM) return 0;
+    }
+    const char* result = code[index].reg->id.name;
+    int next = next_instr(index);
+    tail->call = index;
+    tail->op = I_RET;
+    tail->other = NULL;
+    INSTR_TYPE type = code[next].instruct->instruct.type_instruct;
+    if ((type == I_ADD || type == I_MUL) && code[next].reg) {
+        INFO* var1 = code[next].var1;
+        INFO* var2 = code[next].var2;
+        tail->other = strcmp(var1->id.name, result) == 0 ? var2 : strcmp(var2->id.name, result) == 0 ? var1 : NULL;
+        if (!tail->other || strcmp(tail->other->id.name, result) == 0 || is_global(tail->other->id.name)) return 0;
+        tail->op = type;
+        result = code[next].reg->id.name;
+        next = next_instr(next);
+    }
+    tail->ret = next;
+    return code[next].instruct->instruct.type_instruct == I_RET && code[next].var1 &&
+           strcmp(code[next].var1->id.name, result) == 0;
+}
+
+/* Replaces the tail call by assignments of its arguments to the parameters and a jump to the label start. Arguments
+ * that are variables are copied first, they can be parameters assigned by the call. acc is the accumulator
+ */
+static void replace_tail_call(TAIL_CALL* tail, ARGS_LIST* params, int num_args, INFO* start, INFO* acc) {
+    Instr* code = get_intermediate_code();
+    int first = tail->call - num_args;
+    INFO* values = malloc((num_args + 1) * sizeof(INFO));
+    if (!values) error_allocate_mem();
+    for (int a = 0; a < num_args; a++) values[a] = *code[first + a].var1;
+    INFO other;
+    if (tail->other) other = *tail->other;
+    for (int i = tail->ret; i >= first; i--) remove_instr(i);
+
+    int position = first;
+    if (tail->op != I_RET) insert_instr(position++, tail->op, acc, &other, acc);
+    ARGS_LIST* param = params;
+    for (int a = 0; a < num_args; a++, param = param->next) {
+        if (is_constant(values[a].id.name) || is_temp(values[a].id.name) ||
+            strcmp(values[a].id.name, param->arg->name) == 0) {
+            continue;
+        }
+        char buf[128];
+        snprintf(buf, sizeof(buf), "%s@tail", param->arg->name);
+        INFO copy_info = values[a];
+        copy_info.id.name = my_strdup(buf);
+        insert_instr(position++, I_STORE, &values[a], NULL, &copy_info);
+        values[a] = copy_info;
+    }
+    param = params;
+    for (int a = 0; a < num_args; a++, param = param->next) {
+        if (strcmp(values[a].id.name, param->arg->name) == 0) continue;
+        INFO param_info = values[a];
+        param_info.id.name = param->arg->name;
+        insert_instr(position++, I_STORE, &values[a], NULL, &param_info);
+    }
+    insert_instr(position, I_JMP, start, NULL, NULL);
+    free(values);
+}
+
+/* Removes the tail calls of the method that starts at enter
+ */
+static void eliminate_method_tail_calls(int enter) {
+    Instr* code = get_intermediate_code();
+    const char* name = code[enter].var1->id.name;
+    INFO* decl = NULL;
+    for (AST_ROOT* cur = head_ast; cur && !decl; cur = cur->next) {
+        INFO* info = cur->sentence->info;
+        if (info->type == AST_METHOD_DECL && strcmp(info->method_decl.name, name) == 0) decl = info;
+    }
+    if (!decl) return;
+    int num_args = decl->method_decl.num_args;
+
+    int leave = enter + 1;
+    while (code[leave].instruct->instruct.type_instruct != I_LEAVE) leave++;
+    TAIL_CALL* tails = malloc((leave - enter) * sizeof(TAIL_CALL));
+    if (!tails) error_allocate_mem();
+    int count = 0;
+    INSTR_TYPE acc_op = I_RET;
+    for (int i = enter + 1; i < leave; i++) {
+        if (code[i].instruct->instruct.type_instruct != I_CALL || strcmp(code[i].var1->id.name, name) != 0 ||
+            !find_tail_call(i, num_args, &tails[count])) {
+            continue;
+        }
+        // A single accumulator, every accumulator call must combine its result with the same operation
+        INSTR_TYPE op = tails[count].op;
+        if (op != I_RET && acc_op != I_RET && op != acc_op) continue;
+        if (op != I_RET) acc_op = op;
+        count++;
+    }
+    if (count == 0) {
+        free(tails);
+        return;
+    }
+
+    INFO start_info, acc_info, identity_info;
+    start_info.type = TABLE_ID;
+    start_info.id.name = new_label();
+    acc_info.type = TABLE_ID;
+    acc_info.id.name = my_strdup("@tail");
+    identity_info.type = TABLE_ID;
+    identity_info.id.name = my_strdup(acc_op == I_MUL ? "1" : "0");
+
+    // The returns that are not accumulator calls apply the accumulator to the value they return
+    if (acc_op != I_RET) {
+        for (int i = leave - 1; i > enter; i--) {
+            if (code[i].instruct->instruct.type_instruct != I_RET || !code[i].var1) continue;
+            int is_tail = 0;
+            for (int t = 0; t < count; t++) is_tail |= tails[t].ret == i;
+            if (is_tail) continue;
+            INFO value_info = *code[i].var1;
+            INFO result_info;
+            result_info.type = TABLE_ID;
+            result_info.id.name = new_temp();
+            remove_instr(i);
+            insert_instr(i, acc_op, &acc_info, &value_info, &result_info);
+            insert_instr(i + 1, I_RET, &result_info, NULL, NULL);
+            for (int t = 0; t < count; t++) {
+                if (tails[t].call > i) {
+                    tails[t].call++;
+                    tails[t].ret++;
+                }
+            }
+        }
+    }
+    for (int t = count - 1; t >= 0; t--) {
+        replace_tail_call(&tails[t], decl->method_decl.args, num_args, &start_info, &acc_info);
+        if (remarks) {
+            fprintf(stderr, "Remark: %s call to %s in %s converted to a loop\n",
+                    tails[t].op == I_RET ? "tail" : tails[t].op == I_MUL ? "accumulator (*)" : "accumulator (+)",
+                    name, name);
+        }
+    }
+    insert_instr(enter + 1, I_LABEL, &start_info, NULL, NULL);
+    if (acc_op != I_RET) insert_instr(enter + 1, I_STORE, &identity_info, NULL, &acc_info);
+    free(tails);
+}
+
+/* Function that turns the recursive calls whose result is returned directly (return f(...)) into jumps back to the
+ * start of the method, after assigning the arguments to the parameters. Calls whose result is added to or multiplied
+ * by a value before being returned (return n * f(n - 1)) become jumps too, accumulating that value in a variable that
+ * every other return applies to its result
+ * Calls to other methods in tail position are emitted as jumps by the object code
+ */
+void eliminate_tail_calls() {
+    Instr* code = get_intermediate_code();
+    for (int enter = 0; enter < get_code_size(); enter++) {
+        if (code[enter].instruct->instruct.type_instruct == I_ENTER) eliminate_method_tail_calls(enter);
+    }
+}
@@ -0,0 +1,13 @@
+#ifndef TAIL_CALLS_H
+#define TAIL_CALLS_H
+
+#include "intermediate_code.h"
+
+/* Function that turns the recursive calls whose result is returned directly (return f(...)) into jumps back to the
+ * start of the method, after assigning the arguments to the parameters. Calls whose result is added to or multiplied
+ * by a value before being returned (return n * f(n - 1)) become jumps too, accumulating that value in a variable that
+ * every other return applies to its result
+ */
+void eliminate_tail_calls();
+
+#endif
@@ -0,0 +1,46 @@
+/* Local stand-in for the flex-generated scanner (sandbox has no flex). */
+#include "ast.h"
+#include "parser.tab.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "error_handling.h"
+#include "utils.h"
+extern int debug;
+int num_tokens = 0;
+int yylineno = 1;
+FILE *yyin = NULL;
+char yytext[1024];
+static int nextc(void){ int c = fgetc(yyin ? yyin : stdin); if (c=='\n') yylineno++; return c; }
+static void backc(int c){ if (c==EOF) return; if (c=='\n') yylineno--; ungetc(c, yyin ? yyin : stdin); }
+int yylex(void) {
+  for (;;) {
+    int c = nextc();
+    if (c == EOF) return 0;
+    if (isspace(c)) continue;
+    if (c == '/') {
+      int d = nextc();
+      if (d == '/') { while ((c = nextc()) != EOF && c != '\n'); continue; }
+      if (d == '*') { int p = 0; while ((c = nextc()) != EOF) { if (p == '*' && c == '/') break; p = c; } continue; }
+      backc(d); num_tokens++; return '/';
+    }
+    if (isdigit(c)) { int n = 0; while (isdigit(c)) { yytext[n++] = c; c = nextc(); } backc(c); yytext[n] = 0; yylval.ival = atoi(yytext); num_tokens++; return INTEGER_LITERAL; }
+    if (isalpha(c)) {
+      int n = 0; while (isalnum(c) || c == '_') { yytext[n++] = c; c = nextc(); } backc(c); yytext[n] = 0; num_tokens++;
+      static const struct { const char* k; int t; } kw[] = {{"Program",PROGRAM},{"if",IF},{"else",ELSE},{"then",THEN},{"while",WHILE},{"void",VOID},{"return",RETURN},{"extern",EXTERN},{"inline",INLINE},{"noinline",NOINLINE},{"bool",BOOL},{"integer",INTEGER},{"false",FALSE},{"true",TRUE}};
+      for (unsigned i = 0; i < sizeof kw / sizeof kw[0]; i++) if (strcmp(yytext, kw[i].k) == 0) return kw[i].t;
+      yylval.sval = my_strdup(yytext); return ID;
+    }
+    int d = nextc();
+    if (c=='&'&&d=='&') return AND; if (c=='|'&&d=='|') return OR;
+    if (c=='='&&d=='=') return EQ; if (c=='!'&&d=='=') return NEQ;
+    if (c=='<'&&d=='=') return LEQ; if (c=='>'&&d=='=') return GEQ;
+    backc(d);
+    switch (c) {
+      case '!': return NEG; case '<': return LES; case '>': return GRT;
+      case '+': case '-': case '*': case '%': case '=': case ',': case ';': case '(': case ')': case '{': case '}': return c;
+    }
+    yytext[0] = c; yytext[1] = 0; error_lexical(yylineno, yytext);
+  }
+}
@@ -29,3 +29,49 @@ int get_bool() {
     //error_get_bool();
     return -1; // This line will never be reached, but is added to avoid compiler warnings
 }
+
+// Entries of the table where the methods memoized by the compiler (-memoize) save their results
+#define MEMO_TABLE_SIZE 65536
+
+typedef struct {
+	long method; // Number of the method plus one (0 for an empty entry)
+	long args[3];
+	long value;
+} MEMO_ENTRY;
+
+static MEMO_ENTRY memo_table[MEMO_TABLE_SIZE];
+static long memo_found; // Value of the last entry found by ctds_memo_find
+
+/* Returns the entry of the memo table for the call to method with the arguments a, b and c (each call has a single
+ * entry, a call that gets the entry of another one replaces it)
+ */
+static MEMO_ENTRY* memo_entry(long method, long a, long b, long c) {
+	unsigned long hash = (unsigned long) method * 0x9E3779B97F4A7C15UL;
+	hash = (hash ^ (unsigned long) a) * 0xC2B2AE3D27D4EB4FUL;
+	hash = (hash ^ (unsigned long) b) * 0x165667B19E3779F9UL;
+	hash = (hash ^ (unsigned long) c) * 0x9E3779B97F4A7C15UL;
+	return &memo_table[(hash >> 32) & (MEMO_TABLE_SIZE - 1)];
+}
+
+long ctds_memo_find(long method, long a, long b, long c) {
+	MEMO_ENTRY* entry = memo_entry(method, a, b, c);
+	if (entry->method != method + 1 || entry->args[0] != a || entry->args[1] != b || entry->args[2] != c) {
+		return 0;
+	}
+	memo_found = entry->value;
+	return 1;
+}
+
+long ctds_memo_value() {
+	return memo_found;
+}
+
+long ctds_memo_store(long method, long a, long b, long c, long value) {
+	MEMO_ENTRY* entry = memo_entry(method, a, b, c);
+	entry->method = method + 1;
+	entry->args[0] = a;
+	entry->args[1] = b;
+	entry->args[2] = c;
+	entry->value = value;
+	return value;
+}
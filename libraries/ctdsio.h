@@ -8,5 +8,11 @@ void print_int(int s);
 void print_bool(int s);
 int get_int();
 int get_bool();
+/* Memo table of the methods memoized by the compiler: ctds_memo_find returns 1 if the result of the call to method
+ * with the arguments a, b and c is saved (ctds_memo_value returns it right after), ctds_memo_store saves it
+ */
+long ctds_memo_find(long method, long a, long b, long c);
+long ctds_memo_value();
+long ctds_memo_store(long method, long a, long b, long c, long value);
 
 #endif
\ No newline at end of file
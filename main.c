@@ -8,6 +8,16 @@
 #include "semantic_analyzer.h"
 #include "intermediate_code.h"
 #include "optimization.h"
+#include "ssa.h"
+#include "loops.h"
+#include "induction.h"
+#include "inline.h"
+#include "specialize.h"
+#include "signatures.h"
+#include "memoize.h"
+#include "evaluate.h"
+#include "layout.h"
+#include "tail_calls.h"
 #include "symbol.h"
 #include "object_code.h"
 #include <ctype.h>
@@ -27,6 +37,11 @@ typedef enum STAGE {
 
 int optimizations = 0;
 int debug = 0;
+int unroll_factor = 4; // Copies of the body of an unrolled loop (1 disables unrolling)
+int remarks = 0; // Report the transformations done to calls
+int memoize = 0; // Memoize the pure recursive methods
+char* profile = NULL; // File with the call counts that order the methods
+int linear_scan = 1; // Register allocation with -opt: linear scan, or every variable in the stack (-regalloc=none)
 
 void str_to_lower(char *s);
 
@@ -54,6 +69,11 @@ int main(int argc, char *argv[]) {
 		printf("  %-22s %s\n", "-o <file>", "Specifies the name of the output file (default: out)");
 		printf("  %-22s %s\n", "-t, -target <stage>", "Run until the indicated stage: scan | parse | codinter | assembly | executable (default: executable)");
 		printf("  %-22s %s\n", "-opt", "Enable compiler optimizations");
+		printf("  %-22s %s\n", "-unroll=<n>", "Copies of the body of unrolled loops with -opt, 1 disables unrolling (default: 4)");
+		printf("  %-22s %s\n", "-memoize", "Memoizes the pure recursive methods with -opt, their results are saved in a table of the runtime");
+		printf("  %-22s %s\n", "-profile=<file>", "Orders the methods with -opt by the call counts of a profile, with lines \"caller callee count\"");
+		printf("  %-22s %s\n", "-regalloc=<kind>", "Register allocation with -opt: linear (linear scan, default) | none (every variable in the stack)");
+		printf("  %-22s %s\n", "-remarks", "Reports the calls transformed by the optimizations (in stderr)");
 		printf("  %-22s %s\n", "-d, -debug", "Shows debugging information (AST structure, lexer tokens, intermediate code, etc.)\n");
 
 		printf("Use example:\n");
@@ -73,6 +93,33 @@ int main(int argc, char *argv[]) {
 	for (int i = 1; i < argc; i++) {
 		if (strcmp(argv[i], "-opt") == 0) {
 			optimizations = 1;
+		} else if (strncmp(argv[i], "-unroll=", 8) == 0) {
+			char* end;
+			long factor = strtol(argv[i] + 8, &end, 10);
+			if (argv[i][8] == '\0' || *end != '\0' || factor < 1 || factor > 16) {
+				fprintf(stderr, "Error: -unroll requires a factor between 1 and 16. See ctds -h for usage help.\n");
+				return 1;
+			}
+			unroll_factor = (int)factor;
+		} else if (strcmp(argv[i], "-remarks") == 0) {
+			remarks = 1;
+		} else if (strcmp(argv[i], "-memoize") == 0) {
+			memoize = 1;
+		} else if (strncmp(argv[i], "-profile=", 9) == 0) {
+			if (argv[i][9] == '\0') {
+				fprintf(stderr, "Error: -profile requires a file. See ctds -h for usage help.\n");
+				return 1;
+			}
+			profile = argv[i] + 9;
+		} else if (strncmp(argv[i], "-regalloc=", 10) == 0) {
+			if (strcmp(argv[i] + 10, "linear") == 0) {
+				linear_scan = 1;
+			} else if (strcmp(argv[i] + 10, "none") == 0) {
+				linear_scan = 0;
+			} else {
+				fprintf(stderr, "Error: -regalloc requires linear or none. See ctds -h for usage help.\n");
+				return 1;
+			}
 		} else if (strcmp(argv[i], "-debug") == 0 || strcmp(argv[i], "-d") == 0) {
 			debug = 1;
 		} else if (strcmp(argv[i], "-o") == 0) {
@@ -152,14 +199,48 @@ int main(int argc, char *argv[]) {
 	// Generate intermediate code for each top-level method declaration
 	if (stage > PARSE) {
 		reset_code();
+		rename_globals(); // Locals that shadow a global must not be taken for it
 		for (AST_ROOT* cur = head_ast; cur != NULL; cur = cur->next) {
+			INFO* info = cur->sentence->info;
+			// Methods that main never calls are left out of the program
+			if (optimizations && info->type == AST_METHOD_DECL && !info->method_decl.is_reachable) {
+				if (remarks && info->method_decl.is_extern) {
+					fprintf(stderr, "Remark: extern method %s is never called, its .extern is skipped\n", info->method_decl.name);
+				} else if (remarks) {
+					fprintf(stderr, "Remark: method %s is never called, no code is generated for it\n", info->method_decl.name);
+				}
+				continue;
+			}
 			gen_code(cur->sentence, NULL);
 		}
+		move_global_initializers(); // Globals are initialized when main starts
 		if (debug) {
 			print_temp_list(cant_ap_h); // Print temp lists before optimizations
 		}
 		if (optimizations) {
+			eliminate_tail_calls();
+			evaluate_pure_calls();
+			inline_methods();
+			specialize_methods();
+			optimize_signatures();
+			remove_uncalled_methods();
+			if (memoize) {
+				memoize_methods();
+			}
+			simplify_cfg();
+			promote_variables();
+			hoist_loop_invariants();
+			rotate_loops();
+			simplify_cfg();
+			leave_ssa();
+			unswitch_loops();
+			simplify_cfg();
+			replace_computable_loops();
+			reduce_induction_variables();
+			unroll_loops();
+			simplify_cfg();
 			optimize_memory(cant_ap_h);
+			order_methods(profile);
 		}
 		if (debug || stage == CODINTER) {
 			char inter_path[128];
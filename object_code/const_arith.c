@@ -0,0 +1,231 @@
+#include "const_arith.h"
+#include <limits.h>
+#include <stdint.h>
+
+// Latency in cycles of the instructions used to multiply by constants
+#define LAT_IMUL 3
+#define LAT_SIMPLE 1 // shl, add, sub, neg and lea with two registers
+
+// Ways of multiplying %rax by a constant without imulq
+typedef enum {
+    MUL_SHIFT, // x << shift
+    MUL_LEA, // lea (x + x * (lea1 - 1)), optionally lea again with lea2, and << shift
+    MUL_SHIFT_ADD, // (x << shift) + x, or - x if subtract
+    MUL_LEA_ADD // t = x * lea1 with lea, then lea (x + t * lea2)
+} MUL_KIND;
+
+// Sequence chosen to multiply by a constant and its latency
+typedef struct {
+    MUL_KIND kind;
+    int lea1, lea2; // Multipliers 3, 5 or 9 of the lea instructions (0 if not used), or the scale of the last lea
+    int shift;
+    int subtract;
+    int negate; // The factor is negative, the result is negated at the end
+    int latency;
+} MUL_PLAN;
+
+/* Function that computes the magic number and the shift that replace the signed division by divisor
+ * (|divisor| >= 2) with a multiplication: x / divisor = (high 64 bits of x * magic, +/- x) >> shift, plus 1 if negative
+ * Algorithm from Hacker's Delight (section 10-4) for 64 bits
+ */
+void signed_magic(long divisor, long* magic, int* shift) {
+    const uint64_t two63 = 1ULL << 63;
+    uint64_t abs_divisor = divisor < 0 ? -(uint64_t) divisor : (uint64_t) divisor;
+    uint64_t t = two63 + ((uint64_t) divisor >> 63);
+    uint64_t abs_nc = t - 1 - t % abs_divisor; // Absolute value of the largest dividend that needs no correction
+    int p = 63;
+    uint64_t q1 = two63 / abs_nc, r1 = two63 - q1 * abs_nc;
+    uint64_t q2 = two63 / abs_divisor, r2 = two63 - q2 * abs_divisor;
+    uint64_t delta;
+    do {
+        p++;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= abs_nc) {
+            q1++;
+            r1 -= abs_nc;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= abs_divisor) {
+            q2++;
+            r2 -= abs_divisor;
+        }
+        delta = abs_divisor - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+    *magic = divisor < 0 ? -(long) (q2 + 1) : (long) (q2 + 1);
+    *shift = p - 64;
+}
+
+/* Emits "op value, reg" using an immediate if the value fits in 32 bits, or %rcx otherwise
+ */
+static void emit_op_constant(FILE* out_file, const char* op, long value, const char* reg) {
+    if (value >= INT_MIN && value <= INT_MAX) {
+        fprintf(out_file, "  %s $%ld, %s\n", op, value, reg);
+    } else {
+        fprintf(out_file, "  movabsq $%ld, %%rcx\n", value);
+        fprintf(out_file, "  %s %%rcx, %s\n", op, reg);
+    }
+}
+
+/* Function that emits code that leaves in %rax the quotient (or the remainder if remainder is 1) of the signed division
+ * of the operand dividend by the constant divisor without idivq, using %rcx and %rdx as scratch registers.
+ * non_negative tells if the dividend is known to be >= 0. Returns 0 (and emits nothing) if divisor is 0
+ */
+int emit_div_by_constant(FILE* out_file, const char* dividend, long divisor, int remainder, int non_negative) {
+    if (divisor == 0 || divisor == LONG_MIN) return 0;
+    fprintf(out_file, "  movq %s, %%rax\n", dividend);
+    if (divisor == 1 || divisor == -1) {
+        if (remainder) {
+            fprintf(out_file, "  xorl %%eax, %%eax\n");
+        } else if (divisor == -1) {
+            fprintf(out_file, "  negq %%rax\n");
+        }
+        return 1;
+    }
+
+    long abs_divisor = divisor < 0 ? -divisor : divisor;
+    if ((abs_divisor & (abs_divisor - 1)) == 0) {
+        // Powers of 2: the remainder is a mask and the quotient a shift. Negative dividends add 2^k - 1 first so
+        // the result truncates towards zero (x % -2^k is the same as x % 2^k)
+        int exponent = __builtin_ctzl(abs_divisor);
+        if (!non_negative) {
+            fprintf(out_file, "  movq %%rax, %%rdx\n");
+            fprintf(out_file, "  sarq $63, %%rdx\n");
+            fprintf(out_file, "  shrq $%d, %%rdx\n", 64 - exponent); // 2^k - 1 if negative, 0 otherwise
+            fprintf(out_file, "  addq %%rdx, %%rax\n");
+        }
+        if (remainder) {
+            emit_op_constant(out_file, "andq", abs_divisor - 1, "%rax");
+            if (!non_negative) fprintf(out_file, "  subq %%rdx, %%rax\n");
+        } else {
+            fprintf(out_file, "  %s $%d, %%rax\n", non_negative ? "shrq" : "sarq", exponent);
+            if (divisor < 0) fprintf(out_file, "  negq %%rax\n");
+        }
+        return 1;
+    }
+
+    // Multiplication by the magic number, the quotient is in the high half (rdx)
+    long magic;
+    int shift;
+    signed_magic(divisor, &magic, &shift);
+    fprintf(out_file, "  movq %%rax, %%rcx\n"); // Keep the dividend
+    fprintf(out_file, "  movabsq $%ld, %%rdx\n", magic);
+    fprintf(out_file, "  imulq %%rdx\n");
+    if (divisor > 0 && magic < 0) fprintf(out_file, "  addq %%rcx, %%rdx\n");
+    if (divisor < 0 && magic > 0) fprintf(out_file, "  subq %%rcx, %%rdx\n");
+    if (shift > 0) fprintf(out_file, "  sarq $%d, %%rdx\n", shift);
+    if (!non_negative || divisor < 0) {
+        // Add 1 to negative quotients so they truncate towards zero
+        fprintf(out_file, "  movq %%rdx, %%rax\n");
+        fprintf(out_file, "  shrq $63, %%rax\n");
+        fprintf(out_file, "  addq %%rax, %%rdx\n");
+    }
+    if (remainder) {
+        // x - (x / divisor) * divisor
+        if (divisor >= INT_MIN && divisor <= INT_MAX) {
+            fprintf(out_file, "  imulq $%ld, %%rdx\n", divisor);
+        } else {
+            fprintf(out_file, "  movabsq $%ld, %%rax\n", divisor);
+            fprintf(out_file, "  imulq %%rax, %%rdx\n");
+        }
+        fprintf(out_file, "  movq %%rcx, %%rax\n");
+        fprintf(out_file, "  subq %%rdx, %%rax\n");
+    } else {
+        fprintf(out_file, "  movq %%rdx, %%rax\n");
+    }
+    return 1;
+}
+
+/* Saves in plan the cheapest sequence of simple instructions that multiplies by factor >= 0 (latency
+ * is INT_MAX when there is none)
+ */
+static void plan_multiplication(long factor, MUL_PLAN* plan) {
+    static const int lea_factors[] = {3, 5, 9};
+    plan->latency = INT_MAX;
+    if (factor <= 1 || (factor & (factor - 1)) == 0) {
+        plan->kind = MUL_SHIFT;
+        plan->shift = factor <= 1 ? 0 : __builtin_ctzl(factor);
+        plan->latency = plan->shift > 0 ? LAT_SIMPLE : 0;
+        return;
+    }
+    int trailing = __builtin_ctzl(factor);
+    long odd = factor >> trailing;
+    int shift_latency = trailing > 0 ? LAT_SIMPLE : 0;
+    for (int a = 0; a < 3; a++) {
+        // factor = lea1 (* lea2) * 2^k
+        for (int b = -1; b < 3; b++) {
+            long product = lea_factors[a] * (b < 0 ? 1 : lea_factors[b]);
+            int latency = LAT_SIMPLE * (b < 0 ? 1 : 2) + shift_latency;
+            if (product == odd && latency < plan->latency) {
+                plan->kind = MUL_LEA;
+                plan->lea1 = lea_factors[a];
+                plan->lea2 = b < 0 ? 0 : lea_factors[b];
+                plan->shift = trailing;
+                plan->latency = latency;
+            }
+        }
+        // factor = 1 + scale * lea1 (the last lea adds x to the scaled first result)
+        for (int scale = 2; scale <= 8; scale *= 2) {
+            if (factor == 1 + scale * lea_factors[a] && 2 * LAT_SIMPLE < plan->latency) {
+                plan->kind = MUL_LEA_ADD;
+                plan->lea1 = lea_factors[a];
+                plan->lea2 = scale;
+                plan->latency = 2 * LAT_SIMPLE;
+            }
+        }
+    }
+    // factor = 2^k + 1 or 2^k - 1 (the copy of x runs in parallel with the shift)
+    for (int subtract = 0; subtract < 2; subtract++) {
+        long rest = subtract ? factor + 1 : factor - 1;
+        if (rest > 0 && (rest & (rest - 1)) == 0 && 2 * LAT_SIMPLE < plan->latency) {
+            plan->kind = MUL_SHIFT_ADD;
+            plan->shift = __builtin_ctzl(rest);
+            plan->subtract = subtract;
+            plan->latency = 2 * LAT_SIMPLE;
+        }
+    }
+}
+
+/* Function that emits code that leaves in %rax the product of the operand by the constant factor. Uses lea, shl,
+ * add and sub (%rcx as scratch register) when they have less latency than imulq
+ */
+void emit_mul_by_constant(FILE* out_file, const char* operand, long factor) {
+    MUL_PLAN plan;
+    plan.latency = INT_MAX;
+    if (factor != LONG_MIN) {
+        plan_multiplication(factor < 0 ? -factor : factor, &plan);
+        plan.negate = factor < 0;
+        if (plan.negate && plan.latency != INT_MAX) plan.latency += LAT_SIMPLE;
+    }
+    if (factor == 0) {
+        fprintf(out_file, "  xorl %%eax, %%eax\n");
+        return;
+    }
+    fprintf(out_file, "  movq %s, %%rax\n", operand);
+    if (plan.latency >= LAT_IMUL) {
+        emit_op_constant(out_file, "imulq", factor, "%rax");
+        return;
+    }
+    switch (plan.kind) {
+        case MUL_SHIFT:
+            break;
+        case MUL_LEA:
+            fprintf(out_file, "  leaq (%%rax,%%rax,%d), %%rax\n", plan.lea1 - 1);
+            if (plan.lea2) fprintf(out_file, "  leaq (%%rax,%%rax,%d), %%rax\n", plan.lea2 - 1);
+            break;
+        case MUL_SHIFT_ADD:
+            fprintf(out_file, "  movq %%rax, %%rcx\n");
+            fprintf(out_file, "  shlq $%d, %%rax\n", plan.shift);
+            fprintf(out_file, "  %s %%rcx, %%rax\n", plan.subtract ? "subq" : "addq");
+            plan.shift = 0;
+            break;
+        case MUL_LEA_ADD:
+            fprintf(out_file, "  leaq (%%rax,%%rax,%d), %%rcx\n", plan.lea1 - 1);
+            fprintf(out_file, "  leaq (%%rax,%%rcx,%d), %%rax\n", plan.lea2);
+            plan.shift = 0;
+            break;
+    }
+    if (plan.shift > 0) fprintf(out_file, "  shlq $%d, %%rax\n", plan.shift);
+    if (plan.negate) fprintf(out_file, "  negq %%rax\n");
+}
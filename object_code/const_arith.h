@@ -0,0 +1,20 @@
+#ifndef CONST_ARITH_H
+#define CONST_ARITH_H
+
+#include <stdio.h>
+
+/* Function that computes the magic number and the shift that replace the signed division by divisor
+ * (|divisor| >= 2) with a multiplication: x / divisor = (high 64 bits of x * magic, +/- x) >> shift, plus 1 if negative
+ */
+void signed_magic(long divisor, long* magic, int* shift);
+/* Function that emits code that leaves in %rax the quotient (or the remainder if remainder is 1) of the signed division
+ * of the operand dividend by the constant divisor without idivq, using %rcx and %rdx as scratch registers.
+ * non_negative tells if the dividend is known to be >= 0. Returns 0 (and emits nothing) if divisor is 0
+ */
+int emit_div_by_constant(FILE* out_file, const char* dividend, long divisor, int remainder, int non_negative);
+/* Function that emits code that leaves in %rax the product of the operand by the constant factor. Uses lea, shl,
+ * add and sub (%rcx as scratch register) when they have less latency than imulq
+ */
+void emit_mul_by_constant(FILE* out_file, const char* operand, long factor);
+
+#endif
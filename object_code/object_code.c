@@ -1,36 +1,63 @@
 #include "object_code.h"
 #include "utils.h"
 
-static VarLocation var_map[MAX_VARS_PER_FUNCTION];
-static int var_count = 0;
-static int current_stack_offset = 0;
-
-int reused_offset[MAX_VARS_PER_FUNCTION];
+extern int optimizations;
+extern int remarks;
+extern int linear_scan;
+
+// Methods of the program in the order of the code, and the position of each one by name (see build_method_table)
+static METHOD_INFO* methods = NULL;
+static int num_methods = 0;
+static NAME_TABLE method_index = {NULL, NULL, 0, 0};
+// Names of the global variables
+static NAME_TABLE globals = {NULL, NULL, 0, 0};
+// Method being generated, and the frame whose variables are being mapped or used
+static METHOD_INFO* current = NULL;
+static FRAME_LAYOUT* frame = NULL;
+
+// Stack slots whose variables are dead, the next spilled variable takes one of them (see map_variables)
+static int* reused_offset = NULL;
 static int reused_offset_count = 0;
 // Argument registers for x86-64 calling convention
 const char* arg_regs[] = {"%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9"};
+// Argument registers of the internal convention: the System V ones followed by the other caller-saved registers that
+// the generated code never uses as scratch
+const char* internal_arg_regs[] = {"%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9", "%r10", "%r11"};
+// Register the stack slots of the method being generated are relative to: %rsp for the methods without a frame
+static const char* frame_base = "%rbp";
+// Value ranges of the method being generated (only computed with optimizations)
+static RANGE_INFO* ranges = NULL;
+
+/* Adds the location of a variable to the frame, making it bigger when it is full
+ */
+static VarLocation* add_var_location(const char* name, int offset, const char* reg) {
+    if (frame->count == frame->capacity) {
+        frame->capacity = frame->capacity ? frame->capacity * 2 : 64;
+        frame->vars = realloc(frame->vars, frame->capacity * sizeof(VarLocation));
+        if (!frame->vars) error_allocate_mem();
+    }
+    frame->vars[frame->count] = (VarLocation){my_strdup(name), offset, reg, 0};
+    table_put(&frame->index, frame->vars[frame->count].name, frame->count);
+    return &frame->vars[frame->count++];
+}
 
-/* Get the stack offset for a variable
+/* Get the location of a variable (its register, or its stack offset)
  * If the variable is not yet mapped, assign a new offset
  * Stack grows downwards, so offsets are negative
  */
-static int get_var_offset(const char* name) {
-    for (int i = 0; i < var_count; ++i) {
-        if (strcmp(var_map[i].name, name) == 0) {
-            return var_map[i].offset;
-        }
+static VarLocation* get_var_location(const char* name) {
+    int position = table_get(&frame->index, name);
+    if (position >= 0) {
+        return &frame->vars[position];
     }
-    current_stack_offset -= 8; // Allocate 8 bytes for the new variable
-    var_map[var_count].name = my_strdup(name);
-    var_map[var_count].offset = current_stack_offset; // Set offset for variable
-    var_count++;
-    return current_stack_offset;
+    frame->offset -= 8; // Allocate 8 bytes for the new variable
+    return add_var_location(name, frame->offset, NULL);
 }
 
 /* Get the operand string for a given variable
  * Handles variables, constants, and labels
  * Formats the operand appropriately for assembly output
- * Variables are accessed via their stack offset
+ * Variables are accessed via their register or their stack offset, globals by their label in .data
  * Constants are prefixed with '$'
  * Labels are used directly
  */
@@ -46,135 +73,599 @@ static void get_operand_str(INFO* var, char* buf, size_t buf_size) {
         snprintf(buf, buf_size, "%s", name);
     } else if (isdigit(name[0]) || (name[0] == '-' && isdigit(name[1]))) {
         snprintf(buf, buf_size, "$%s", name);
+    } else if (table_get(&globals, name) >= 0) {
+        snprintf(buf, buf_size, "%s(%%rip)", name);
+    } else {
+        VarLocation* location = get_var_location(name);
+        if (location->reg) {
+            snprintf(buf, buf_size, "%s", location->reg);
+        } else {
+            snprintf(buf, buf_size, "%d(%s)", location->offset, frame_base);
+        }
+    }
+}
+
+/* Checks if the operand string is a register
+ */
+static int is_register(const char* operand) {
+    return operand[0] == '%';
+}
+
+/* Checks if the operand is never negative when the instruction at index runs (only known with optimizations)
+ */
+static int known_non_negative(int index, INFO* var) {
+    return ranges && is_non_negative(ranges, index, var->id.name);
+}
+
+/* Returns 1 and saves in value the constant the operand holds when the instruction at index runs (literals, or
+ * operands with a single possible value when optimizing)
+ */
+static int known_constant(int index, INFO* var, long* value) {
+    if (is_constant(var->id.name)) {
+        *value = strtol(var->id.name, NULL, 10);
+        return 1;
+    }
+    if (!ranges) return 0;
+    RANGE range = range_before(ranges, index, var->id.name);
+    *value = range.low;
+    return range.low == range.high;
+}
+
+/* Checks if the label defined at index is the target of a jump that comes after it in the same method, which makes it
+ * the header of a loop
+ */
+static int is_loop_header(int index) {
+    Instr* code = get_intermediate_code();
+    int label = table_get(&current->labels, code[index].var1->id.name);
+    return label >= 0 && current->last_jump[label] > index;
+}
+
+/* Counts the jumps of the method being generated whose target is label
+ */
+static int jumps_to_label(const char* label) {
+    int position = table_get(&current->labels, label);
+    return position >= 0 ? current->jumps[position] : 0;
+}
+
+/* Checks if the instruction at index defines a label with the given name, or starts a run of labels that has it
+ */
+static int is_label(int index, const char* label) {
+    Instr* code = get_intermediate_code();
+    for (; index < get_code_size() && code[index].instruct->instruct.type_instruct == I_LABEL; index++) {
+        if (strcmp(code[index].var1->id.name, label) == 0) return 1;
+    }
+    return 0;
+}
+
+/* Checks if the instruction can run even when its branch isn't taken: a copy or a single cheap operation that can't
+ * fault and has no side effects besides its destination
+ */
+static int is_cheap_arm(Instr* instr) {
+    switch (instr->instruct->instruct.type_instruct) {
+        case I_STORE: case I_LOADVAL: case I_ADD: case I_SUB: case I_AND: case I_OR: case I_MIN:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/* Emits the computation of the value the instruction assigns, leaving it in reg (uses %rdx as scratch)
+ */
+static void emit_arm_value(FILE* out_file, Instr* instr, const char* reg) {
+    char op1[64], op2[64];
+    get_operand_str(instr->var1, op1, sizeof(op1));
+    fprintf(out_file, "  movq %s, %s\n", op1, reg);
+    INSTR_TYPE type = instr->instruct->instruct.type_instruct;
+    if (type == I_MIN) {
+        fprintf(out_file, "  negq %s\n", reg);
+    } else if (type != I_STORE && type != I_LOADVAL) {
+        get_operand_str(instr->var2, op2, sizeof(op2));
+        const char* op_str = type == I_ADD ? "addq" : type == I_SUB ? "subq" : type == I_AND ? "andq" : "orq";
+        fprintf(out_file, "  %s %s, %s\n", op_str, op2, reg);
+    }
+}
+
+/* Returns the condition code that holds when the conditional jump is taken (negated if negate is 1)
+ */
+static const char* jump_condition(INSTR_TYPE type, int negate) {
+    switch (type) {
+        case I_JLES: return negate ? "ge" : "l";
+        case I_JGRT: return negate ? "le" : "g";
+        case I_JEQ:  return negate ? "ne" : "e";
+        case I_JNEQ: return negate ? "e" : "ne";
+        case I_JLEQ: return negate ? "g" : "le";
+        case I_JGEQ: return negate ? "l" : "ge";
+        case I_JMPF: return negate ? "nz" : "z";
+        default:     return negate ? "z" : "nz";
+    }
+}
+
+/* Returns how many instructions the if-conversion of the conditional jump at index takes: 2 for a branch that skips
+ * a single cheap assignment (triangle), 5 for one that chooses between two cheap assignments to the same destination
+ * (diamond, also when both sides end returning the same value), 0 if it has neither shape
+ */
+static int select_shape(int index) {
+    Instr* code = get_intermediate_code();
+    const char* target = code[index].reg->id.name;
+    if (index + 2 >= get_code_size() || !is_cheap_arm(&code[index + 1])) return 0;
+    // Triangle: the destination keeps its value when the jump is taken
+    if (is_label(index + 2, target)) return 2;
+    // Diamond: "J L0; X1; JMP L1 (or RET r); L0: X2; L1: (or RET r)", where only the jump reaches L0
+    if (index + 5 >= get_code_size() || code[index + 3].instruct->instruct.type_instruct != I_LABEL ||
+        strcmp(code[index + 3].var1->id.name, target) != 0 || !is_cheap_arm(&code[index + 4]) ||
+        strcmp(code[index + 4].reg->id.name, code[index + 1].reg->id.name) != 0 || jumps_to_label(target) != 1) {
+        return 0;
+    }
+    Instr* exit = &code[index + 2];
+    Instr* join = &code[index + 5];
+    INSTR_TYPE exit_type = exit->instruct->instruct.type_instruct;
+    int joins = exit_type == I_JMP && is_label(index + 5, exit->var1->id.name);
+    int returns = exit_type == I_RET && join->instruct->instruct.type_instruct == I_RET && exit->var1 &&
+                  join->var1 && strcmp(exit->var1->id.name, join->var1->id.name) == 0;
+    return joins || returns ? 5 : 0;
+}
+
+/* If-conversion of the conditional jump at index: a triangle or diamond (see select_shape) becomes the computation
+ * of both values and a cmov, so data-dependent branches (min, max, clamp) can't be mispredicted. Only arms of one
+ * instruction are converted, running both costs less than a misprediction. Returns how many instructions were
+ * converted (0 if the jump doesn't have one of these shapes)
+ */
+static int emit_select(FILE* out_file, int index) {
+    Instr* code = get_intermediate_code();
+    Instr* jump = &code[index];
+    INSTR_TYPE type = jump->instruct->instruct.type_instruct;
+    int consumed = select_shape(index);
+    if (consumed == 0) return 0;
+    Instr* fall = &code[index + 1];
+    char dest[64], op1[64], op2[64];
+    get_operand_str(fall->reg, dest, sizeof(dest));
+
+    const char* cond;
+    if (consumed == 2) {
+        emit_arm_value(out_file, fall, "%rcx");
+        fprintf(out_file, "  movq %s, %%rax\n", dest);
+        cond = jump_condition(type, 1);
     } else {
-        snprintf(buf, buf_size, "%d(%%rbp)", get_var_offset(name));
+        emit_arm_value(out_file, fall, "%rax");
+        emit_arm_value(out_file, &code[index + 4], "%rcx");
+        cond = jump_condition(type, 0);
+    }
+    get_operand_str(jump->var1, op1, sizeof(op1));
+    if (!is_register(op1)) {
+        fprintf(out_file, "  movq %s, %%rdx\n", op1);
+        strcpy(op1, "%rdx");
+    }
+    if (type == I_JMPF || type == I_JMPT) {
+        fprintf(out_file, "  testq %s, %s\n", op1, op1);
+    } else {
+        get_operand_str(jump->var2, op2, sizeof(op2));
+        fprintf(out_file, "  cmpq %s, %s\n", op2, op1);
+    }
+    fprintf(out_file, "  cmov%s %%rcx, %%rax\n", cond);
+    fprintf(out_file, "  movq %%rax, %s\n", dest);
+    return consumed;
+}
+
+/* Returns the index of the return of the result of the call at index, or of the end of the method when the call is
+ * the last instruction (-1 if the call is followed by something else)
+ */
+static int tail_call_return(int index) {
+    Instr* code = get_intermediate_code();
+    int next = index + 1;
+    while (next < get_code_size() && code[next].instruct->instruct.type_instruct == I_LOAD) next++;
+    if (next >= get_code_size()) return -1;
+    INSTR_TYPE type = code[next].instruct->instruct.type_instruct;
+    if (type == I_LEAVE || (type == I_RET && !code[next].var1)) return next;
+    if (type == I_RET && code[index].reg && strcmp(code[next].var1->id.name, code[index].reg->id.name) == 0) {
+        return next;
+    }
+    return -1;
+}
+
+/* Returns the method name of the program (NULL if it has no code, like the extern methods)
+ */
+static METHOD_INFO* find_method(const char* name) {
+    int position = table_get(&method_index, name);
+    return position >= 0 ? &methods[position] : NULL;
+}
+
+/* Checks if the method name uses the internal calling convention (only with optimizations): methods of the program
+ * other than main are only called by the generated code, so they don't need to follow System V. They take
+ * INTERNAL_ARG_REGS arguments in registers, only save the ones they read, and are local symbols
+ */
+static int is_internal_method(const char* name) {
+    METHOD_INFO* method = find_method(name);
+    return method && method->internal;
+}
+
+/* Returns the argument registers of the calling convention of the method name, saving how many there are in count
+ */
+static const char** argument_registers(const char* name, int* count) {
+    int internal = is_internal_method(name);
+    *count = internal ? INTERNAL_ARG_REGS : SYSV_ARG_REGS;
+    return internal ? internal_arg_regs : arg_regs;
+}
+
+/* Checks if the method name returns its bool result in the zero flag too (every return tests %rax), so a caller
+ * that only branches on the result jumps right after the call
+ */
+static int returns_in_flags(const char* name) {
+    METHOD_INFO* method = find_method(name);
+    return method && method->internal && method->returns_bool;
+}
+
+/* Checks if the internal method can run without a frame: it makes no calls, takes all its arguments in registers,
+ * and its stack slots fit in the red zone below %rsp (RED_ZONE_SIZE bytes that signal handlers leave untouched), so
+ * they are addressed from %rsp and the prologue and epilogue are skipped
+ */
+static int is_frameless(METHOD_INFO* method, int frame_size) {
+    return method->internal && frame_size <= RED_ZONE_SIZE && method->num_args <= INTERNAL_ARG_REGS &&
+           !method->has_calls;
+}
+
+/* Counts a jump of the method to label at index
+ */
+static void add_jump(METHOD_INFO* method, const char* label, int index, int* capacity) {
+    int position = table_get(&method->labels, label);
+    if (position < 0) {
+        position = method->labels.count;
+        if (position == *capacity) {
+            *capacity = *capacity ? *capacity * 2 : 8;
+            method->jumps = realloc(method->jumps, *capacity * sizeof(int));
+            method->last_jump = realloc(method->last_jump, *capacity * sizeof(int));
+            if (!method->jumps || !method->last_jump) error_allocate_mem();
+        }
+        table_put(&method->labels, label, position);
+        method->jumps[position] = 0;
+    }
+    method->jumps[position]++;
+    method->last_jump[position] = index;
+}
+
+/* Finds the methods of the program and what the generation of their code needs (where they start and end, their
+ * declarations and arguments, the jumps to their labels, if they make calls), and the global variables. It goes
+ * over the code and the AST once, so emitting the code doesn't need to search them again for each method
+ */
+static void build_method_table() {
+    Instr* code = get_intermediate_code();
+    int code_size = get_code_size();
+    for (int i = 0; i < code_size; i++) {
+        if (code[i].instruct->instruct.type_instruct == I_ENTER) num_methods++;
+    }
+    methods = calloc(num_methods + 1, sizeof(METHOD_INFO));
+    if (!methods) error_allocate_mem();
+    METHOD_INFO* method = NULL;
+    int label_capacity = 0;
+    for (int i = 0, m = 0; i < code_size; i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        if (type == I_ENTER) {
+            method = &methods[m];
+            method->name = code[i].var1->id.name;
+            method->enter = method->leave = i;
+            table_put(&method_index, method->name, m++);
+            label_capacity = 0;
+        } else if (!method) {
+            continue;
+        } else if (type == I_LEAVE) {
+            method->leave = i;
+        } else if (type == I_CALL) {
+            method->has_calls = 1;
+        } else if (type == I_JMP) {
+            add_jump(method, code[i].var1->id.name, i, &label_capacity);
+        } else if (is_cond_jump(type)) {
+            add_jump(method, code[i].reg->id.name, i, &label_capacity);
+        }
+    }
+    for (AST_ROOT* cur = head_ast; cur; cur = cur->next) {
+        INFO* info = cur->sentence->info;
+        if (info->type == AST_METHOD_DECL) {
+            method = find_method(info->method_decl.name);
+            if (method && !method->node) method->node = cur->sentence;
+        } else if (info->type == AST_COMMON && info->common.op == OP_DECL) {
+            table_put(&globals, info->common.left->info->leaf.value->id_leaf->info->id.name, 1);
+        }
+    }
+    for (int m = 0; m < num_methods; m++) {
+        method = &methods[m];
+        INFO* decl = method->node ? method->node->info : NULL;
+        for (ARGS_LIST* arg = decl ? decl->method_decl.args : NULL; arg; arg = arg->next) method->num_args++;
+        method->args = malloc((method->num_args + 1) * sizeof(char*));
+        if (!method->args) error_allocate_mem();
+        int a = 0;
+        for (ARGS_LIST* arg = decl ? decl->method_decl.args : NULL; arg; arg = arg->next) {
+            method->args[a++] = arg->arg->name;
+        }
+        method->internal = optimizations && strcmp(method->name, "main") != 0 && decl && !decl->method_decl.is_extern;
+        method->returns_bool = decl && decl->method_decl.return_type == RETURN_BOOL;
+        method->is_cold = is_cold_method(method->name);
+    }
+}
+
+/* Frees the method table
+ */
+static void free_method_table() {
+    for (int m = 0; m < num_methods; m++) {
+        free(methods[m].args);
+        free(methods[m].jumps);
+        free(methods[m].last_jump);
+        table_free(&methods[m].labels);
+    }
+    free(methods);
+    methods = NULL;
+    num_methods = 0;
+    table_free(&method_index);
+    table_free(&globals);
+}
+
+/* Assigns registers to the variables of the method (see allocate_registers), none with -regalloc=none (the live
+ * intervals still let the variables share stack slots). A method that may run without a frame only gets
+ * callee-saved registers when the caller-saved ones aren't enough, saving them needs one
+ */
+static REG_ALLOCATION* allocate_method_registers(METHOD_INFO* method, const char** regs, int num_regs) {
+    int leaf = is_frameless(method, 0);
+    int classes = !linear_scan ? 0 : leaf ? REG_CALLER_SAVED : REG_CALLER_SAVED | REG_CALLEE_SAVED;
+    REG_ALLOCATION* result = allocate_registers(method->enter, method->args, method->num_args, regs, num_regs,
+                                                classes);
+    if (linear_scan && leaf && result->num_spilled > 0) {
+        free_allocation(result);
+        result = allocate_registers(method->enter, method->args, method->num_args, regs, num_regs,
+                                    REG_CALLER_SAVED | REG_CALLEE_SAVED);
+    }
+    if (remarks && linear_scan) {
+        fprintf(stderr, "Remark: method %s keeps %d variables in registers and %d in the stack\n", method->name,
+                result->count, result->num_spilled);
+    }
+    return result;
+}
+
+/* Maps the variables of the method that has an allocation, after reserving the stack slots where the prologue saves
+ * the callee-saved registers it uses (right below the saved %rbp). Spilled variables whose live intervals don't
+ * overlap share stack slots: in the order their intervals start, a variable takes the slot of one that is already
+ * dead (the interval graph is colored greedily), or a new slot if there is none. Saves in unshared_size the bytes
+ * the spilled variables would take with a slot for each one, and in shared_size the bytes they take
+ */
+static void map_variables(int* unshared_size, int* shared_size) {
+    *unshared_size = 0;
+    *shared_size = 0;
+    REG_ALLOCATION* allocation = frame->allocation;
+    if (!allocation) return;
+    frame->offset -= 8 * allocation->num_saved;
+    reused_offset = realloc(reused_offset, (allocation->count + 1) * sizeof(int));
+    int* slot_offset = malloc((allocation->count + 1) * sizeof(int)); // Slots of the variables alive
+    int* slot_end = malloc((allocation->count + 1) * sizeof(int)); // Where the interval of each one ends
+    if (!reused_offset || !slot_offset || !slot_end) error_allocate_mem();
+    reused_offset_count = 0;
+    int num_slots = 0;
+    for (int a = 0; a < allocation->count; a++) {
+        REG_ASSIGNMENT* assignment = &allocation->assignments[a];
+        if (assignment->reg) {
+            add_var_location(assignment->name, 0, assignment->reg);
+            continue;
+        }
+        for (int k = 0; k < num_slots; k++) {
+            if (slot_end[k] >= assignment->start) continue;
+            reused_offset[reused_offset_count++] = slot_offset[k];
+            slot_offset[k] = slot_offset[--num_slots];
+            slot_end[k--] = slot_end[num_slots];
+        }
+        if (reused_offset_count == 0) {
+            frame->offset -= 8;
+            reused_offset[reused_offset_count++] = frame->offset;
+            *shared_size += 8;
+        }
+        int offset = reused_offset[--reused_offset_count];
+        slot_offset[num_slots] = offset;
+        slot_end[num_slots++] = assignment->end;
+        add_var_location(assignment->name, offset, NULL);
+        *unshared_size += 8;
+    }
+    free(slot_offset);
+    free(slot_end);
+}
+
+/* Returns size rounded up to a multiple of 16 bytes (the alignment of the stack)
+ */
+static int align_frame(int size) {
+    return size % 16 != 0 ? size + 16 - size % 16 : size;
+}
+
+/* Builds the frame of the method: the arguments that don't fit in its num_regs argument registers stay in the stack
+ * slots where the caller pushed them (above the return address), the allocated variables go to their registers or
+ * shared slots, and the rest get a slot of their own. The instructions that read each variable are counted too
+ */
+static void build_frame(METHOD_INFO* method, const char** regs, int num_regs) {
+    Instr* code = get_intermediate_code();
+    frame = &method->frame;
+    for (int a = num_regs; a < method->num_args; a++) {
+        add_var_location(method->args[a], 16 + (a - num_regs) * 8, NULL);
+    }
+    if (optimizations) {
+        frame->allocation = allocate_method_registers(method, regs, num_regs);
+    }
+    int unshared_size, shared_size;
+    map_variables(&unshared_size, &shared_size);
+    for (int k = method->enter + 1; k < method->leave; ++k) {
+        // Every variable used in the method gets its location (calls name a method, not a variable)
+        INFO* operands[3] = {code[k].instruct->instruct.type_instruct == I_CALL ? NULL : code[k].var1,
+                             code[k].var2, code[k].reg};
+        for (int o = 0; o < 3; o++) {
+            if (operands[o] && is_allocatable(operands[o]->id.name)) get_var_location(operands[o]->id.name);
+        }
+        INFO* uses[2];
+        int num_uses = get_uses(&code[k], uses);
+        for (int u = 0; u < num_uses; u++) {
+            int position = uses[u] && uses[u]->id.name ? table_get(&frame->index, uses[u]->id.name) : -1;
+            if (position >= 0) frame->vars[position].reads++;
+        }
+    }
+    // System V methods save every argument that comes in a register
+    for (int a = 0; !method->internal && a < method->num_args; a++) {
+        get_var_location(method->args[a]);
+    }
+    int size = -frame->offset;
+    if (frame->allocation && remarks) {
+        fprintf(stderr, "Remark: frame of method %s takes %d bytes, %d with a stack slot for each variable\n",
+                method->name, align_frame(size), align_frame(size + unshared_size - shared_size));
+    }
+    frame->frameless = is_frameless(method, size) && (!frame->allocation || !frame->allocation->num_saved);
+    if (frame->frameless && remarks) {
+        fprintf(stderr, "Remark: leaf method %s runs without a frame, its %d bytes of variables are in the red "
+                "zone\n", method->name, size);
+    }
+    // Align stack to 16 bytes
+    frame->size = align_frame(size);
+}
+
+/* Frees the frame of the method being generated
+ */
+static void free_frame() {
+    for (int v = 0; v < frame->count; ++v) free(frame->vars[v].name);
+    free(frame->vars);
+    table_free(&frame->index);
+    free_allocation(frame->allocation);
+    *frame = (FRAME_LAYOUT){0};
+}
+
+/* Emits the saving of the callee-saved registers the method uses in their stack slots, or their restoring
+ */
+static void emit_callee_saved(FILE* out_file, int restore) {
+    REG_ALLOCATION* allocation = frame->allocation;
+    for (int r = 0; allocation && r < allocation->num_saved; r++) {
+        if (restore) {
+            fprintf(out_file, "  movq %d(%%rbp), %s\n", -8 * (r + 1), allocation->saved[r]);
+        } else {
+            fprintf(out_file, "  movq %s, %d(%%rbp)\n", allocation->saved[r], -8 * (r + 1));
+        }
+    }
+}
+
+/* Emits the global variables in the .data section, starting at 0 (main initializes them when it starts)
+ */
+static void emit_globals(FILE* out_file) {
+    int first = 1;
+    for (AST_ROOT* cur = head_ast; cur; cur = cur->next) {
+        INFO* info = cur->sentence->info;
+        if (info->type != AST_COMMON || info->common.op != OP_DECL) continue;
+        if (first) fprintf(out_file, ".data\n");
+        first = 0;
+        fprintf(out_file, "%s:\n  .quad 0\n", info->common.left->info->leaf.value->id_leaf->info->id.name);
     }
 }
 
 /* Main function to generate x86-64 assembly code from intermediate code
  * Outputs the assembly code to the provided file pointer
  * Handles function prologues/epilogues, arithmetic operations, control flow, and function calls
- * Uses a simple mapping of temporaries to stack offsets
+ * The methods and their frames are found first, then the code is emitted in a single pass
  */
 void generate_object_code(FILE* out_file, CANT_AP_TEMP* temp_list) {
     Instr* code = get_intermediate_code();
     int code_size = get_code_size();
     int param_count = 0;
     int stack_params = 0; // Count parameters that need to go on stack
+    int call_params = 0, call_regs = SYSV_ARG_REGS; // Arguments of the call being emitted, and how many go in registers
+    const char** call_arg_regs = arg_regs;
+    int method_count = 0; // Methods already found in the code
+    int cold_section = 0; // The cold methods have started (see order_methods)
 
+    build_method_table();
+    emit_globals(out_file);
     fprintf(out_file, ".text\n");
 
     for (int i = 0; i < code_size; ++i) {
         Instr* instr = &code[i]; // Get instruction from intermediate code structure
         char op1[64], op2[64], dest[64]; // Buffers for operand strings
 
+        if (optimizations && is_cond_jump(instr->instruct->instruct.type_instruct)) {
+            // Small if-then(-else) that only assign a value become a conditional move
+            int converted = emit_select(out_file, i);
+            if (converted) {
+                i += converted - 1;
+                continue;
+            }
+        }
+
         switch (instr->instruct->instruct.type_instruct) {
             case I_EXTERN:
                 fprintf(out_file, ".extern %s\n", instr->var1->id.name);
                 break;
 
             case I_ENTER: {
-                const char* func_name = instr->var1->id.name;
-                AST_NODE* func_node = NULL;
-                // Search for the function declaration node in the AST
-                for (AST_ROOT* cur = head_ast; cur != NULL; cur = cur->next) {
-                    if (cur->sentence->info->type == AST_METHOD_DECL &&
-                        strcmp(cur->sentence->info->method_decl.name, func_name) == 0) {
-                        func_node = cur->sentence;
-                        break;
-                    }
+                current = &methods[method_count++];
+                const char* func_name = current->name;
+                int num_regs;
+                const char** regs = argument_registers(func_name, &num_regs);
+                if (optimizations) {
+                    ranges = analyze_ranges(i);
                 }
+                build_frame(current, regs, num_regs);
+                frame_base = frame->frameless ? "%rsp" : "%rbp";
 
-                var_count = 0;
-                current_stack_offset = 0;
-                int end_func_idx = i;
-                // Search for the I_LEAVE instr for this function
-                for (int j = i + 1; j < code_size; ++j) {
-                    if (code[j].instruct->instruct.type_instruct == I_LEAVE &&
-                        strcmp(code[j].var1->id.name, func_name) == 0) {
-                        end_func_idx = j;
-                        break;
-                    }
-                }
-                for (int k = i; k <= end_func_idx; ++k) {
-                    // Get stack offsets for all variables used in the function
-                    if (code[k].var1 && code[k].var1->id.name && !isdigit(code[k].var1->id.name[0]) && code[k].var1->id.name[0] != '_') get_var_offset(code[k].var1->id.name);
-                    if (code[k].var2 && code[k].var2->id.name && !isdigit(code[k].var2->id.name[0]) && code[k].var2->id.name[0] != '_') get_var_offset(code[k].var2->id.name);
-                    if (code[k].reg  && code[k].reg->id.name  && !isdigit(code[k].reg->id.name[0])  && code[k].reg->id.name[0] != '_') get_var_offset(code[k].reg->id.name);
-                }
-                int total_stack_size = -current_stack_offset;
-                // Align stack to 16 bytes
-                if (total_stack_size % 16 != 0) {
-                    total_stack_size += 16 - total_stack_size % 16;
+                // Cold methods go last, in a section of their own that keeps them away from the hot code
+                if (current->is_cold && !cold_section) {
+                    fprintf(out_file, "\n.section .text.unlikely,\"ax\",@progbits\n");
+                    cold_section = 1;
                 }
-
-                var_count = 0;
-                current_stack_offset = 0;
-
                 // Function call prologue
-                fprintf(out_file, "\n.globl %s\n", func_name);
+                if (current->internal) {
+                    fprintf(out_file, "\n");
+                } else {
+                    fprintf(out_file, "\n.globl %s\n", func_name);
+                }
                 fprintf(out_file, "%s:\n", func_name);
-                fprintf(out_file, "  pushq %%rbp\n");
-                fprintf(out_file, "  movq %%rsp, %%rbp\n");
-                if (total_stack_size > 0) {
-                    fprintf(out_file, "  subq $%d, %%rsp\n", total_stack_size);
-                }
-
-                // Move arguments to the stack if they exist
-                if (func_node) {
-                    ARGS_LIST* arg_list = func_node->info->method_decl.args;
-                    int arg_idx = 0;
-                    while (arg_list) {
-                        const char* arg_name = arg_list->arg->name;
-                        int offset = get_var_offset(arg_name);
-                        if (arg_idx < 6) {
-                            // First 6 arguments come from registers
-                            fprintf(out_file, "  movq %s, %d(%%rbp)\n", arg_regs[arg_idx], offset);
-                        } else {
-                            // Arguments 7+ are already on the stack (pushed by caller)
-                            // They are at positive offsets from %rbp:
-                            // rbp+16 is the 7th arg, rbp+24 is the 8th arg, etc.
-                            int stack_arg_offset = 16 + (arg_idx - 6) * 8;
-                            fprintf(out_file, "  movq %d(%%rbp), %%rax\n", stack_arg_offset);
-                            fprintf(out_file, "  movq %%rax, %d(%%rbp)\n", offset);
-                        }
-                        arg_list = arg_list->next;
-                        arg_idx++;
+                if (!frame->frameless) {
+                    fprintf(out_file, "  pushq %%rbp\n");
+                    fprintf(out_file, "  movq %%rsp, %%rbp\n");
+                }
+                if (frame->size > 0 && !frame->frameless) {
+                    fprintf(out_file, "  subq $%d, %%rsp\n", frame->size);
+                }
+                emit_callee_saved(out_file, 0);
+
+                // Move the arguments that come in registers to the stack
+                for (int arg_idx = 0; arg_idx < current->num_args && arg_idx < num_regs; arg_idx++) {
+                    VarLocation* location = get_var_location(current->args[arg_idx]);
+                    // The internal convention doesn't save the arguments that are never read
+                    if (current->internal && location->reads == 0) continue;
+                    if (!location->reg) {
+                        fprintf(out_file, "  movq %s, %d(%s)\n", regs[arg_idx], location->offset, frame_base);
+                    } else if (strcmp(location->reg, regs[arg_idx]) != 0) {
+                        // Arguments only get their own register or a callee-saved one, no move overwrites an
+                        // argument that is still in its register
+                        fprintf(out_file, "  movq %s, %s\n", regs[arg_idx], location->reg);
                     }
                 }
+                // The rest are already on the stack (pushed by caller), they are used from there:
+                // rbp+16 is the first of them, rbp+24 the next one, etc.
                 break;
             }
 
             case I_LEAVE: {
                 fprintf(out_file, ".L_leave_%s:\n", instr->var1->id.name);
-                fprintf(out_file, "  movq %%rbp, %%rsp\n");
-                fprintf(out_file, "  popq %%rbp\n");
-                fprintf(out_file, "  ret\n");
-                for (int v = 0; v < var_count; ++v) {
-                    // Free memory of variables used in this function
-                    free(var_map[v].name);
-                    var_map[v].name = NULL;
+                emit_callee_saved(out_file, 1);
+                if (!frame->frameless) {
+                    fprintf(out_file, "  movq %%rbp, %%rsp\n");
+                    fprintf(out_file, "  popq %%rbp\n");
                 }
-                var_count = 0;
+                fprintf(out_file, "  ret\n");
+                free_frame();
+                free_ranges(ranges);
+                ranges = NULL;
                 break;
             }
 
             case I_RET: {
-                char current_func_name[64] = "unknown";
-                for(int j = i; j >= 0; j--) {
-                    // Find the nearest preceding I_ENTER to get the function name
-                    if (code[j].instruct->instruct.type_instruct == I_ENTER) {
-                        strncpy(current_func_name, code[j].var1->id.name, sizeof(current_func_name)-1);
-                        current_func_name[sizeof(current_func_name)-1] = '\0'; // Line end to avoid buffer overflow
-                        break;
-                    }
-                }
                 // Move return value to %rax and jump to function epilogue
                 if(instr->var1) {
                     get_operand_str(instr->var1, op1, sizeof(op1));
                     fprintf(out_file, "  movq %s, %%rax\n", op1);
+                    if (current->internal && current->returns_bool) {
+                        fprintf(out_file, "  testq %%rax, %%rax\n"); // Zero flag set when it returns false
+                    }
+                }
+                // A return right before the epilogue falls into it, no jump is needed
+                if (i + 1 >= code_size || code[i + 1].instruct->instruct.type_instruct != I_LEAVE) {
+                    fprintf(out_file, "  jmp .L_leave_%s\n", current->name);
                 }
-                fprintf(out_file, "  jmp .L_leave_%s\n", current_func_name);
                 break;
             }
 
@@ -190,44 +681,93 @@ void generate_object_code(FILE* out_file, CANT_AP_TEMP* temp_list) {
                 // rax used for intermediate saving place because we can't make memory -> memory moves
                 get_operand_str(instr->var1, op1, sizeof(op1));
                 get_operand_str(instr->reg, dest, sizeof(dest));
+                if (is_register(op1) || is_register(dest)) {
+                    // A register on either side takes a single move (none if both are the same)
+                    if (strcmp(op1, dest) != 0) fprintf(out_file, "  movq %s, %s\n", op1, dest);
+                    break;
+                }
                 fprintf(out_file, "  movq %s, %%rax\n", op1);
                 fprintf(out_file, "  movq %%rax, %s\n", dest);
                 break;
 
             // Arithmetic and logical operations are the same except for NEG
-            case I_ADD: case I_SUB: case I_MUL: case I_AND: case I_OR:
+            case I_MUL: {
+                long factor;
+                INFO* other = instr->var1;
+                if (known_constant(i, instr->var2, &factor) || (known_constant(i, instr->var1, &factor) && (other = instr->var2))) {
+                    // Constant factor: shifts, lea, add and sub when they are faster than imulq
+                    get_operand_str(other, op1, sizeof(op1));
+                    get_operand_str(instr->reg, dest, sizeof(dest));
+                    emit_mul_by_constant(out_file, op1, factor);
+                    fprintf(out_file, "  movq %%rax, %s\n", dest);
+                    break;
+                }
+            }
+            // fall through
+            case I_ADD: case I_SUB: case I_AND: case I_OR:
                 get_operand_str(instr->var1, op1, sizeof(op1));
                 get_operand_str(instr->var2, op2, sizeof(op2));
                 get_operand_str(instr->reg, dest, sizeof(dest));
-                fprintf(out_file, "  movq %s, %%rax\n", op1);
                 const char* op_str = instr->instruct->instruct.type_instruct == I_ADD ? "addq" :
                                      instr->instruct->instruct.type_instruct == I_SUB ? "subq" :
                                      instr->instruct->instruct.type_instruct == I_MUL ? "imulq" :
                                      instr->instruct->instruct.type_instruct == I_AND ? "andq" : "orq";
+                if (is_register(dest) && strcmp(dest, op2) != 0) {
+                    // The destination register holds the intermediate value
+                    if (strcmp(op1, dest) != 0) fprintf(out_file, "  movq %s, %s\n", op1, dest);
+                    fprintf(out_file, "  %s %s, %s\n", op_str, op2, dest);
+                    break;
+                }
+                fprintf(out_file, "  movq %s, %%rax\n", op1);
                 // rax used for intermediate values
                 fprintf(out_file, "  %s %s, %%rax\n", op_str, op2);
                 fprintf(out_file, "  movq %%rax, %s\n", dest);
                 break;
 
-            case I_DIV: case I_MOD:
+            case I_DIV: case I_MOD: {
                 get_operand_str(instr->var1, op1, sizeof(op1));
                 get_operand_str(instr->var2, op2, sizeof(op2));
                 get_operand_str(instr->reg, dest, sizeof(dest));
+                int is_div = instr->instruct->instruct.type_instruct == I_DIV;
+                long divisor;
+                if (known_constant(i, instr->var2, &divisor) &&
+                    emit_div_by_constant(out_file, op1, divisor, !is_div, known_non_negative(i, instr->var1))) {
+                    // Constant divisor: multiplication by its magic number, or shifts and masks for powers of 2
+                    fprintf(out_file, "  movq %%rax, %s\n", dest);
+                    break;
+                }
                 fprintf(out_file, "  movq %s, %%rax\n", op1);
-                fprintf(out_file, "  cqto\n"); // Sign-extends value in rax to the rdx:rax register pair (necessary to use idivq)
-                fprintf(out_file, "  idivq %s\n", op2);
-                char* result_reg = instr->instruct->instruct.type_instruct == I_DIV ? "%rax" : "%rdx";
-                // idivq saves the result of the division in rax, and the remainder in rdx
-                fprintf(out_file, "  movq %s, %s\n", result_reg, dest);
+                if (is_constant(instr->var2->id.name)) {
+                    // idivq doesn't take immediates
+                    fprintf(out_file, "  movq %s, %%rcx\n", op2);
+                    strcpy(op2, "%rcx");
+                }
+                if (known_non_negative(i, instr->var1) && range_before(ranges, i, instr->var2->id.name).low > 0) {
+                    // Both operands are positive, the unsigned division gives the same result without sign extension
+                    fprintf(out_file, "  xorl %%edx, %%edx\n");
+                    fprintf(out_file, "  divq %s\n", op2);
+                } else {
+                    fprintf(out_file, "  cqto\n"); // Sign-extends value in rax to the rdx:rax register pair (necessary to use idivq)
+                    fprintf(out_file, "  idivq %s\n", op2);
+                }
+                // The division saves the quotient in rax, and the remainder in rdx
+                fprintf(out_file, "  movq %s, %s\n", is_div ? "%rax" : "%rdx", dest);
                 break;
+            }
 
             case I_SHIFT_RIGHT:
                 get_operand_str(instr->var1, op1, sizeof(op1));
                 get_operand_str(instr->var2, op2, sizeof(op2));
                 get_operand_str(instr->reg, dest, sizeof(dest));
+                fprintf(out_file, "  movq %s, %%rax\n", op1);
+                if (known_non_negative(i, instr->var1)) {
+                    // Non negative values already truncate to zero when shifted
+                    fprintf(out_file, "  shrq %s, %%rax\n", op2);
+                    fprintf(out_file, "  movq %%rax, %s\n", dest);
+                    break;
+                }
                 long divisor = 1L << strtol(instr->var2->id.name, NULL, 10); // Calculate divisor
                 long bias = divisor - 1;
-                fprintf(out_file, "  movq %s, %%rax\n", op1);
 
                 // Adjustment so that the optimized division (shift) truncates to zero
                 fprintf(out_file, "  cqo\n");
@@ -241,6 +781,11 @@ void generate_object_code(FILE* out_file, CANT_AP_TEMP* temp_list) {
             case I_MIN:
                 get_operand_str(instr->var1, op1, sizeof(op1));
                 get_operand_str(instr->reg, dest, sizeof(dest));
+                if (is_register(dest)) {
+                    if (strcmp(op1, dest) != 0) fprintf(out_file, "  movq %s, %s\n", op1, dest);
+                    fprintf(out_file, "  negq %s\n", dest);
+                    break;
+                }
                 fprintf(out_file, "  movq %s, %%rax\n", op1);
                 fprintf(out_file, "  negq %%rax\n"); // "negates" the value in rax, use the two's complement operation
                 fprintf(out_file, "  movq %%rax, %s\n", dest);
@@ -267,8 +812,12 @@ void generate_object_code(FILE* out_file, CANT_AP_TEMP* temp_list) {
                     case I_LEQ: set_op = "setle"; break; case I_GEQ: set_op = "setge"; break;
                     default: set_op = ""; break;
                 }
-                fprintf(out_file, "  movq %s, %%rax\n", op1);
-                fprintf(out_file, "  cmpq %s, %%rax\n", op2); // Compares operands, sets CPU flags (Zero Flag, Sign Flag, etc.)
+                if (is_register(op1) || (is_register(op2) && op1[0] != '$')) {
+                    fprintf(out_file, "  cmpq %s, %s\n", op2, op1);
+                } else {
+                    fprintf(out_file, "  movq %s, %%rax\n", op1);
+                    fprintf(out_file, "  cmpq %s, %%rax\n", op2); // Compares operands, sets CPU flags (Zero Flag, Sign Flag, etc.)
+                }
                 fprintf(out_file, "  %s %%al\n", set_op); // Checks CPU flags and sets result in al based on the prevoius comparation
                 fprintf(out_file, "  movzbq %%al, %%rax\n");
                 fprintf(out_file, "  movq %%rax, %s\n", dest);
@@ -277,6 +826,10 @@ void generate_object_code(FILE* out_file, CANT_AP_TEMP* temp_list) {
 
             case I_LABEL:
                 get_operand_str(instr->var1, op1, sizeof(op1));
+                if (optimizations && is_loop_header(i)) {
+                    // Loop headers start a 16 byte block (unless it takes more than 10 bytes of padding)
+                    fprintf(out_file, "  .p2align 4,,10\n");
+                }
                 fprintf(out_file, "%s:\n", op1);
                 break;
 
@@ -285,42 +838,111 @@ void generate_object_code(FILE* out_file, CANT_AP_TEMP* temp_list) {
                 fprintf(out_file, "  jmp %s\n", op1);
                 break;
 
-            case I_JMPF:
+            case I_JMPF: case I_JMPT:
                 get_operand_str(instr->var1, op1, sizeof(op1));
                 get_operand_str(instr->reg, dest, sizeof(dest));
-                fprintf(out_file, "  movq %s, %%rax\n", op1);
-                fprintf(out_file, "  testq %%rax, %%rax\n"); // If value in rax is 0, this sets Zero Flag in 1
-                fprintf(out_file, "  jz %s\n", dest); // Jump if Zero Flag is 1
+                if (is_register(op1)) {
+                    fprintf(out_file, "  testq %s, %s\n", op1, op1);
+                } else {
+                    fprintf(out_file, "  movq %s, %%rax\n", op1);
+                    fprintf(out_file, "  testq %%rax, %%rax\n"); // If value in rax is 0, this sets Zero Flag in 1
+                }
+                // Jump if Zero Flag is 1 (false) or 0 (true)
+                fprintf(out_file, "  %s %s\n", instr->instruct->instruct.type_instruct == I_JMPF ? "jz" : "jnz", dest);
                 break;
 
-            case I_PARAM:
-                // First 6 parameters go in registers, rest go on stack
+            case I_JLES: case I_JGRT: case I_JEQ: case I_JNEQ: case I_JLEQ: case I_JGEQ: {
+                // Comparison and jump together, the boolean is never materialised
                 get_operand_str(instr->var1, op1, sizeof(op1));
-                if (param_count < 6) {
-                    fprintf(out_file, "  movq %s, %s\n", op1, arg_regs[param_count]);
+                get_operand_str(instr->var2, op2, sizeof(op2));
+                get_operand_str(instr->reg, dest, sizeof(dest));
+                const char* jump_op;
+                switch (instr->instruct->instruct.type_instruct) {
+                    case I_JLES: jump_op = "jl"; break; case I_JGRT: jump_op = "jg"; break;
+                    case I_JEQ:  jump_op = "je"; break; case I_JNEQ: jump_op = "jne"; break;
+                    case I_JLEQ: jump_op = "jle"; break; default: jump_op = "jge"; break;
+                }
+                if (is_register(op1) || (is_register(op2) && op1[0] != '$')) {
+                    // Registers are compared in place (only one of the operands can be in memory)
+                    fprintf(out_file, "  cmpq %s, %s\n", op2, op1);
                 } else {
-                    // Parameters beyond the 6th need to be pushed onto stack
-                    // We'll collect them and push in reverse order before the call
-                    fprintf(out_file, "  pushq %s\n", op1);
-                    stack_params++;
+                    fprintf(out_file, "  movq %s, %%rax\n", op1);
+                    fprintf(out_file, "  cmpq %s, %%rax\n", op2);
                 }
+                fprintf(out_file, "  %s %s\n", jump_op, dest);
+                break;
+            }
+
+            case I_PARAM:
+                // The first parameters go in the registers of the convention of the callee, the rest go on stack
+                if (param_count == 0) {
+                    int call = i;
+                    while (code[call].instruct->instruct.type_instruct == I_PARAM) call++;
+                    call_params = call - i;
+                    call_arg_regs = argument_registers(code[call].var1->id.name, &call_regs);
+                    stack_params = call_params > call_regs ? call_params - call_regs : 0;
+                }
+                get_operand_str(instr->var1, op1, sizeof(op1));
+                if (param_count < call_regs) {
+                    fprintf(out_file, "  movq %s, %s\n", op1, call_arg_regs[param_count]);
+                }
+                // The ones that go on stack are pushed in reverse order right before the call
                 param_count++;
                 break;
 
-            case I_CALL:
+            case I_CALL: {
+                int ret = optimizations && stack_params == 0 ? tail_call_return(i) : -1;
+                if (current->internal && current->returns_bool && !returns_in_flags(instr->var1->id.name)) {
+                    ret = -1; // The callee wouldn't set the flags our callers read
+                }
+                if (ret >= 0) {
+                    // Tail call: the frame is released and the callee returns directly to our caller
+                    emit_callee_saved(out_file, 1);
+                    fprintf(out_file, "  movq %%rbp, %%rsp\n");
+                    fprintf(out_file, "  popq %%rbp\n");
+                    fprintf(out_file, "  jmp %s\n", instr->var1->id.name);
+                    if (remarks) {
+                        fprintf(stderr, "Remark: tail call to %s in %s emitted as a jump\n", instr->var1->id.name,
+                                current->name);
+                    }
+                    param_count = 0;
+                    // The epilogue is still emitted, other returns jump to it
+                    if (code[ret].instruct->instruct.type_instruct == I_RET) i = ret;
+                    break;
+                }
+                // The stack stays aligned to 16 bytes at the call
+                int padding = stack_params % 2;
+                if (padding) {
+                    fprintf(out_file, "  subq $8, %%rsp\n");
+                }
+                for (int k = call_params - 1; k >= call_regs; k--) {
+                    get_operand_str(code[i - call_params + k].var1, op1, sizeof(op1));
+                    fprintf(out_file, "  pushq %s\n", op1);
+                }
                 fprintf(out_file, "  call %s\n", instr->var1->id.name);
+                int next = i + 1;
+                while (next < code_size && code[next].instruct->instruct.type_instruct == I_LOAD) next++;
+                INSTR_TYPE next_type = next < code_size ? code[next].instruct->instruct.type_instruct : I_LOAD;
                 if (instr->reg) {
                     // Saves returned value
                     get_operand_str(instr->reg, dest, sizeof(dest));
                     fprintf(out_file, "  movq %%rax, %s\n", dest);
                 }
-                // Clean up stack parameters (arguments 7+)
+                if (instr->reg && stack_params == 0 && returns_in_flags(instr->var1->id.name) &&
+                    (next_type == I_JMPF || next_type == I_JMPT) && !select_shape(next) &&
+                    strcmp(code[next].var1->id.name, instr->reg->id.name) == 0) {
+                    // A jump on the result reads the flags the callee left (the movq doesn't change them)
+                    fprintf(out_file, "  %s %s\n", next_type == I_JMPF ? "jz" : "jnz", code[next].reg->id.name);
+                    i = next;
+                }
+                // Clean up stack parameters
                 if (stack_params > 0) {
-                    fprintf(out_file, "  addq $%d, %%rsp\n", stack_params * 8);
+                    fprintf(out_file, "  addq $%d, %%rsp\n", (stack_params + padding) * 8);
                 }
                 param_count = 0;
                 stack_params = 0;
                 break;
+            }
 
             case I_LOAD:
                 break;
@@ -330,4 +952,9 @@ void generate_object_code(FILE* out_file, CANT_AP_TEMP* temp_list) {
                 break;
         }
     }
+    free_method_table();
+    current = NULL;
+    frame = NULL;
+    free(reused_offset);
+    reused_offset = NULL;
 }
\ No newline at end of file
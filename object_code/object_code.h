@@ -6,21 +6,63 @@
 #include <string.h>
 #include <ctype.h>
 #include "intermediate_code.h"
+#include "range_analysis.h"
+#include "layout.h"
+#include "const_arith.h"
+#include "regalloc.h"
 #include "symbol.h"
 #include "ast.h"
+#include "utils.h"
 
-#define MAX_VARS_PER_FUNCTION 200
+// Arguments passed in registers by the System V convention (extern methods and main)
+#define SYSV_ARG_REGS 6
+// Arguments passed in registers between the methods of the program (with optimizations)
+#define INTERNAL_ARG_REGS 8
+// Bytes below %rsp that a method without calls can use without reserving them
+#define RED_ZONE_SIZE 128
 
 // Structure for saving variable name and offset
 typedef struct {
     char* name;
     int offset;
+    const char* reg; // Register that holds the variable (NULL if it lives in the stack)
+    int reads; // Instructions of the method that read it
 } VarLocation;
 
+// Stack frame of a method: where each of its variables lives and how many bytes it takes
+typedef struct FRAME_LAYOUT {
+    VarLocation* vars; // Grows as needed, methods have no limit of variables
+    int count;
+    int capacity;
+    NAME_TABLE index; // Position in vars of each name
+    int offset; // Offset of the lowest stack slot
+    int size; // Bytes reserved for the stack slots, aligned to 16
+    int frameless; // It runs without a frame (see is_frameless)
+    REG_ALLOCATION* allocation; // Registers of its variables (only with optimizations)
+} FRAME_LAYOUT;
+
+// Method of the program, everything the generation of its code needs is found once before emitting it
+typedef struct METHOD_INFO {
+    char* name;
+    int enter; // Index of its I_ENTER
+    int leave; // Index of its I_LEAVE
+    AST_NODE* node; // Declaration in the AST (NULL if it has none)
+    char** args; // Names of the arguments
+    int num_args;
+    int internal; // It uses the internal calling convention (see is_internal_method)
+    int returns_bool;
+    int has_calls;
+    int is_cold; // Placed in the cold section by order_methods
+    NAME_TABLE labels; // Position of each label that is the target of a jump in jumps and last_jump
+    int* jumps; // Jumps to each label
+    int* last_jump; // Index of the last jump to each label
+    FRAME_LAYOUT frame;
+} METHOD_INFO;
+
 /* Main function to generate x86-64 assembly code from intermediate code
  * Outputs the assembly code to the provided file pointer
  * Handles function prologues/epilogues, arithmetic operations, control flow, and function calls
- * Uses a simple mapping of temporaries to stack offsets
+ * The methods and their frames are found first, then the code is emitted in a single pass
  */
 void generate_object_code(FILE* out_file, CANT_AP_TEMP* cant_ap_h);
 
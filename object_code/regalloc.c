@@ -0,0 +1,284 @@
+#include "regalloc.h"
+#include "utils.h"
+#include <limits.h>
+
+#define NUM_REGISTERS (NUM_CALLER_SAVED + NUM_CALLEE_SAVED)
+
+// Registers in the order they are handed out: the caller-saved ones first, which need no saving in the prologue
+static const char* registers[NUM_REGISTERS] = {
+    "%rsi", "%rdi", "%r8", "%r9", "%r10", "%r11", // Caller-saved
+    "%rbx", "%r12", "%r13", "%r14", "%r15" // Callee-saved
+};
+
+// Part of the method where a variable or temporal holds a value (from its first definition to its last use)
+typedef struct INTERVAL {
+    char* name;
+    int start;
+    int end;
+    long weight; // Uses and definitions, weighted by the loops around them (spilling it costs that many accesses)
+    int order; // Position of the argument (INT_MAX for the rest), ties are broken by it
+    int crosses_call; // A call, or the loading of its arguments, happens while it is live
+    int in_stack; // Argument that arrives in the stack
+    const char* incoming; // Register the argument arrives in
+    const char* reg; // Register assigned (NULL if it lives in the stack)
+} INTERVAL;
+
+/* Function that checks if name is a variable or temporal of a method (not a label, a constant or a global)
+ */
+int is_allocatable(const char* name) {
+    return name && name[0] != '_' && !is_constant(name) && !is_global(name);
+}
+
+/* Returns the position of the interval of name, adding it if it has none (index has the position of each name)
+ */
+static int add_interval(INTERVAL* intervals, int* count, NAME_TABLE* index, char* name) {
+    int v = table_get(index, name);
+    if (v >= 0) return v;
+    intervals[*count] = (INTERVAL){name, INT_MAX, -1, 0, INT_MAX, 0, 0, NULL, NULL};
+    table_put(index, name, *count);
+    return (*count)++;
+}
+
+/* Extends the interval so it contains the instruction at index
+ */
+static void extend(INTERVAL* interval, int index) {
+    if (index < interval->start) interval->start = index;
+    if (index > interval->end) interval->end = index;
+}
+
+/* Orders the intervals by their start, arguments first in the order of the parameters
+ */
+static int compare_intervals(const void* x, const void* y) {
+    const INTERVAL* a = x;
+    const INTERVAL* b = y;
+    if (a->start != b->start) return a->start < b->start ? -1 : 1;
+    if (a->order != b->order) return a->order < b->order ? -1 : 1;
+    return strcmp(a->name, b->name);
+}
+
+/* Checks if spilling the interval a costs less than spilling b
+ */
+static int is_lighter(INTERVAL* a, INTERVAL* b) {
+    if (a->weight != b->weight) return a->weight < b->weight;
+    return a->end > b->end;
+}
+
+/* Returns the position of reg in registers (-1 if the allocator doesn't hand it out)
+ */
+static int register_index(const char* reg) {
+    for (int r = 0; reg && r < NUM_REGISTERS; r++) {
+        if (strcmp(registers[r], reg) == 0) return r;
+    }
+    return -1;
+}
+
+/* Checks if the register at position r can hold the interval, if its class is in classes: callee-saved registers
+ * hold anything, caller-saved ones only values that no call needs. An argument can only stay in the register it
+ * arrives in or go to one where no argument arrives (incoming marks them), so the moves of the prologue never
+ * overwrite an argument that is still in its register
+ */
+static int can_hold(int r, INTERVAL* interval, int classes, const char* incoming) {
+    if (r >= NUM_CALLER_SAVED) return (classes & REG_CALLEE_SAVED) != 0;
+    if (!(classes & REG_CALLER_SAVED) || interval->crosses_call) return 0;
+    return !interval->incoming || !incoming[r] || strcmp(registers[r], interval->incoming) == 0;
+}
+
+/* Returns the weight of a use or definition in each block of the method: SPILL_LOOP_WEIGHT for each loop around it
+ */
+static long* block_weights(CFG* cfg) {
+    long* weights = malloc((cfg->num_blocks + 1) * sizeof(long));
+    if (!weights) error_allocate_mem();
+    int* idom = compute_dominators(cfg);
+    int num_loops;
+    LOOP* loops = find_loops(cfg, idom, &num_loops);
+    for (int b = 0; b < cfg->num_blocks; b++) {
+        weights[b] = 1;
+        int depth = 0;
+        for (int l = 0; l < num_loops; l++) {
+            if (loops[l].blocks[b] && depth++ < MAX_SPILL_DEPTH) weights[b] *= SPILL_LOOP_WEIGHT;
+        }
+    }
+    free_loops(loops, num_loops);
+    free(idom);
+    return weights;
+}
+
+/* Computes the live intervals of the variables and temporals of the method: liveness analysis on the blocks of
+ * the control flow graph, and then the interval of each one goes from the first instruction where it is live to
+ * the last one. Returns how many intervals were saved in intervals, and saves the position of each name in index
+ */
+static int compute_intervals(CFG* cfg, INTERVAL* intervals, NAME_TABLE* index) {
+    Instr* code = get_intermediate_code();
+    long* weights = block_weights(cfg);
+    int count = 0;
+    for (int i = cfg->enter + 1; i < cfg->leave; i++) {
+        INFO* operands[3];
+        int num_operands = get_uses(&code[i], operands);
+        if (get_dest(&code[i])) operands[num_operands++] = get_dest(&code[i]);
+        for (int o = 0; o < num_operands; o++) {
+            char* name = operands[o]->id.name;
+            if (is_allocatable(name)) extend(&intervals[add_interval(intervals, &count, index, name)], i);
+        }
+    }
+    int num_blocks = cfg->num_blocks;
+    size_t size = (size_t)num_blocks * count + 1;
+    char* use = calloc(size, 1);
+    char* def = calloc(size, 1);
+    char* live_in = calloc(size, 1);
+    char* live_out = calloc(size, 1);
+    if (!use || !def || !live_in || !live_out) error_allocate_mem();
+    for (int b = 0; b < num_blocks; b++) {
+        for (int i = cfg->blocks[b].start; i <= cfg->blocks[b].end; i++) {
+            INFO* uses[2];
+            int num_uses = get_uses(&code[i], uses);
+            for (int u = 0; u < num_uses; u++) {
+                int v = is_allocatable(uses[u]->id.name) ? table_get(index, uses[u]->id.name) : -1;
+                if (v < 0) continue;
+                if (!def[b * count + v]) use[b * count + v] = 1;
+                intervals[v].weight += weights[b];
+            }
+            INFO* dest = get_dest(&code[i]);
+            int v = dest && is_allocatable(dest->id.name) ? table_get(index, dest->id.name) : -1;
+            if (v < 0) continue;
+            def[b * count + v] = 1;
+            intervals[v].weight += weights[b];
+        }
+    }
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int b = num_blocks - 1; b >= 0; b--) {
+            char* out = &live_out[b * count];
+            for (int s = 0; s < 2; s++) {
+                int succ = cfg->blocks[b].succ[s];
+                for (int v = 0; succ >= 0 && v < count; v++) out[v] |= live_in[succ * count + v];
+            }
+            for (int v = 0; v < count; v++) {
+                char in = use[b * count + v] || (out[v] && !def[b * count + v]);
+                if (in != live_in[b * count + v]) {
+                    live_in[b * count + v] = in;
+                    changed = 1;
+                }
+            }
+        }
+    }
+    for (int b = 0; b < num_blocks; b++) {
+        for (int v = 0; v < count; v++) {
+            if (live_in[b * count + v]) extend(&intervals[v], cfg->blocks[b].start);
+            if (live_out[b * count + v]) extend(&intervals[v], cfg->blocks[b].end);
+        }
+    }
+    free(weights);
+    free(use);
+    free(def);
+    free(live_in);
+    free(live_out);
+    return count;
+}
+
+/* Function that assigns registers to the variables and temporals of the method that starts at enter with linear
+ * scan over their live intervals (computed with liveness analysis on the control flow graph). Values that are live
+ * during a call (or while its arguments are being loaded) only get callee-saved registers, and only the classes of
+ * registers in classes (REG_CALLER_SAVED, REG_CALLEE_SAVED) are used. The first num_regs of the num_args arguments (args) arrive in arg_regs
+ * and keep that register when nothing else needs it, the rest arrive in the stack and stay there. When the registers
+ * run out, the value with the lightest uses (each one weighs SPILL_LOOP_WEIGHT times more for each loop around it)
+ * is spilled to the stack
+ */
+REG_ALLOCATION* allocate_registers(int enter, char** args, int num_args, const char** arg_regs, int num_regs,
+                                   int classes) {
+    Instr* code = get_intermediate_code();
+    CFG* cfg = build_cfg(enter);
+    int length = cfg->leave - enter + 1;
+    INTERVAL* intervals = malloc((3 * length + 1) * sizeof(INTERVAL));
+    int* calls = calloc(length + 1, sizeof(int)); // Calls and arguments of calls before each instruction
+    REG_ALLOCATION* allocation = calloc(1, sizeof(REG_ALLOCATION));
+    if (!intervals || !calls || !allocation) error_allocate_mem();
+    NAME_TABLE index = {NULL, NULL, 0, 0};
+    int count = compute_intervals(cfg, intervals, &index);
+
+    for (int a = 0; a < num_args; a++) {
+        int v = table_get(&index, args[a]);
+        if (v < 0) continue; // Never used
+        intervals[v].start = enter;
+        intervals[v].order = a;
+        intervals[v].in_stack = a >= num_regs;
+        intervals[v].incoming = a < num_regs ? arg_regs[a] : NULL;
+    }
+    for (int i = enter; i <= cfg->leave; i++) {
+        INSTR_TYPE type = code[i].instruct->instruct.type_instruct;
+        calls[i - enter + 1] = calls[i - enter] + (type == I_CALL || type == I_PARAM);
+    }
+    for (int v = 0; v < count; v++) {
+        INTERVAL* interval = &intervals[v];
+        int crossed = calls[interval->end - enter + 1] - calls[interval->start - enter];
+        // The result of a call is saved after it
+        if (code[interval->start].instruct->instruct.type_instruct == I_CALL) crossed--;
+        interval->crosses_call = crossed > 0;
+    }
+    table_free(&index); // The positions change when they are sorted
+    qsort(intervals, count, sizeof(INTERVAL), compare_intervals);
+
+    int holder[NUM_REGISTERS]; // Interval in each register (-1 if it's free)
+    char incoming[NUM_REGISTERS] = {0}; // Registers where an argument arrives
+    for (int r = 0; r < NUM_REGISTERS; r++) holder[r] = -1;
+    for (int a = 0; a < num_args && a < num_regs; a++) {
+        if (register_index(arg_regs[a]) >= 0) incoming[register_index(arg_regs[a])] = 1;
+    }
+    for (int v = 0; v < count; v++) {
+        INTERVAL* interval = &intervals[v];
+        if (interval->in_stack) continue;
+        for (int r = 0; r < NUM_REGISTERS; r++) {
+            if (holder[r] >= 0 && intervals[holder[r]].end < interval->start) holder[r] = -1;
+        }
+        int chosen = -1;
+        int own = register_index(interval->incoming);
+        if (own >= 0 && holder[own] < 0 && can_hold(own, interval, classes, incoming)) chosen = own;
+        for (int r = 0; r < NUM_REGISTERS && chosen < 0; r++) {
+            if (holder[r] < 0 && can_hold(r, interval, classes, incoming)) chosen = r;
+        }
+        if (chosen < 0) {
+            // Spill the lightest: this interval, or one that holds a register it could use (the one that ends last
+            // among the lightest, it keeps the register busy longer)
+            int victim = -1;
+            for (int r = 0; r < NUM_REGISTERS; r++) {
+                if (holder[r] < 0 || !can_hold(r, interval, classes, incoming)) continue;
+                if (victim < 0 || is_lighter(&intervals[holder[r]], &intervals[holder[victim]])) victim = r;
+            }
+            if (victim < 0 || !is_lighter(&intervals[holder[victim]], interval)) continue;
+            intervals[holder[victim]].reg = NULL;
+            chosen = victim;
+        }
+        interval->reg = registers[chosen];
+        holder[chosen] = v;
+    }
+
+    allocation->assignments = malloc((count + 1) * sizeof(REG_ASSIGNMENT));
+    if (!allocation->assignments) error_allocate_mem();
+    for (int v = 0; v < count; v++) {
+        if (intervals[v].in_stack) continue;
+        if (!intervals[v].reg) allocation->num_spilled++;
+        allocation->assignments[allocation->count++] = (REG_ASSIGNMENT){my_strdup(intervals[v].name), intervals[v].reg,
+                                                                         intervals[v].start, intervals[v].end};
+    }
+    for (int r = NUM_CALLER_SAVED; r < NUM_REGISTERS; r++) {
+        for (int a = 0; a < allocation->count; a++) {
+            if (allocation->assignments[a].reg == registers[r]) {
+                allocation->saved[allocation->num_saved++] = registers[r];
+                break;
+            }
+        }
+    }
+    free(intervals);
+    free(calls);
+    free_cfg(cfg);
+    return allocation;
+}
+
+/* Function that frees the memory used by a register allocation
+ */
+void free_allocation(REG_ALLOCATION* allocation) {
+    if (!allocation) return;
+    for (int a = 0; a < allocation->count; a++) free(allocation->assignments[a].name);
+    free(allocation->assignments);
+    free(allocation);
+}
@@ -0,0 +1,58 @@
+#ifndef REGALLOC_H
+#define REGALLOC_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "intermediate_code.h"
+#include "cfg.h"
+#include "loops.h"
+
+// Registers the calls clobber that the generated code never uses as scratch (%rax, %rcx and %rdx are)
+#define NUM_CALLER_SAVED 6
+// Registers a method must leave as it found them, the prologue saves the ones it uses
+#define NUM_CALLEE_SAVED 5
+// How much more a use or definition weighs for each loop around it when choosing what to spill
+#define SPILL_LOOP_WEIGHT 10
+// Deepest loop nesting that makes a use or definition weigh more
+#define MAX_SPILL_DEPTH 6
+
+// Classes of registers the allocator may use
+#define REG_CALLER_SAVED 1
+#define REG_CALLEE_SAVED 2
+
+// Live interval of a variable or temporal of a method and the register assigned to it
+typedef struct REG_ASSIGNMENT {
+    char* name;
+    const char* reg; // NULL if it lives in the stack
+    int start; // Index of the first instruction where it is live
+    int end; // Index of the last instruction where it is live
+} REG_ASSIGNMENT;
+
+// Registers assigned to the variables and temporals of a method, the rest live in the stack
+typedef struct REG_ALLOCATION {
+    REG_ASSIGNMENT* assignments; // Ordered by the start of their intervals (arguments that arrive in the stack excluded)
+    int count;
+    int num_spilled; // Variables and temporals that got no register
+    const char* saved[NUM_CALLEE_SAVED]; // Callee-saved registers used by the method
+    int num_saved;
+} REG_ALLOCATION;
+
+/* Function that assigns registers to the variables and temporals of the method that starts at enter with linear
+ * scan over their live intervals (computed with liveness analysis on the control flow graph). Values that are live
+ * during a call (or while its arguments are being loaded) only get callee-saved registers, and only the classes of
+ * registers in classes (REG_CALLER_SAVED, REG_CALLEE_SAVED) are used. The first num_regs of the num_args arguments (args) arrive in arg_regs
+ * and keep that register when nothing else needs it, the rest arrive in the stack and stay there. When the registers
+ * run out, the value with the lightest uses (each one weighs SPILL_LOOP_WEIGHT times more for each loop around it)
+ * is spilled to the stack
+ */
+REG_ALLOCATION* allocate_registers(int enter, char** args, int num_args, const char** arg_regs, int num_regs,
+                                   int classes);
+/* Function that checks if name is a variable or temporal of a method (not a label, a constant or a global)
+ */
+int is_allocatable(const char* name);
+/* Function that frees the memory used by a register allocation
+ */
+void free_allocation(REG_ALLOCATION* allocation);
+
+#endif
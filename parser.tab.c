@@ -0,0 +1,1929 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "parser.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "error_handling.h"
+#include "ast.h"
+#include "print_funcs.h"
+#include "symbol_table.h"
+#include "semantic_analyzer.h"
+#include "intermediate_code.h"
+#include "symbol.h"
+#include "object_code.h"
+
+extern int yylex();
+extern int yylineno;
+void yyerror(const char *s);
+extern FILE *yyin;
+ARGS_LIST* current_args_list = NULL;
+
+/* flag so that the next block does NOT do push_scope() (used by methods) */
+int suppress_next_block_push = 0;
+/* indicates whether the most recent block was pushed (to decide pop) */
+int last_block_pushed = 0;
+
+#line 96 "parser.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parser.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_PROGRAM = 3,                    /* PROGRAM  */
+  YYSYMBOL_IF = 4,                         /* IF  */
+  YYSYMBOL_ELSE = 5,                       /* ELSE  */
+  YYSYMBOL_THEN = 6,                       /* THEN  */
+  YYSYMBOL_WHILE = 7,                      /* WHILE  */
+  YYSYMBOL_VOID = 8,                       /* VOID  */
+  YYSYMBOL_RETURN = 9,                     /* RETURN  */
+  YYSYMBOL_EXTERN = 10,                    /* EXTERN  */
+  YYSYMBOL_INLINE = 11,                    /* INLINE  */
+  YYSYMBOL_NOINLINE = 12,                  /* NOINLINE  */
+  YYSYMBOL_BOOL = 13,                      /* BOOL  */
+  YYSYMBOL_INTEGER = 14,                   /* INTEGER  */
+  YYSYMBOL_FALSE = 15,                     /* FALSE  */
+  YYSYMBOL_TRUE = 16,                      /* TRUE  */
+  YYSYMBOL_INTEGER_LITERAL = 17,           /* INTEGER_LITERAL  */
+  YYSYMBOL_ID = 18,                        /* ID  */
+  YYSYMBOL_AND = 19,                       /* AND  */
+  YYSYMBOL_OR = 20,                        /* OR  */
+  YYSYMBOL_NEG = 21,                       /* NEG  */
+  YYSYMBOL_EQ = 22,                        /* EQ  */
+  YYSYMBOL_NEQ = 23,                       /* NEQ  */
+  YYSYMBOL_LEQ = 24,                       /* LEQ  */
+  YYSYMBOL_GEQ = 25,                       /* GEQ  */
+  YYSYMBOL_LES = 26,                       /* LES  */
+  YYSYMBOL_GRT = 27,                       /* GRT  */
+  YYSYMBOL_28_ = 28,                       /* '+'  */
+  YYSYMBOL_29_ = 29,                       /* '-'  */
+  YYSYMBOL_30_ = 30,                       /* '*'  */
+  YYSYMBOL_31_ = 31,                       /* '/'  */
+  YYSYMBOL_32_ = 32,                       /* '%'  */
+  YYSYMBOL_UMINUS = 33,                    /* UMINUS  */
+  YYSYMBOL_34_ = 34,                       /* '{'  */
+  YYSYMBOL_35_ = 35,                       /* '}'  */
+  YYSYMBOL_36_ = 36,                       /* '='  */
+  YYSYMBOL_37_ = 37,                       /* ';'  */
+  YYSYMBOL_38_ = 38,                       /* '('  */
+  YYSYMBOL_39_ = 39,                       /* ')'  */
+  YYSYMBOL_40_ = 40,                       /* ','  */
+  YYSYMBOL_YYACCEPT = 41,                  /* $accept  */
+  YYSYMBOL_program = 42,                   /* program  */
+  YYSYMBOL_decls = 43,                     /* decls  */
+  YYSYMBOL_decl = 44,                      /* decl  */
+  YYSYMBOL_var_decl = 45,                  /* var_decl  */
+  YYSYMBOL_var_decls = 46,                 /* var_decls  */
+  YYSYMBOL_method_decl = 47,               /* method_decl  */
+  YYSYMBOL_inline_attr = 48,               /* inline_attr  */
+  YYSYMBOL_method_args = 49,               /* method_args  */
+  YYSYMBOL_50_1 = 50,                      /* $@1  */
+  YYSYMBOL_51_2 = 51,                      /* $@2  */
+  YYSYMBOL_arg_list = 52,                  /* arg_list  */
+  YYSYMBOL_type = 53,                      /* type  */
+  YYSYMBOL_block = 54,                     /* block  */
+  YYSYMBOL_55_3 = 55,                      /* $@3  */
+  YYSYMBOL_statements = 56,                /* statements  */
+  YYSYMBOL_statement = 57,                 /* statement  */
+  YYSYMBOL_else = 58,                      /* else  */
+  YYSYMBOL_expr = 59,                      /* expr  */
+  YYSYMBOL_method_call = 60,               /* method_call  */
+  YYSYMBOL_call_args = 61,                 /* call_args  */
+  YYSYMBOL_expr_list = 62,                 /* expr_list  */
+  YYSYMBOL_literal = 63                    /* literal  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  4
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   244
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  41
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  23
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  66
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  125
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   283
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,    32,     2,     2,
+      38,    39,    30,    28,    40,    29,     2,    31,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,    37,
+       2,    36,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    34,     2,    35,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    33
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,    55,    55,    59,    60,    64,    65,    69,    82,    98,
+      99,   103,   112,   120,   130,   141,   142,   143,   147,   147,
+     150,   150,   156,   161,   170,   171,   175,   175,   206,   207,
+     211,   220,   221,   222,   223,   224,   225,   226,   230,   231,
+     235,   242,   243,   244,   245,   246,   247,   248,   249,   250,
+     251,   252,   253,   254,   255,   256,   257,   258,   259,   263,
+     267,   268,   272,   273,   277,   278,   279
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "PROGRAM", "IF",
+  "ELSE", "THEN", "WHILE", "VOID", "RETURN", "EXTERN", "INLINE",
+  "NOINLINE", "BOOL", "INTEGER", "FALSE", "TRUE", "INTEGER_LITERAL", "ID",
+  "AND", "OR", "NEG", "EQ", "NEQ", "LEQ", "GEQ", "LES", "GRT", "'+'",
+  "'-'", "'*'", "'/'", "'%'", "UMINUS", "'{'", "'}'", "'='", "';'", "'('",
+  "')'", "','", "$accept", "program", "decls", "decl", "var_decl",
+  "var_decls", "method_decl", "inline_attr", "method_args", "$@1", "$@2",
+  "arg_list", "type", "block", "$@3", "statements", "statement", "else",
+  "expr", "method_call", "call_args", "expr_list", "literal", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-69)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-21)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+       6,    -2,    34,   -69,   -69,    23,    25,   -69,   -69,   -69,
+     -69,   -69,   -69,    30,     3,     2,    11,    73,   -69,    11,
+      29,    15,   -69,   -69,   -69,   -69,    24,    73,    73,    73,
+     144,   -69,   -69,    32,    35,    33,    51,    73,   -69,   -69,
+      90,    73,    73,    73,    73,    73,    73,    73,    73,    73,
+      73,    73,    73,    73,   -69,    45,    38,   -69,   -69,    42,
+      15,   -69,   192,    43,    37,   -69,   203,   203,   212,   212,
+     -24,   -24,   -24,   -24,    65,    65,   -69,   -69,   -69,    44,
+      42,   -69,   -69,   -69,    66,   -69,    73,   -69,   -69,   -69,
+     -69,   192,    15,   -69,    67,    26,    16,    54,    55,    49,
+     -25,   -69,   -69,   -69,   -69,    61,    73,    73,   -69,   160,
+      73,   -69,   108,   126,   -69,   176,    93,    42,   -69,    42,
+     -69,    95,    42,   -69,   -69
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       0,     0,     0,     4,     1,     0,     0,    25,    24,     2,
+       3,     5,     6,     0,     0,     0,    18,     0,     8,    18,
+       0,     0,    21,    66,    65,    64,    40,     0,     0,     0,
+       0,    41,    42,     0,    15,    19,     0,    61,    57,    56,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     7,    15,     0,    16,    17,     0,
+       0,    22,    62,     0,    60,    58,    54,    55,    50,    51,
+      52,    53,    48,    49,    43,    44,    45,    46,    47,     0,
+       0,    12,    26,    11,     0,    59,     0,    14,    13,    10,
+      23,    63,    29,     9,     0,     0,     0,     0,     0,     0,
+       0,    27,    36,    37,    28,     0,     0,     0,    35,     0,
+       0,    31,     0,     0,    34,     0,     0,     0,    30,     0,
+      33,    39,     0,    32,    38
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+     -69,   -69,   -69,   -69,     9,   -69,   -69,    48,    85,   -69,
+     -69,   -69,   -18,   -68,   -69,   -69,   -69,   -69,   -27,    10,
+     -69,   -69,   -69
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     2,     5,    10,    11,    92,    12,    59,    20,    21,
+      22,    35,    13,    83,    89,    95,   104,   123,    30,    31,
+      63,    64,    32
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
+{
+      38,    39,    40,    36,    49,    50,    51,    52,    53,     1,
+      62,   110,    88,    37,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,   103,     7,     8,
+      97,     6,     3,    98,     4,    99,     7,     8,    17,    18,
+      19,    16,    84,    14,   100,    56,    57,    58,    15,   120,
+     -20,   121,    17,    18,   124,    79,    57,    58,     9,    91,
+      82,   101,    37,   102,    23,    24,    25,    26,    34,    61,
+      27,    55,   109,    60,    94,    81,    82,    86,    28,   112,
+     113,    87,    85,   115,    90,    96,   108,    29,    23,    24,
+      25,    26,   106,   107,    27,    51,    52,    53,   111,   119,
+     122,    93,    28,    80,    33,   105,     0,     0,     0,    41,
+      42,    29,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,     0,     0,     0,     0,    41,    42,    65,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,     0,     0,     0,     0,    41,    42,   116,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,     0,
+       0,     0,     0,    41,    42,   117,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,     0,     0,    41,
+      42,    54,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,     0,     0,    41,    42,   114,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,     0,
+       0,    41,    42,   118,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    45,    46,    47,    48,
+      49,    50,    51,    52,    53
+};
+
+static const yytype_int8 yycheck[] =
+{
+      27,    28,    29,    21,    28,    29,    30,    31,    32,     3,
+      37,    36,    80,    38,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    95,    13,    14,
+       4,     8,    34,     7,     0,     9,    13,    14,    36,    37,
+      38,    38,    60,    18,    18,    10,    11,    12,    18,   117,
+      39,   119,    36,    37,   122,    10,    11,    12,    35,    86,
+      34,    35,    38,    37,    15,    16,    17,    18,    39,    18,
+      21,    39,    99,    40,    92,    37,    34,    40,    29,   106,
+     107,    37,    39,   110,    18,    18,    37,    38,    15,    16,
+      17,    18,    38,    38,    21,    30,    31,    32,    37,     6,
+       5,    92,    29,    55,    19,    95,    -1,    -1,    -1,    19,
+      20,    38,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    -1,    -1,    -1,    -1,    19,    20,    39,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    -1,    -1,    -1,    -1,    19,    20,    39,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    -1,
+      -1,    -1,    -1,    19,    20,    39,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    -1,    -1,    19,
+      20,    37,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    -1,    -1,    19,    20,    37,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    -1,
+      -1,    19,    20,    37,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    24,    25,    26,    27,
+      28,    29,    30,    31,    32
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     3,    42,    34,     0,    43,     8,    13,    14,    35,
+      44,    45,    47,    53,    18,    18,    38,    36,    37,    38,
+      49,    50,    51,    15,    16,    17,    18,    21,    29,    38,
+      59,    60,    63,    49,    39,    52,    53,    38,    59,    59,
+      59,    19,    20,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    37,    39,    10,    11,    12,    48,
+      40,    18,    59,    61,    62,    39,    59,    59,    59,    59,
+      59,    59,    59,    59,    59,    59,    59,    59,    59,    10,
+      48,    37,    34,    54,    53,    39,    40,    37,    54,    55,
+      18,    59,    46,    45,    53,    56,    18,     4,     7,     9,
+      18,    35,    37,    54,    57,    60,    38,    38,    37,    59,
+      36,    37,    59,    59,    37,    59,    39,    39,    37,     6,
+      54,    54,     5,    58,    54
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    41,    42,    43,    43,    44,    44,    45,    45,    46,
+      46,    47,    47,    47,    47,    48,    48,    48,    50,    49,
+      51,    49,    52,    52,    53,    53,    55,    54,    56,    56,
+      57,    57,    57,    57,    57,    57,    57,    57,    58,    58,
+      59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
+      59,    59,    59,    59,    59,    59,    59,    59,    59,    60,
+      61,    61,    62,    62,    63,    63,    63
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     4,     2,     0,     1,     1,     5,     3,     2,
+       0,     7,     7,     7,     7,     0,     1,     1,     0,     2,
+       0,     1,     2,     4,     1,     1,     0,     5,     2,     0,
+       4,     2,     7,     5,     3,     2,     1,     1,     2,     0,
+       1,     1,     1,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     2,     2,     3,     4,
+       1,     0,     1,     3,     1,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* decls: decls decl  */
+#line 59 "parser.y"
+                 {  if ((yyvsp[0].node)) add_sentence((yyvsp[0].node)); }
+#line 1248 "parser.tab.c"
+    break;
+
+  case 4: /* decls: %empty  */
+#line 60 "parser.y"
+                  { (yyval.node) = NULL; }
+#line 1254 "parser.tab.c"
+    break;
+
+  case 5: /* decl: var_decl  */
+#line 64 "parser.y"
+                  { (yyval.node) = (yyvsp[0].node); }
+#line 1260 "parser.tab.c"
+    break;
+
+  case 6: /* decl: method_decl  */
+#line 65 "parser.y"
+                  { (yyval.node) = (yyvsp[0].node); }
+#line 1266 "parser.tab.c"
+    break;
+
+  case 7: /* var_decl: type ID '=' expr ';'  */
+#line 70 "parser.y"
+        {
+          ID_TABLE* dir;
+          AST_NODE* id;
+          if ((yyvsp[-4].ival) == INTEGER) {
+            dir = add_id((yyvsp[-3].sval), TYPE_INT);
+            id = new_leaf_node(TYPE_ID, dir);
+          } else {
+            dir = add_id((yyvsp[-3].sval), TYPE_BOOL);
+            id = new_leaf_node(TYPE_ID, dir);
+          }
+          (yyval.node) = new_binary_node(OP_DECL, id, (yyvsp[-1].node));
+        }
+#line 1283 "parser.tab.c"
+    break;
+
+  case 8: /* var_decl: type ID ';'  */
+#line 83 "parser.y"
+        {
+          ID_TABLE* dir;
+          AST_NODE* id;
+          if ((yyvsp[-2].ival) == INTEGER) {
+            dir = add_id((yyvsp[-1].sval), TYPE_INT);
+            id = new_leaf_node(TYPE_ID, dir);
+          } else {
+            dir = add_id((yyvsp[-1].sval), TYPE_BOOL);
+            id = new_leaf_node(TYPE_ID, dir);
+          }
+          (yyval.node) = new_unary_node(OP_DECL, id);
+        }
+#line 1300 "parser.tab.c"
+    break;
+
+  case 9: /* var_decls: var_decls var_decl  */
+#line 98 "parser.y"
+                               { (yyval.nodelist) = append_expr((yyvsp[-1].nodelist), (yyvsp[0].node)); }
+#line 1306 "parser.tab.c"
+    break;
+
+  case 10: /* var_decls: %empty  */
+#line 99 "parser.y"
+                      { (yyval.nodelist) = NULL; }
+#line 1312 "parser.tab.c"
+    break;
+
+  case 11: /* method_decl: VOID ID '(' method_args ')' inline_attr block  */
+#line 103 "parser.y"
+                                                  {
+        add_method((yyvsp[-5].sval), RETURN_VOID, get_this_scope(), 0);
+        add_current_list((yyvsp[-5].sval), current_args_list);
+        (yyval.node) = new_method_decl_node((yyvsp[-5].sval), (yyvsp[0].node));
+        (yyval.node)->info->method_decl.inline_hint = (yyvsp[-1].ival);
+        current_args_list = NULL;
+        pop_scope();
+    }
+#line 1325 "parser.tab.c"
+    break;
+
+  case 12: /* method_decl: VOID ID '(' method_args ')' EXTERN ';'  */
+#line 112 "parser.y"
+                                           {
+        add_method((yyvsp[-5].sval), RETURN_VOID, get_this_scope(), 1);
+        add_current_list((yyvsp[-5].sval), current_args_list);
+        (yyval.node) = new_method_decl_node((yyvsp[-5].sval), NULL);
+        current_args_list = NULL;
+        pop_scope();
+    }
+#line 1337 "parser.tab.c"
+    break;
+
+  case 13: /* method_decl: type ID '(' method_args ')' inline_attr block  */
+#line 120 "parser.y"
+                                                  {
+        if ((yyvsp[-6].ival) == INTEGER) add_method((yyvsp[-5].sval), RETURN_INT, get_this_scope(), 0);
+        else if ((yyvsp[-6].ival) == BOOL) add_method((yyvsp[-5].sval), RETURN_BOOL, get_this_scope(), 0);
+        add_current_list((yyvsp[-5].sval), current_args_list);
+        (yyval.node) = new_method_decl_node((yyvsp[-5].sval), (yyvsp[0].node));
+        (yyval.node)->info->method_decl.inline_hint = (yyvsp[-1].ival);
+        current_args_list = NULL;
+        pop_scope();
+    }
+#line 1351 "parser.tab.c"
+    break;
+
+  case 14: /* method_decl: type ID '(' method_args ')' EXTERN ';'  */
+#line 130 "parser.y"
+                                           {
+        if ((yyvsp[-6].ival) == INTEGER) add_method((yyvsp[-5].sval), RETURN_INT, get_this_scope(), 1);
+        else if ((yyvsp[-6].ival) == BOOL) add_method((yyvsp[-5].sval), RETURN_BOOL, get_this_scope(), 1);
+        add_current_list((yyvsp[-5].sval), current_args_list);
+        (yyval.node) = new_method_decl_node((yyvsp[-5].sval), NULL);
+        current_args_list = NULL;
+        pop_scope();
+    }
+#line 1364 "parser.tab.c"
+    break;
+
+  case 15: /* inline_attr: %empty  */
+#line 141 "parser.y"
+                  { (yyval.ival) = INLINE_DEFAULT; }
+#line 1370 "parser.tab.c"
+    break;
+
+  case 16: /* inline_attr: INLINE  */
+#line 142 "parser.y"
+             { (yyval.ival) = INLINE_ALWAYS; }
+#line 1376 "parser.tab.c"
+    break;
+
+  case 17: /* inline_attr: NOINLINE  */
+#line 143 "parser.y"
+               { (yyval.ival) = INLINE_NEVER; }
+#line 1382 "parser.tab.c"
+    break;
+
+  case 18: /* $@1: %empty  */
+#line 147 "parser.y"
+      { push_scope(); suppress_next_block_push = 1; }
+#line 1388 "parser.tab.c"
+    break;
+
+  case 19: /* method_args: $@1 arg_list  */
+#line 147 "parser.y"
+                                                               {
+        (yyval.nodelist) = (yyvsp[0].nodelist);
+      }
+#line 1396 "parser.tab.c"
+    break;
+
+  case 20: /* $@2: %empty  */
+#line 150 "parser.y"
+      { push_scope(); suppress_next_block_push = 1; }
+#line 1402 "parser.tab.c"
+    break;
+
+  case 21: /* method_args: $@2  */
+#line 150 "parser.y"
+                                                                  {
+        (yyval.nodelist) = NULL;
+      }
+#line 1410 "parser.tab.c"
+    break;
+
+  case 22: /* arg_list: type ID  */
+#line 156 "parser.y"
+               {
+        ID_TABLE *dir = add_id((yyvsp[0].sval), ((yyvsp[-1].ival) == INTEGER) ? TYPE_INT : TYPE_BOOL);
+        (yyval.nodelist) = append_expr(NULL, new_leaf_node(TYPE_ID, dir));
+        current_args_list = add_arg_current_list(current_args_list, (yyvsp[0].sval), ((yyvsp[-1].ival) == INTEGER) ? TYPE_INT : TYPE_BOOL);
+      }
+#line 1420 "parser.tab.c"
+    break;
+
+  case 23: /* arg_list: arg_list ',' type ID  */
+#line 161 "parser.y"
+                           {
+        ID_TABLE *dir = add_id((yyvsp[0].sval), ((yyvsp[-1].ival) == INTEGER) ? TYPE_INT : TYPE_BOOL);
+        (yyval.nodelist) = append_expr((yyvsp[-3].nodelist), new_leaf_node(TYPE_ID, dir));
+        current_args_list = add_arg_current_list(current_args_list, (yyvsp[0].sval), ((yyvsp[-1].ival) == INTEGER) ? TYPE_INT : TYPE_BOOL);
+      }
+#line 1430 "parser.tab.c"
+    break;
+
+  case 24: /* type: INTEGER  */
+#line 170 "parser.y"
+              { (yyval.ival) = INTEGER; }
+#line 1436 "parser.tab.c"
+    break;
+
+  case 25: /* type: BOOL  */
+#line 171 "parser.y"
+           { (yyval.ival) = BOOL; }
+#line 1442 "parser.tab.c"
+    break;
+
+  case 26: /* $@3: %empty  */
+#line 175 "parser.y"
+        {
+        if (suppress_next_block_push) {
+            last_block_pushed = 0;
+            suppress_next_block_push = 0;
+        } else {
+            push_scope();
+            last_block_pushed = 1;
+        }
+  }
+#line 1456 "parser.tab.c"
+    break;
+
+  case 27: /* block: '{' $@3 var_decls statements '}'  */
+#line 183 "parser.y"
+                             {
+    /* Merge lists: statements first (which may contain assignments generated for
+                   initializations), then the other statements. */
+    AST_NODE_LIST* merged = (yyvsp[-2].nodelist); /* var_decls */
+    AST_NODE_LIST* it = (yyvsp[-1].nodelist);     /* statements */
+    while (it) {
+      if (it->first) {
+        merged = append_expr(merged, it->first);
+      }
+      it = it->next;
+    }
+    if (merged == NULL) {
+        (yyval.node) = NULL;
+    } else {
+        (yyval.node) = new_block_node(merged);
+    }
+    if (last_block_pushed) {
+        pop_scope();
+    }
+    }
+#line 1481 "parser.tab.c"
+    break;
+
+  case 28: /* statements: statements statement  */
+#line 206 "parser.y"
+                             { (yyval.nodelist) = append_expr((yyvsp[-1].nodelist), (yyvsp[0].node)); }
+#line 1487 "parser.tab.c"
+    break;
+
+  case 29: /* statements: %empty  */
+#line 207 "parser.y"
+                  { (yyval.nodelist) = NULL; }
+#line 1493 "parser.tab.c"
+    break;
+
+  case 30: /* statement: ID '=' expr ';'  */
+#line 212 "parser.y"
+        {
+          ID_TABLE* dir = find((yyvsp[-3].sval));
+          if (!dir) {
+            error_variable_not_declared(yylineno, (yyvsp[-3].sval));
+          }
+          AST_NODE* id = new_leaf_node(TYPE_ID, dir);
+          (yyval.node) = new_binary_node(OP_ASSIGN, id, (yyvsp[-1].node));
+        }
+#line 1506 "parser.tab.c"
+    break;
+
+  case 31: /* statement: method_call ';'  */
+#line 220 "parser.y"
+                      { (yyval.node) = (yyvsp[-1].node); }
+#line 1512 "parser.tab.c"
+    break;
+
+  case 32: /* statement: IF '(' expr ')' THEN block else  */
+#line 221 "parser.y"
+                                      { (yyval.node) = new_if_node((yyvsp[-4].node), (yyvsp[-1].node), (yyvsp[0].node)); }
+#line 1518 "parser.tab.c"
+    break;
+
+  case 33: /* statement: WHILE '(' expr ')' block  */
+#line 222 "parser.y"
+                               { (yyval.node) = new_while_node((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1524 "parser.tab.c"
+    break;
+
+  case 34: /* statement: RETURN expr ';'  */
+#line 223 "parser.y"
+                      { (yyval.node) = new_unary_node(OP_RETURN, (yyvsp[-1].node)); }
+#line 1530 "parser.tab.c"
+    break;
+
+  case 35: /* statement: RETURN ';'  */
+#line 224 "parser.y"
+                  { (yyval.node) = new_unary_node(OP_RETURN, NULL); }
+#line 1536 "parser.tab.c"
+    break;
+
+  case 36: /* statement: ';'  */
+#line 225 "parser.y"
+          { (yyval.node) = NULL; }
+#line 1542 "parser.tab.c"
+    break;
+
+  case 37: /* statement: block  */
+#line 226 "parser.y"
+            { (yyval.node) = (yyvsp[0].node); }
+#line 1548 "parser.tab.c"
+    break;
+
+  case 38: /* else: ELSE block  */
+#line 230 "parser.y"
+                   { (yyval.node) = (yyvsp[0].node); }
+#line 1554 "parser.tab.c"
+    break;
+
+  case 39: /* else: %empty  */
+#line 231 "parser.y"
+                   { (yyval.node) = NULL; }
+#line 1560 "parser.tab.c"
+    break;
+
+  case 40: /* expr: ID  */
+#line 235 "parser.y"
+         {
+        ID_TABLE* dir = find((yyvsp[0].sval));
+        if (!dir) {
+          error_variable_not_declared(yylineno, (yyvsp[0].sval));
+        }
+        (yyval.node) = new_leaf_node(TYPE_ID, dir);
+      }
+#line 1572 "parser.tab.c"
+    break;
+
+  case 41: /* expr: method_call  */
+#line 242 "parser.y"
+                  { (yyval.node) = (yyvsp[0].node); }
+#line 1578 "parser.tab.c"
+    break;
+
+  case 42: /* expr: literal  */
+#line 243 "parser.y"
+              { (yyval.node) = (yyvsp[0].node); }
+#line 1584 "parser.tab.c"
+    break;
+
+  case 43: /* expr: expr '+' expr  */
+#line 244 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_ADDITION, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1590 "parser.tab.c"
+    break;
+
+  case 44: /* expr: expr '-' expr  */
+#line 245 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_SUBTRACTION, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1596 "parser.tab.c"
+    break;
+
+  case 45: /* expr: expr '*' expr  */
+#line 246 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_MULTIPLICATION, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1602 "parser.tab.c"
+    break;
+
+  case 46: /* expr: expr '/' expr  */
+#line 247 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_DIVISION, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1608 "parser.tab.c"
+    break;
+
+  case 47: /* expr: expr '%' expr  */
+#line 248 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_MOD, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1614 "parser.tab.c"
+    break;
+
+  case 48: /* expr: expr LES expr  */
+#line 249 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_LES, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1620 "parser.tab.c"
+    break;
+
+  case 49: /* expr: expr GRT expr  */
+#line 250 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_GRT, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1626 "parser.tab.c"
+    break;
+
+  case 50: /* expr: expr EQ expr  */
+#line 251 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_EQ, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1632 "parser.tab.c"
+    break;
+
+  case 51: /* expr: expr NEQ expr  */
+#line 252 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_NEQ, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1638 "parser.tab.c"
+    break;
+
+  case 52: /* expr: expr LEQ expr  */
+#line 253 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_LEQ, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1644 "parser.tab.c"
+    break;
+
+  case 53: /* expr: expr GEQ expr  */
+#line 254 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_GEQ, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1650 "parser.tab.c"
+    break;
+
+  case 54: /* expr: expr AND expr  */
+#line 255 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_AND, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1656 "parser.tab.c"
+    break;
+
+  case 55: /* expr: expr OR expr  */
+#line 256 "parser.y"
+                    { (yyval.node) = new_binary_node(OP_OR, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1662 "parser.tab.c"
+    break;
+
+  case 56: /* expr: '-' expr  */
+#line 257 "parser.y"
+                            { (yyval.node) = new_unary_node(OP_MINUS, (yyvsp[0].node)); }
+#line 1668 "parser.tab.c"
+    break;
+
+  case 57: /* expr: NEG expr  */
+#line 258 "parser.y"
+               { (yyval.node) = new_unary_node(OP_NEG, (yyvsp[0].node)); }
+#line 1674 "parser.tab.c"
+    break;
+
+  case 58: /* expr: '(' expr ')'  */
+#line 259 "parser.y"
+                   { (yyval.node) = (yyvsp[-1].node); }
+#line 1680 "parser.tab.c"
+    break;
+
+  case 59: /* method_call: ID '(' call_args ')'  */
+#line 263 "parser.y"
+                           { (yyval.node) = new_method_call_node((yyvsp[-3].sval), (yyvsp[-1].nodelist)); }
+#line 1686 "parser.tab.c"
+    break;
+
+  case 60: /* call_args: expr_list  */
+#line 267 "parser.y"
+                { (yyval.nodelist) = (yyvsp[0].nodelist); }
+#line 1692 "parser.tab.c"
+    break;
+
+  case 61: /* call_args: %empty  */
+#line 268 "parser.y"
+                  { (yyval.nodelist) = NULL; }
+#line 1698 "parser.tab.c"
+    break;
+
+  case 62: /* expr_list: expr  */
+#line 272 "parser.y"
+           { (yyval.nodelist) = append_expr(NULL, (yyvsp[0].node)); }
+#line 1704 "parser.tab.c"
+    break;
+
+  case 63: /* expr_list: expr_list ',' expr  */
+#line 273 "parser.y"
+                         { (yyval.nodelist) = append_expr((yyvsp[-2].nodelist), (yyvsp[0].node)); }
+#line 1710 "parser.tab.c"
+    break;
+
+  case 64: /* literal: INTEGER_LITERAL  */
+#line 277 "parser.y"
+                    { (yyval.node) = new_leaf_node(TYPE_INT, &(yyvsp[0].ival)); }
+#line 1716 "parser.tab.c"
+    break;
+
+  case 65: /* literal: TRUE  */
+#line 278 "parser.y"
+                   { int v = 1; (yyval.node) = new_leaf_node(TYPE_BOOL, &v); }
+#line 1722 "parser.tab.c"
+    break;
+
+  case 66: /* literal: FALSE  */
+#line 279 "parser.y"
+                   { int v = 0; (yyval.node) = new_leaf_node(TYPE_BOOL, &v); }
+#line 1728 "parser.tab.c"
+    break;
+
+
+#line 1732 "parser.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 282 "parser.y"
+
+
+void yyerror(const char *s) {
+    error_parse(yylineno, (char *)s);
+}
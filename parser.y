@@ -31,7 +31,7 @@ int last_block_pushed = 0;
     AST_NODE_LIST* nodelist;
 }
 
-%token PROGRAM IF ELSE THEN WHILE VOID RETURN EXTERN BOOL INTEGER FALSE TRUE
+%token PROGRAM IF ELSE THEN WHILE VOID RETURN EXTERN INLINE NOINLINE BOOL INTEGER FALSE TRUE
 %token <ival> INTEGER_LITERAL
 %token <sval> ID
 %token AND OR NEG EQ NEQ LEQ GEQ
@@ -47,7 +47,7 @@ int last_block_pushed = 0;
 
 %type <node> program decls decl var_decl method_decl block statement expr literal method_call else
 %type <nodelist> method_args arg_list expr_list call_args statements var_decls
-%type <ival> type
+%type <ival> type inline_attr
 
 %%
 
@@ -100,10 +100,11 @@ var_decls:
         ;
 
 method_decl:
-    VOID ID '(' method_args ')' block {
+    VOID ID '(' method_args ')' inline_attr block {
         add_method($2, RETURN_VOID, get_this_scope(), 0);
         add_current_list($2, current_args_list);
-        $$ = new_method_decl_node($2, $6);
+        $$ = new_method_decl_node($2, $7);
+        $$->info->method_decl.inline_hint = $6;
         current_args_list = NULL;
         pop_scope();
     }
@@ -116,11 +117,12 @@ method_decl:
         pop_scope();
     }
   |
-    type ID '(' method_args ')' block {
+    type ID '(' method_args ')' inline_attr block {
         if ($1 == INTEGER) add_method($2, RETURN_INT, get_this_scope(), 0);
         else if ($1 == BOOL) add_method($2, RETURN_BOOL, get_this_scope(), 0);
         add_current_list($2, current_args_list);
-        $$ = new_method_decl_node($2, $6);
+        $$ = new_method_decl_node($2, $7);
+        $$->info->method_decl.inline_hint = $6;
         current_args_list = NULL;
         pop_scope();
     }
@@ -135,6 +137,12 @@ method_decl:
     }
 ;
 
+inline_attr:
+      /* empty */ { $$ = INLINE_DEFAULT; }
+    | INLINE { $$ = INLINE_ALWAYS; }
+    | NOINLINE { $$ = INLINE_NEVER; }
+    ;
+
 method_args
     : { push_scope(); suppress_next_block_push = 1; } arg_list {
         $$ = $2;
@@ -4,6 +4,9 @@ int line = 0;
 int returned_global = 0; // Global flag set when a return statement has been encountered and propagated.
 RET_TYPE method_return_type; // Current method's expected return TYPE (used when checking return statements).
 int main_defined = 0; // Flag to check if main method is defined.
+ID_TABLE* current_method = NULL; // Method whose body is being evaluated (NULL for global declarations).
+INFO** global_callees = NULL; // Methods called by the initializations of globals.
+int num_global_callees = 0;
 
 extern int optimizations;
 
@@ -283,7 +286,7 @@ static void eval_while(AST_NODE *tree){
         error_conditional(line);
     }
     eval(tree->info->while_stmt.block, &retBlock);
-    if (condition->info->type == AST_LEAF && optimizations) {
+    if (condition->info->type == AST_LEAF && condition->info->leaf.type == TYPE_BOOL && optimizations) {
         line = tree->info->while_stmt.block->info->block.stmts->first->line - 1;
         if (condition->info->leaf.value->bool_value == 0) {
             tree->info->while_stmt.block = NULL;
@@ -376,7 +379,7 @@ static void eval_if(AST_NODE *tree, RET_TYPE *ret) {
     if(retCondition != BOOL_TYPE) {
         error_conditional(line);
     }
-    if (condition->info->type == AST_LEAF && optimizations) {
+    if (condition->info->type == AST_LEAF && condition->info->leaf.type == TYPE_BOOL && optimizations) {
         if (condition->info->leaf.value->bool_value == 1) {
             eval(then_block, &retThen);
             tree->info->if_stmt.else_block = NULL;
@@ -424,6 +427,32 @@ static void eval_if(AST_NODE *tree, RET_TYPE *ret) {
     }
 }
 
+/*
+ * Adds the edge caller -> callee to the call graph. Calls outside methods (initializations of globals) are saved
+ * in global_callees, they always run.
+ */
+static void add_call_edge(ID_TABLE* caller, ID_TABLE* callee) {
+    INFO*** callees = caller ? &caller->info->method_decl.callees : &global_callees;
+    int* num_callees = caller ? &caller->info->method_decl.num_callees : &num_global_callees;
+    for (int i = 0; i < *num_callees; i++) {
+        if ((*callees)[i] == callee->info) return;
+    }
+    *callees = realloc(*callees, (*num_callees + 1) * sizeof(INFO*));
+    if (!*callees) error_allocate_mem();
+    (*callees)[(*num_callees)++] = callee->info;
+}
+
+/*
+ * Marks the method and every method it can call as reachable.
+ */
+static void mark_reachable(INFO* method) {
+    if (method->method_decl.is_reachable) return;
+    method->method_decl.is_reachable = 1;
+    for (int i = 0; i < method->method_decl.num_callees; i++) {
+        mark_reachable(method->method_decl.callees[i]);
+    }
+}
+
 /*
  * Evaluates a method call node.
  * First, look up the method in the symbol table.
@@ -441,6 +470,7 @@ static void eval_method_call(AST_NODE *tree, RET_TYPE *ret) {
     if (method->info->type != AST_METHOD_DECL) {
         error_type_mismatch(line, tree->info->method_call.name, "METHOD");
     }
+    add_call_edge(current_method, method);
     ARGS_LIST* method_args = method->info->method_decl.args;
     AST_NODE_LIST* call_args = tree->info->method_call.args;
     if (method->info->method_decl.num_args != tree->info->method_call.num_args) {
@@ -507,7 +537,9 @@ static void eval_method_decl(AST_NODE *tree, RET_TYPE *ret) {
             break;
     }
     if (!tree->info->method_decl.is_extern) {
+        current_method = method;
         eval(tree->info->method_decl.block, ret);
+        current_method = NULL;
     }
     if (*ret == NULL_TYPE && method_return_type != VOID_TYPE) { // If no return was found and method should return something.
         error_missing_return(tree->info->method_decl.name, method_return_type);
@@ -565,4 +597,15 @@ void semantic_analyzer(AST_ROOT *tree) {
     if (!main_defined) {
         error_main_missing();
     }
+    // Call graph rooted at main: only the methods it can reach need code. An extern main can call any of them
+    ID_TABLE* main_method = find_global("main");
+    if (main_method->info->method_decl.is_extern) {
+        for (ID_TABLE* cur = global_level->head_block; cur; cur = cur->next) {
+            if (cur->info->type == AST_METHOD_DECL) cur->info->method_decl.is_reachable = 1;
+        }
+    }
+    mark_reachable(main_method->info);
+    for (int i = 0; i < num_global_callees; i++) {
+        mark_reachable(global_callees[i]);
+    }
 }
\ No newline at end of file
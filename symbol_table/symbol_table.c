@@ -112,6 +112,10 @@ ID_TABLE* add_method(char* name, const RETURN_TYPE ret_type, TABLE_STACK* method
     aux->info->method_decl.args = NULL;
     aux->info->method_decl.scope = method_scope;
     aux->info->method_decl.is_extern = is_extern;
+    aux->info->method_decl.inline_hint = INLINE_DEFAULT;
+    aux->info->method_decl.callees = NULL;
+    aux->info->method_decl.num_callees = 0;
+    aux->info->method_decl.is_reachable = 0;
 
     if (!global_level) st_init();
 
@@ -0,0 +1,60 @@
+#!/bin/bash
+
+echo "Verifying ctds in current directory"
+if [ ! -x ./ctds ]; then
+    echo "Error: ./ctds cannot be found or is not executable."
+    exit 1
+fi
+
+BENCH_DIR="tests/benchmarks"
+EXE_DIR="tests/output_bench"
+RESULTS_FILE="tests/output_bench/results"
+mkdir -p "$EXE_DIR"
+> "$RESULTS_FILE"
+
+# Compiles $1 with the flags in $3... into the executable $2
+build() {
+    local src="$1" exe="$2"
+    shift 2
+    rm -f object_code/*.s
+    ./ctds "$src" "$@" -target assembly > /dev/null 2> /dev/null
+    local obj_generated=$(ls object_code/*.s 2>/dev/null | head -1)
+    if [ -n "$obj_generated" ] && [ -f "$obj_generated" ]; then
+        gcc -no-pie "$obj_generated" libraries/ctdsio.o -o "$exe" 2>/dev/null
+    fi
+    rm -f object_code/*.s
+}
+
+# Prints the time in milliseconds that the executable $1 takes, and saves its output in $2
+measure() {
+    local start end
+    start=$(date +%s%N)
+    "$1" > "$2" 2>/dev/null
+    end=$(date +%s%N)
+    echo $(( (end - start) / 1000000 ))
+}
+
+printf "%-28s %12s %12s %8s\n" "benchmark" "plain (ms)" "-opt (ms)" "speedup" | tee -a "$RESULTS_FILE"
+for file in "$BENCH_DIR"/*.ctds; do
+    if [ -f "$file" ]; then
+        base=$(basename "$file" .ctds)
+        build "$file" "$EXE_DIR/${base}.exe"
+        # A benchmark can ask for more optimization flags with a "/* flags: ... */" line
+        flags=$(sed -n 's|^[[:space:]]*/\* flags: \(.*\) \*/$|\1|p' "$file" | head -1)
+        build "$file" "$EXE_DIR/${base}_opt.exe" -opt $flags
+        if [ ! -f "$EXE_DIR/${base}.exe" ] || [ ! -f "$EXE_DIR/${base}_opt.exe" ]; then
+            echo "[WARN] Could not build $file" | tee -a "$RESULTS_FILE"
+            continue
+        fi
+        plain=$(measure "$EXE_DIR/${base}.exe" "$EXE_DIR/${base}.out")
+        opt=$(measure "$EXE_DIR/${base}_opt.exe" "$EXE_DIR/${base}_opt.out")
+        if ! cmp -s "$EXE_DIR/${base}.out" "$EXE_DIR/${base}_opt.out"; then
+            echo "[FAIL] $base: optimized output differs" | tee -a "$RESULTS_FILE"
+            continue
+        fi
+        speedup=$(awk -v p="$plain" -v o="$opt" 'BEGIN { if (o > 0) printf "%.2fx", p / o; else print "-" }')
+        printf "%-28s %12s %12s %8s\n" "$base" "$plain" "$opt" "$speedup" | tee -a "$RESULTS_FILE"
+    fi
+done
+
+echo "Results saved in $RESULTS_FILE"
@@ -0,0 +1,263 @@
+.data
+last$global:
+  .quad 0
+.text
+.extern print_int
+
+.globl min
+min:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $16, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jge _L0
+  movq -8(%rbp), %rax
+  jmp .L_leave_min
+  jmp _L1
+_L0:
+  movq -16(%rbp), %rax
+  jmp .L_leave_min
+_L1:
+.L_leave_min:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl clamp
+clamp:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -24(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jge _L2
+  movq -16(%rbp), %rax
+  movq %rax, -8(%rbp)
+  jmp _L3
+_L2:
+_L3:
+  movq -8(%rbp), %rax
+  cmpq -24(%rbp), %rax
+  jle _L4
+  movq -24(%rbp), %rax
+  movq %rax, -8(%rbp)
+  jmp _L5
+_L4:
+_L5:
+  movq -8(%rbp), %rax
+.L_leave_clamp:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl absolute
+absolute:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -24(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jl _L6
+  movq -24(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L7
+_L6:
+  movq -24(%rbp), %rax
+  negq %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L7:
+  movq -16(%rbp), %rax
+.L_leave_absolute:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl remember
+remember:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq -8(%rbp), %rax
+  testq %rax, %rax
+  jz _L8
+  movq $1, -24(%rbp)
+  movq -16(%rbp), %rax
+  addq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rax
+  movq %rax, last$global(%rip)
+  jmp _L9
+_L8:
+_L9:
+.L_leave_remember:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl nested
+nested:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -24(%rbp)
+  movq %rsi, -40(%rbp)
+  movq $1, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jle _L10
+  movq $0, -48(%rbp)
+  movq -40(%rbp), %rax
+  cmpq -48(%rbp), %rax
+  jle _L12
+  movq -24(%rbp), %rax
+  subq -40(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L13
+_L12:
+_L13:
+  jmp _L11
+_L10:
+_L11:
+  movq -16(%rbp), %rax
+.L_leave_nested:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $320, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, last$global(%rip)
+  movq $0, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $0, -32(%rbp)
+  movq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $7, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+_L14:
+  movq $50, -64(%rbp)
+  movq -40(%rbp), %rax
+  cmpq -64(%rbp), %rax
+  jge _L15
+  movq $31, -72(%rbp)
+  movq -56(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $1009, -88(%rbp)
+  movq -80(%rbp), %rax
+  cqto
+  idivq -88(%rbp)
+  movq %rdx, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $500, -104(%rbp)
+  movq -56(%rbp), %rdi
+  movq -104(%rbp), %rsi
+  call min
+  movq %rax, -112(%rbp)
+  movq -24(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq $100, -128(%rbp)
+  movq $900, -136(%rbp)
+  movq -56(%rbp), %rdi
+  movq -128(%rbp), %rsi
+  movq -136(%rbp), %rdx
+  call clamp
+  movq %rax, -144(%rbp)
+  movq $3, -152(%rbp)
+  movq -144(%rbp), %rax
+  imulq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -120(%rbp), %rax
+  addq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq $504, -176(%rbp)
+  movq -56(%rbp), %rax
+  subq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq -184(%rbp), %rdi
+  call absolute
+  movq %rax, -192(%rbp)
+  movq -168(%rbp), %rax
+  addq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq -200(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $3, -208(%rbp)
+  movq -56(%rbp), %rax
+  cqto
+  idivq -208(%rbp)
+  movq %rdx, -216(%rbp)
+  movq $0, -224(%rbp)
+  movq -216(%rbp), %rax
+  cmpq -224(%rbp), %rax
+  sete %al
+  movzbq %al, %rax
+  movq %rax, -232(%rbp)
+  movq -232(%rbp), %rdi
+  movq -56(%rbp), %rsi
+  call remember
+  movq %rax, -240(%rbp)
+  movq -24(%rbp), %rax
+  addq last$global(%rip), %rax
+  movq %rax, -248(%rbp)
+  movq $400, -256(%rbp)
+  movq -56(%rbp), %rax
+  subq -256(%rbp), %rax
+  movq %rax, -264(%rbp)
+  movq $700, -272(%rbp)
+  movq -56(%rbp), %rax
+  subq -272(%rbp), %rax
+  movq %rax, -280(%rbp)
+  movq -264(%rbp), %rdi
+  movq -280(%rbp), %rsi
+  call nested
+  movq %rax, -288(%rbp)
+  movq -248(%rbp), %rax
+  addq -288(%rbp), %rax
+  movq %rax, -296(%rbp)
+  movq -296(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $1, -304(%rbp)
+  movq -40(%rbp), %rax
+  addq -304(%rbp), %rax
+  movq %rax, -312(%rbp)
+  movq -312(%rbp), %rax
+  movq %rax, -40(%rbp)
+  jmp _L14
+_L15:
+  movq -24(%rbp), %rdi
+  call print_int
+  movq %rax, -320(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,442 @@
+.text
+.extern print_int
+
+.globl weigh
+weigh:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $224, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -24(%rbp)
+  movq %rdx, -56(%rbp)
+  movq %rcx, -88(%rbp)
+  movq %r8, -120(%rbp)
+  movq %r9, -152(%rbp)
+  movq $2, -16(%rbp)
+  movq -16(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -8(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $3, -48(%rbp)
+  movq -48(%rbp), %rax
+  imulq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -40(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $4, -80(%rbp)
+  movq -80(%rbp), %rax
+  imulq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -72(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq $5, -112(%rbp)
+  movq -112(%rbp), %rax
+  imulq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -104(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq $6, -144(%rbp)
+  movq -144(%rbp), %rax
+  imulq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -136(%rbp), %rax
+  addq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq $7, -176(%rbp)
+  movq -176(%rbp), %rax
+  imulq 16(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq -168(%rbp), %rax
+  addq -184(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq $8, -200(%rbp)
+  movq -200(%rbp), %rax
+  imulq 24(%rbp), %rax
+  movq %rax, -208(%rbp)
+  movq -192(%rbp), %rax
+  addq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -216(%rbp), %rax
+.L_leave_weigh:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl spread
+spread:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $224, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -48(%rbp)
+  movq %rcx, -56(%rbp)
+  movq %r8, -80(%rbp)
+  movq %r9, -96(%rbp)
+  movq -8(%rbp), %rax
+  subq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $3, -32(%rbp)
+  movq -24(%rbp), %rax
+  imulq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -48(%rbp), %rax
+  imulq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -40(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  subq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $7, -104(%rbp)
+  movq -96(%rbp), %rax
+  cqto
+  idivq -104(%rbp)
+  movq %rdx, -112(%rbp)
+  movq -88(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq $11, -128(%rbp)
+  movq 16(%rbp), %rax
+  imulq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -120(%rbp), %rax
+  addq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq -144(%rbp), %rax
+  addq 24(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq $13, -160(%rbp)
+  movq 32(%rbp), %rax
+  imulq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq -152(%rbp), %rax
+  subq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq $17, -184(%rbp)
+  movq 40(%rbp), %rax
+  imulq -184(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq -176(%rbp), %rax
+  addq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq $19, -208(%rbp)
+  movq 48(%rbp), %rax
+  imulq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -200(%rbp), %rax
+  addq -216(%rbp), %rax
+  movq %rax, -224(%rbp)
+  movq -224(%rbp), %rax
+.L_leave_spread:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl is_multiple
+is_multiple:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -16(%rbp)
+  movq %rdx, -24(%rbp)
+  movq $0, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  sete %al
+  movzbq %al, %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+.L_leave_is_multiple:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl in_range
+in_range:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -32(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jge _L0
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_in_range
+  jmp _L1
+_L0:
+_L1:
+  movq -8(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  setle %al
+  movzbq %al, %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+.L_leave_in_range:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl is_even
+is_even:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L2
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_is_even
+  jmp _L3
+_L2:
+_L3:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call is_odd
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+.L_leave_is_even:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl is_odd
+is_odd:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L4
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_is_odd
+  jmp _L5
+_L4:
+_L5:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call is_even
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+.L_leave_is_odd:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $480, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $0, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+_L6:
+  movq $200, -56(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jge _L7
+  movq $1, -64(%rbp)
+  movq $2, -72(%rbp)
+  movq $3, -80(%rbp)
+  movq $4, -88(%rbp)
+  movq $5, -96(%rbp)
+  movq $6, -104(%rbp)
+  movq $9, -112(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -112(%rbp)
+  movq %rdx, -120(%rbp)
+  movq -16(%rbp), %rdi
+  movq -64(%rbp), %rsi
+  movq -72(%rbp), %rdx
+  movq -80(%rbp), %rcx
+  movq -88(%rbp), %r8
+  movq -96(%rbp), %r9
+  pushq -120(%rbp)
+  pushq -104(%rbp)
+  call weigh
+  movq %rax, -128(%rbp)
+  addq $16, %rsp
+  movq $1000, -136(%rbp)
+  movq -128(%rbp), %rax
+  cqto
+  idivq -136(%rbp)
+  movq %rdx, -144(%rbp)
+  movq -32(%rbp), %rax
+  addq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $2, -160(%rbp)
+  movq -16(%rbp), %rax
+  addq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq $3, -176(%rbp)
+  movq -16(%rbp), %rax
+  imulq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq $4, -192(%rbp)
+  movq -16(%rbp), %rax
+  addq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq $3, -208(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -208(%rbp)
+  movq %rdx, -216(%rbp)
+  movq $6, -224(%rbp)
+  movq -16(%rbp), %rax
+  addq -224(%rbp), %rax
+  movq %rax, -232(%rbp)
+  movq $7, -240(%rbp)
+  movq -16(%rbp), %rax
+  subq -240(%rbp), %rax
+  movq %rax, -248(%rbp)
+  movq $5, -256(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -256(%rbp)
+  movq %rdx, -264(%rbp)
+  movq $10, -272(%rbp)
+  movq -16(%rbp), %rax
+  addq -272(%rbp), %rax
+  movq %rax, -280(%rbp)
+  movq $11, -288(%rbp)
+  movq -16(%rbp), %rax
+  imulq -288(%rbp), %rax
+  movq %rax, -296(%rbp)
+  movq -16(%rbp), %rdi
+  movq -168(%rbp), %rsi
+  movq -184(%rbp), %rdx
+  movq -200(%rbp), %rcx
+  movq -216(%rbp), %r8
+  movq -232(%rbp), %r9
+  subq $8, %rsp
+  pushq -296(%rbp)
+  pushq -280(%rbp)
+  pushq -264(%rbp)
+  pushq -16(%rbp)
+  pushq -248(%rbp)
+  call spread
+  movq %rax, -304(%rbp)
+  addq $48, %rsp
+  movq $500, -312(%rbp)
+  movq -304(%rbp), %rax
+  cqto
+  idivq -312(%rbp)
+  movq %rdx, -320(%rbp)
+  movq -32(%rbp), %rax
+  addq -320(%rbp), %rax
+  movq %rax, -328(%rbp)
+  movq -328(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $7, -336(%rbp)
+  movq -16(%rbp), %rdi
+  movq -336(%rbp), %rsi
+  call is_multiple
+  movq %rax, -344(%rbp)
+  movq -344(%rbp), %rax
+  testq %rax, %rax
+  jz _L8
+  movq $13, -352(%rbp)
+  movq -32(%rbp), %rax
+  addq -352(%rbp), %rax
+  movq %rax, -360(%rbp)
+  movq -360(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L9
+_L8:
+_L9:
+  movq $50, -368(%rbp)
+  movq $120, -376(%rbp)
+  movq -16(%rbp), %rdi
+  movq -368(%rbp), %rsi
+  movq -376(%rbp), %rdx
+  call in_range
+  movq %rax, -384(%rbp)
+  movq -384(%rbp), %rax
+  testq %rax, %rax
+  jnz _L10
+  movq $1, -392(%rbp)
+  movq -32(%rbp), %rax
+  addq -392(%rbp), %rax
+  movq %rax, -400(%rbp)
+  movq -400(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L11
+_L10:
+_L11:
+  movq -16(%rbp), %rdi
+  call is_even
+  movq %rax, -408(%rbp)
+  movq -408(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  jz _L12
+  movq $3, -416(%rbp)
+  movq -16(%rbp), %rax
+  addq -416(%rbp), %rax
+  movq %rax, -424(%rbp)
+  movq -424(%rbp), %rdi
+  call is_odd
+  movq %rax, -432(%rbp)
+  movq -432(%rbp), %rax
+  testq %rax, %rax
+  jz _L12
+  movq $2, -440(%rbp)
+  movq -32(%rbp), %rax
+  addq -440(%rbp), %rax
+  movq %rax, -448(%rbp)
+  movq -448(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L13
+_L12:
+_L13:
+  movq $1, -456(%rbp)
+  movq -16(%rbp), %rax
+  addq -456(%rbp), %rax
+  movq %rax, -464(%rbp)
+  movq -464(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L6
+_L7:
+  movq -32(%rbp), %rdi
+  call print_int
+  movq %rax, -472(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
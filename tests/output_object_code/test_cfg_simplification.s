@@ -0,0 +1,175 @@
+.text
+.extern print_int
+
+.globl classify
+classify:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $96, %rsp
+  movq %rdi, -24(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $10, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jle _L0
+  movq $20, -40(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jle _L2
+  movq $3, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L3
+_L2:
+  movq $2, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L3:
+  jmp _L1
+_L0:
+  movq $0, -64(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -64(%rbp), %rax
+  jle _L4
+  movq $1, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L5
+_L4:
+_L5:
+_L1:
+  movq $15, -80(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -80(%rbp), %rax
+  jne _L6
+  movq $100, -88(%rbp)
+  movq -16(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  jmp .L_leave_classify
+  jmp _L7
+_L6:
+_L7:
+  movq -16(%rbp), %rax
+.L_leave_classify:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl nested_loops
+nested_loops:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L8:
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L9
+  movq $0, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+_L10:
+  movq -56(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jge _L11
+  movq $2, -64(%rbp)
+  movq -56(%rbp), %rax
+  cqto
+  idivq -64(%rbp)
+  movq %rdx, -72(%rbp)
+  movq $0, -80(%rbp)
+  movq -72(%rbp), %rax
+  cmpq -80(%rbp), %rax
+  jne _L12
+  movq -32(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L13
+_L12:
+_L13:
+  movq $1, -96(%rbp)
+  movq -56(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -56(%rbp)
+  jmp _L10
+_L11:
+  movq $1, -112(%rbp)
+  movq -16(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L8
+_L9:
+  movq -32(%rbp), %rax
+.L_leave_nested_loops:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $144, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $5, -24(%rbp)
+  movq -24(%rbp), %rax
+  negq %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call classify
+  movq %rax, -40(%rbp)
+  movq $5, -48(%rbp)
+  movq -48(%rbp), %rdi
+  call classify
+  movq %rax, -56(%rbp)
+  movq -40(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $15, -72(%rbp)
+  movq -72(%rbp), %rdi
+  call classify
+  movq %rax, -80(%rbp)
+  movq -64(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $25, -96(%rbp)
+  movq -96(%rbp), %rdi
+  call classify
+  movq %rax, -104(%rbp)
+  movq -88(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $6, -120(%rbp)
+  movq -120(%rbp), %rdi
+  call nested_loops
+  movq %rax, -128(%rbp)
+  movq -112(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call print_int
+  movq %rax, -144(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
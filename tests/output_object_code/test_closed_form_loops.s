@@ -0,0 +1,319 @@
+.data
+total$global:
+  .quad 0
+.text
+.extern print_int
+
+.globl triangle
+triangle:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L1
+  movq -16(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -56(%rbp)
+  movq -32(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L0
+_L1:
+  movq -16(%rbp), %rax
+.L_leave_triangle:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl mixed
+mixed:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $160, %rsp
+  movq %rdi, -56(%rbp)
+  movq %rsi, -80(%rbp)
+  movq %rdx, -104(%rbp)
+  movq $5, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $2, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+_L2:
+  movq -48(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jg _L3
+  movq $3, -64(%rbp)
+  movq -48(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  imulq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -16(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  subq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $2, -120(%rbp)
+  movq -32(%rbp), %rax
+  subq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L2
+_L3:
+  movq $1000, -136(%rbp)
+  movq -16(%rbp), %rax
+  imulq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq -144(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -160(%rbp), %rax
+.L_leave_mixed:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl down
+down:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $96, %rsp
+  movq %rdi, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L4:
+  movq $5, -24(%rbp)
+  movq -24(%rbp), %rax
+  negq %rax
+  movq %rax, -32(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jl _L5
+  movq $2, -40(%rbp)
+  movq -40(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq total$global(%rip), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $1, -64(%rbp)
+  movq -56(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, total$global(%rip)
+  movq $2, -80(%rbp)
+  movq -16(%rbp), %rax
+  subq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L4
+_L5:
+.L_leave_down:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl unused
+unused:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L6:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L7
+  movq $3, -48(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rdx, -56(%rbp)
+  movq $0, -64(%rbp)
+  movq -56(%rbp), %rax
+  cmpq -64(%rbp), %rax
+  jne _L8
+  movq $3, -72(%rbp)
+  movq -32(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -16(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L9
+_L8:
+_L9:
+  movq $1, -96(%rbp)
+  movq -32(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L6
+_L7:
+  movq -40(%rbp), %rax
+.L_leave_unused:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl product
+product:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -40(%rbp)
+  movq $1, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L10:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jg _L11
+  movq $3, -48(%rbp)
+  movq -16(%rbp), %rax
+  imulq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -72(%rbp)
+  movq -32(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L10
+_L11:
+  movq -16(%rbp), %rax
+.L_leave_product:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $256, %rsp
+  movq $100, -8(%rbp)
+  movq -8(%rbp), %rdi
+  call triangle
+  movq %rax, -16(%rbp)
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rdi
+  call triangle
+  movq %rax, -32(%rbp)
+  movq -16(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $50, -48(%rbp)
+  movq $7, -56(%rbp)
+  movq $3, -64(%rbp)
+  movq -48(%rbp), %rdi
+  movq -56(%rbp), %rsi
+  movq -64(%rbp), %rdx
+  call mixed
+  movq %rax, -72(%rbp)
+  movq -40(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $2, -88(%rbp)
+  movq $4, -96(%rbp)
+  movq $1, -104(%rbp)
+  movq -88(%rbp), %rdi
+  movq -96(%rbp), %rsi
+  movq -104(%rbp), %rdx
+  call mixed
+  movq %rax, -112(%rbp)
+  movq -80(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq $0, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, total$global(%rip)
+  movq $20, -144(%rbp)
+  movq -144(%rbp), %rdi
+  call down
+  movq %rax, -152(%rbp)
+  movq $5, -160(%rbp)
+  movq -160(%rbp), %rax
+  negq %rax
+  movq %rax, -168(%rbp)
+  movq -168(%rbp), %rdi
+  call down
+  movq %rax, -176(%rbp)
+  movq $10, -184(%rbp)
+  movq total$global(%rip), %rax
+  imulq -184(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq -128(%rbp), %rax
+  addq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq $1000000, -208(%rbp)
+  movq -208(%rbp), %rdi
+  call unused
+  movq %rax, -216(%rbp)
+  movq -200(%rbp), %rax
+  addq -216(%rbp), %rax
+  movq %rax, -224(%rbp)
+  movq $6, -232(%rbp)
+  movq -232(%rbp), %rdi
+  call product
+  movq %rax, -240(%rbp)
+  movq -224(%rbp), %rax
+  addq -240(%rbp), %rax
+  movq %rax, -248(%rbp)
+  movq -248(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rdi
+  call print_int
+  movq %rax, -256(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,388 @@
+.text
+.extern print_int
+
+.globl fact
+fact:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -8(%rbp)
+  movq $1, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jg _L0
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_fact
+  jmp _L1
+_L0:
+_L1:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call fact
+  movq %rax, -48(%rbp)
+  movq -8(%rbp), %rax
+  imulq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+.L_leave_fact:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl fib
+fib:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -8(%rbp)
+  movq $2, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jge _L2
+  movq -8(%rbp), %rax
+  jmp .L_leave_fib
+  jmp _L3
+_L2:
+_L3:
+  movq $1, -24(%rbp)
+  movq -8(%rbp), %rax
+  subq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call fib
+  movq %rax, -40(%rbp)
+  movq $2, -48(%rbp)
+  movq -8(%rbp), %rax
+  subq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rdi
+  call fib
+  movq %rax, -64(%rbp)
+  movq -40(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+.L_leave_fib:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl gcd
+gcd:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -32(%rbp)
+  movq %rsi, -8(%rbp)
+_L4:
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  je _L5
+  movq -8(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -8(%rbp)
+  movq %rdx, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -8(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L4
+_L5:
+  movq -32(%rbp), %rax
+.L_leave_gcd:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl collatz
+collatz:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -24(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L6:
+  movq $1, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  je _L7
+  movq $2, -40(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -40(%rbp)
+  movq %rdx, -48(%rbp)
+  movq $0, -56(%rbp)
+  movq -48(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jne _L8
+  movq $2, -64(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -64(%rbp)
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -24(%rbp)
+  jmp _L9
+_L8:
+  movq $3, -80(%rbp)
+  movq -80(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $1, -96(%rbp)
+  movq -88(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -24(%rbp)
+_L9:
+  movq $1, -112(%rbp)
+  movq -16(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L6
+_L7:
+  movq -16(%rbp), %rax
+.L_leave_collatz:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl is_prime
+is_prime:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $96, %rsp
+  movq %rdi, -24(%rbp)
+  movq $2, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $2, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jge _L10
+  movq $0, -40(%rbp)
+  movq -40(%rbp), %rax
+  jmp .L_leave_is_prime
+  jmp _L11
+_L10:
+_L11:
+_L12:
+  movq -16(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  cmpq -24(%rbp), %rax
+  jg _L13
+  movq -24(%rbp), %rax
+  cqto
+  idivq -16(%rbp)
+  movq %rdx, -56(%rbp)
+  movq $0, -64(%rbp)
+  movq -56(%rbp), %rax
+  cmpq -64(%rbp), %rax
+  jne _L14
+  movq $0, -72(%rbp)
+  movq -72(%rbp), %rax
+  jmp .L_leave_is_prime
+  jmp _L15
+_L14:
+_L15:
+  movq $1, -80(%rbp)
+  movq -16(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L12
+_L13:
+  movq $1, -96(%rbp)
+  movq -96(%rbp), %rax
+.L_leave_is_prime:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl long_sum
+long_sum:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L16:
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L17
+  movq $7, -48(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rdx, -56(%rbp)
+  movq -32(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -72(%rbp)
+  movq -16(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L16
+_L17:
+  movq -32(%rbp), %rax
+.L_leave_long_sum:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl twice
+twice:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq $2, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_twice:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $320, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $3, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $10, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call fact
+  movq %rax, -48(%rbp)
+  movq $1000, -56(%rbp)
+  movq -48(%rbp), %rax
+  cqto
+  idivq -56(%rbp)
+  movq %rdx, -64(%rbp)
+  movq $20, -72(%rbp)
+  movq -72(%rbp), %rdi
+  call fib
+  movq %rax, -80(%rbp)
+  movq -64(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $1071, -96(%rbp)
+  movq $462, -104(%rbp)
+  movq -96(%rbp), %rdi
+  movq -104(%rbp), %rsi
+  call gcd
+  movq %rax, -112(%rbp)
+  movq -88(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq $27, -128(%rbp)
+  movq -128(%rbp), %rdi
+  call collatz
+  movq %rax, -136(%rbp)
+  movq -120(%rbp), %rax
+  addq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq $7, -152(%rbp)
+  movq -152(%rbp), %rax
+  negq %rax
+  movq %rax, -160(%rbp)
+  movq $2, -168(%rbp)
+  movq -160(%rbp), %rax
+  cqto
+  idivq -168(%rbp)
+  movq %rax, -176(%rbp)
+  movq -144(%rbp), %rax
+  subq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq -184(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $97, -192(%rbp)
+  movq -192(%rbp), %rdi
+  call is_prime
+  movq %rax, -200(%rbp)
+  movq -200(%rbp), %rax
+  testq %rax, %rax
+  jz _L18
+  movq $91, -208(%rbp)
+  movq -208(%rbp), %rdi
+  call is_prime
+  movq %rax, -216(%rbp)
+  movq -216(%rbp), %rax
+  testq %rax, %rax
+  jnz _L18
+  movq $1000, -224(%rbp)
+  movq -16(%rbp), %rax
+  addq -224(%rbp), %rax
+  movq %rax, -232(%rbp)
+  movq -232(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L19
+_L18:
+_L19:
+  movq $5, -240(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -240(%rbp)
+  movq %rdx, -248(%rbp)
+  movq -32(%rbp), %rax
+  addq -248(%rbp), %rax
+  movq %rax, -256(%rbp)
+  movq -256(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call twice
+  movq %rax, -264(%rbp)
+  movq -16(%rbp), %rax
+  addq -264(%rbp), %rax
+  movq %rax, -272(%rbp)
+  movq $3000000, -280(%rbp)
+  movq -280(%rbp), %rdi
+  call long_sum
+  movq %rax, -288(%rbp)
+  movq $1000, -296(%rbp)
+  movq -288(%rbp), %rax
+  cqto
+  idivq -296(%rbp)
+  movq %rdx, -304(%rbp)
+  movq -272(%rbp), %rax
+  addq -304(%rbp), %rax
+  movq %rax, -312(%rbp)
+  movq -312(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call print_int
+  movq %rax, -320(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,129 @@
+.text
+.extern print_int
+.extern print_bool
+
+.globl complex_calc
+complex_calc:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -24(%rbp)
+  movq -24(%rbp), %rax
+  negq %rax
+  movq %rax, -32(%rbp)
+  movq -16(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -8(%rbp), %rax
+  imulq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $1, -56(%rbp)
+  movq -16(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -64(%rbp)
+  movq %rdx, -72(%rbp)
+  movq $1, -80(%rbp)
+  movq -72(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -48(%rbp), %rax
+  cqto
+  idivq -88(%rbp)
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -8(%rbp), %rax
+  subq -16(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -104(%rbp), %rax
+  addq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+.L_leave_complex_calc:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl logic_combo
+logic_combo:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -24(%rbp)
+  movq -8(%rbp), %rax
+  testq %rax, %rax
+  jz _L0
+  movq -16(%rbp), %rax
+  testq %rax, %rax
+  jnz _L2
+  movq $0, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jle _L0
+_L2:
+  movq $1, -40(%rbp)
+  movq -40(%rbp), %rax
+  jmp .L_leave_logic_combo
+  jmp _L1
+_L0:
+  movq -8(%rbp), %rax
+  testq %rax, %rax
+  jz _L3
+  movq -16(%rbp), %rax
+  testq %rax, %rax
+  jz _L3
+  movq $1, -48(%rbp)
+  jmp _L4
+_L3:
+  movq $0, -48(%rbp)
+_L4:
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  sete %al
+  movzbq %al, %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  jmp .L_leave_logic_combo
+_L1:
+.L_leave_logic_combo:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq $10, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $3, -24(%rbp)
+  movq $2, -32(%rbp)
+  movq -32(%rbp), %rax
+  negq %rax
+  movq %rax, -40(%rbp)
+  movq -16(%rbp), %rdi
+  movq -24(%rbp), %rsi
+  movq -40(%rbp), %rdx
+  call complex_calc
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call print_int
+  movq %rax, -56(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,915 @@
+.text
+.extern print_int
+
+.globl check
+check:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $144, %rsp
+  movq %rdi, -96(%rbp)
+  movq %rsi, -72(%rbp)
+  movq %rdx, -8(%rbp)
+  movq %rcx, -24(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $0, -40(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L0
+  movq -16(%rbp), %rax
+  negq %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L1
+_L0:
+_L1:
+  movq $0, -56(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jge _L2
+  movq -32(%rbp), %rax
+  negq %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L3
+_L2:
+_L3:
+  movq -72(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  addq -8(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  cmpq -96(%rbp), %rax
+  jne _L6
+  movq -16(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jge _L6
+  movq $0, -104(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -104(%rbp), %rax
+  jge _L7
+  movq $0, -112(%rbp)
+  movq -96(%rbp), %rax
+  cmpq -112(%rbp), %rax
+  jg _L6
+_L7:
+  movq $0, -120(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -120(%rbp), %rax
+  jle _L4
+  movq $0, -128(%rbp)
+  movq -96(%rbp), %rax
+  cmpq -128(%rbp), %rax
+  jge _L4
+_L6:
+  movq $1, -136(%rbp)
+  movq -136(%rbp), %rax
+  jmp .L_leave_check
+  jmp _L5
+_L4:
+_L5:
+  movq $0, -144(%rbp)
+  movq -144(%rbp), %rax
+.L_leave_check:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl errors
+errors:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $1568, %rsp
+  movq %rdi, -24(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $2, -32(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -32(%rbp)
+  movq %rax, -40(%rbp)
+  movq $2, -48(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rdx, -56(%rbp)
+  movq $2, -64(%rbp)
+  movq -24(%rbp), %rdi
+  movq -40(%rbp), %rsi
+  movq -56(%rbp), %rdx
+  movq -64(%rbp), %rcx
+  call check
+  movq %rax, -72(%rbp)
+  movq -16(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $3, -88(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -88(%rbp)
+  movq %rax, -96(%rbp)
+  movq $3, -104(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -104(%rbp)
+  movq %rdx, -112(%rbp)
+  movq $3, -120(%rbp)
+  movq -24(%rbp), %rdi
+  movq -96(%rbp), %rsi
+  movq -112(%rbp), %rdx
+  movq -120(%rbp), %rcx
+  call check
+  movq %rax, -128(%rbp)
+  movq -16(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $5, -144(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -144(%rbp)
+  movq %rax, -152(%rbp)
+  movq $5, -160(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -160(%rbp)
+  movq %rdx, -168(%rbp)
+  movq $5, -176(%rbp)
+  movq -24(%rbp), %rdi
+  movq -152(%rbp), %rsi
+  movq -168(%rbp), %rdx
+  movq -176(%rbp), %rcx
+  call check
+  movq %rax, -184(%rbp)
+  movq -16(%rbp), %rax
+  addq -184(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq -192(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $6, -200(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -200(%rbp)
+  movq %rax, -208(%rbp)
+  movq $6, -216(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -216(%rbp)
+  movq %rdx, -224(%rbp)
+  movq $6, -232(%rbp)
+  movq -24(%rbp), %rdi
+  movq -208(%rbp), %rsi
+  movq -224(%rbp), %rdx
+  movq -232(%rbp), %rcx
+  call check
+  movq %rax, -240(%rbp)
+  movq -16(%rbp), %rax
+  addq -240(%rbp), %rax
+  movq %rax, -248(%rbp)
+  movq -248(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $7, -256(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -256(%rbp)
+  movq %rax, -264(%rbp)
+  movq $7, -272(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -272(%rbp)
+  movq %rdx, -280(%rbp)
+  movq $7, -288(%rbp)
+  movq -24(%rbp), %rdi
+  movq -264(%rbp), %rsi
+  movq -280(%rbp), %rdx
+  movq -288(%rbp), %rcx
+  call check
+  movq %rax, -296(%rbp)
+  movq -16(%rbp), %rax
+  addq -296(%rbp), %rax
+  movq %rax, -304(%rbp)
+  movq -304(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $10, -312(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -312(%rbp)
+  movq %rax, -320(%rbp)
+  movq $10, -328(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -328(%rbp)
+  movq %rdx, -336(%rbp)
+  movq $10, -344(%rbp)
+  movq -24(%rbp), %rdi
+  movq -320(%rbp), %rsi
+  movq -336(%rbp), %rdx
+  movq -344(%rbp), %rcx
+  call check
+  movq %rax, -352(%rbp)
+  movq -16(%rbp), %rax
+  addq -352(%rbp), %rax
+  movq %rax, -360(%rbp)
+  movq -360(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $16, -368(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -368(%rbp)
+  movq %rax, -376(%rbp)
+  movq $16, -384(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -384(%rbp)
+  movq %rdx, -392(%rbp)
+  movq $16, -400(%rbp)
+  movq -24(%rbp), %rdi
+  movq -376(%rbp), %rsi
+  movq -392(%rbp), %rdx
+  movq -400(%rbp), %rcx
+  call check
+  movq %rax, -408(%rbp)
+  movq -16(%rbp), %rax
+  addq -408(%rbp), %rax
+  movq %rax, -416(%rbp)
+  movq -416(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $25, -424(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -424(%rbp)
+  movq %rax, -432(%rbp)
+  movq $25, -440(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -440(%rbp)
+  movq %rdx, -448(%rbp)
+  movq $25, -456(%rbp)
+  movq -24(%rbp), %rdi
+  movq -432(%rbp), %rsi
+  movq -448(%rbp), %rdx
+  movq -456(%rbp), %rcx
+  call check
+  movq %rax, -464(%rbp)
+  movq -16(%rbp), %rax
+  addq -464(%rbp), %rax
+  movq %rax, -472(%rbp)
+  movq -472(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $100, -480(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -480(%rbp)
+  movq %rax, -488(%rbp)
+  movq $100, -496(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -496(%rbp)
+  movq %rdx, -504(%rbp)
+  movq $100, -512(%rbp)
+  movq -24(%rbp), %rdi
+  movq -488(%rbp), %rsi
+  movq -504(%rbp), %rdx
+  movq -512(%rbp), %rcx
+  call check
+  movq %rax, -520(%rbp)
+  movq -16(%rbp), %rax
+  addq -520(%rbp), %rax
+  movq %rax, -528(%rbp)
+  movq -528(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $641, -536(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -536(%rbp)
+  movq %rax, -544(%rbp)
+  movq $641, -552(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -552(%rbp)
+  movq %rdx, -560(%rbp)
+  movq $641, -568(%rbp)
+  movq -24(%rbp), %rdi
+  movq -544(%rbp), %rsi
+  movq -560(%rbp), %rdx
+  movq -568(%rbp), %rcx
+  call check
+  movq %rax, -576(%rbp)
+  movq -16(%rbp), %rax
+  addq -576(%rbp), %rax
+  movq %rax, -584(%rbp)
+  movq -584(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1000, -592(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -592(%rbp)
+  movq %rax, -600(%rbp)
+  movq $1000, -608(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -608(%rbp)
+  movq %rdx, -616(%rbp)
+  movq $1000, -624(%rbp)
+  movq -24(%rbp), %rdi
+  movq -600(%rbp), %rsi
+  movq -616(%rbp), %rdx
+  movq -624(%rbp), %rcx
+  call check
+  movq %rax, -632(%rbp)
+  movq -16(%rbp), %rax
+  addq -632(%rbp), %rax
+  movq %rax, -640(%rbp)
+  movq -640(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1024, -648(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -648(%rbp)
+  movq %rax, -656(%rbp)
+  movq $1024, -664(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -664(%rbp)
+  movq %rdx, -672(%rbp)
+  movq $1024, -680(%rbp)
+  movq -24(%rbp), %rdi
+  movq -656(%rbp), %rsi
+  movq -672(%rbp), %rdx
+  movq -680(%rbp), %rcx
+  call check
+  movq %rax, -688(%rbp)
+  movq -16(%rbp), %rax
+  addq -688(%rbp), %rax
+  movq %rax, -696(%rbp)
+  movq -696(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $65536, -704(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -704(%rbp)
+  movq %rax, -712(%rbp)
+  movq $65536, -720(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -720(%rbp)
+  movq %rdx, -728(%rbp)
+  movq $65536, -736(%rbp)
+  movq -24(%rbp), %rdi
+  movq -712(%rbp), %rsi
+  movq -728(%rbp), %rdx
+  movq -736(%rbp), %rcx
+  call check
+  movq %rax, -744(%rbp)
+  movq -16(%rbp), %rax
+  addq -744(%rbp), %rax
+  movq %rax, -752(%rbp)
+  movq -752(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1000000007, -760(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -760(%rbp)
+  movq %rax, -768(%rbp)
+  movq $1000000007, -776(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -776(%rbp)
+  movq %rdx, -784(%rbp)
+  movq $1000000007, -792(%rbp)
+  movq -24(%rbp), %rdi
+  movq -768(%rbp), %rsi
+  movq -784(%rbp), %rdx
+  movq -792(%rbp), %rcx
+  call check
+  movq %rax, -800(%rbp)
+  movq -16(%rbp), %rax
+  addq -800(%rbp), %rax
+  movq %rax, -808(%rbp)
+  movq -808(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $2147483647, -816(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -816(%rbp)
+  movq %rax, -824(%rbp)
+  movq $2147483647, -832(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -832(%rbp)
+  movq %rdx, -840(%rbp)
+  movq $2147483647, -848(%rbp)
+  movq -24(%rbp), %rdi
+  movq -824(%rbp), %rsi
+  movq -840(%rbp), %rdx
+  movq -848(%rbp), %rcx
+  call check
+  movq %rax, -856(%rbp)
+  movq -16(%rbp), %rax
+  addq -856(%rbp), %rax
+  movq %rax, -864(%rbp)
+  movq -864(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -872(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -872(%rbp)
+  movq %rax, -880(%rbp)
+  movq $1, -888(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -888(%rbp)
+  movq %rdx, -896(%rbp)
+  movq $1, -904(%rbp)
+  movq -24(%rbp), %rdi
+  movq -880(%rbp), %rsi
+  movq -896(%rbp), %rdx
+  movq -904(%rbp), %rcx
+  call check
+  movq %rax, -912(%rbp)
+  movq -16(%rbp), %rax
+  addq -912(%rbp), %rax
+  movq %rax, -920(%rbp)
+  movq -920(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -928(%rbp)
+  movq -928(%rbp), %rax
+  negq %rax
+  movq %rax, -936(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -936(%rbp)
+  movq %rax, -944(%rbp)
+  movq $1, -952(%rbp)
+  movq -952(%rbp), %rax
+  negq %rax
+  movq %rax, -960(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -960(%rbp)
+  movq %rdx, -968(%rbp)
+  movq $1, -976(%rbp)
+  movq -976(%rbp), %rax
+  negq %rax
+  movq %rax, -984(%rbp)
+  movq -24(%rbp), %rdi
+  movq -944(%rbp), %rsi
+  movq -968(%rbp), %rdx
+  movq -984(%rbp), %rcx
+  call check
+  movq %rax, -992(%rbp)
+  movq -16(%rbp), %rax
+  addq -992(%rbp), %rax
+  movq %rax, -1000(%rbp)
+  movq -1000(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $2, -1008(%rbp)
+  movq -1008(%rbp), %rax
+  negq %rax
+  movq %rax, -1016(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1016(%rbp)
+  movq %rax, -1024(%rbp)
+  movq $2, -1032(%rbp)
+  movq -1032(%rbp), %rax
+  negq %rax
+  movq %rax, -1040(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1040(%rbp)
+  movq %rdx, -1048(%rbp)
+  movq $2, -1056(%rbp)
+  movq -1056(%rbp), %rax
+  negq %rax
+  movq %rax, -1064(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1024(%rbp), %rsi
+  movq -1048(%rbp), %rdx
+  movq -1064(%rbp), %rcx
+  call check
+  movq %rax, -1072(%rbp)
+  movq -16(%rbp), %rax
+  addq -1072(%rbp), %rax
+  movq %rax, -1080(%rbp)
+  movq -1080(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $3, -1088(%rbp)
+  movq -1088(%rbp), %rax
+  negq %rax
+  movq %rax, -1096(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1096(%rbp)
+  movq %rax, -1104(%rbp)
+  movq $3, -1112(%rbp)
+  movq -1112(%rbp), %rax
+  negq %rax
+  movq %rax, -1120(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1120(%rbp)
+  movq %rdx, -1128(%rbp)
+  movq $3, -1136(%rbp)
+  movq -1136(%rbp), %rax
+  negq %rax
+  movq %rax, -1144(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1104(%rbp), %rsi
+  movq -1128(%rbp), %rdx
+  movq -1144(%rbp), %rcx
+  call check
+  movq %rax, -1152(%rbp)
+  movq -16(%rbp), %rax
+  addq -1152(%rbp), %rax
+  movq %rax, -1160(%rbp)
+  movq -1160(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $7, -1168(%rbp)
+  movq -1168(%rbp), %rax
+  negq %rax
+  movq %rax, -1176(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1176(%rbp)
+  movq %rax, -1184(%rbp)
+  movq $7, -1192(%rbp)
+  movq -1192(%rbp), %rax
+  negq %rax
+  movq %rax, -1200(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1200(%rbp)
+  movq %rdx, -1208(%rbp)
+  movq $7, -1216(%rbp)
+  movq -1216(%rbp), %rax
+  negq %rax
+  movq %rax, -1224(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1184(%rbp), %rsi
+  movq -1208(%rbp), %rdx
+  movq -1224(%rbp), %rcx
+  call check
+  movq %rax, -1232(%rbp)
+  movq -16(%rbp), %rax
+  addq -1232(%rbp), %rax
+  movq %rax, -1240(%rbp)
+  movq -1240(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $8, -1248(%rbp)
+  movq -1248(%rbp), %rax
+  negq %rax
+  movq %rax, -1256(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1256(%rbp)
+  movq %rax, -1264(%rbp)
+  movq $8, -1272(%rbp)
+  movq -1272(%rbp), %rax
+  negq %rax
+  movq %rax, -1280(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1280(%rbp)
+  movq %rdx, -1288(%rbp)
+  movq $8, -1296(%rbp)
+  movq -1296(%rbp), %rax
+  negq %rax
+  movq %rax, -1304(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1264(%rbp), %rsi
+  movq -1288(%rbp), %rdx
+  movq -1304(%rbp), %rcx
+  call check
+  movq %rax, -1312(%rbp)
+  movq -16(%rbp), %rax
+  addq -1312(%rbp), %rax
+  movq %rax, -1320(%rbp)
+  movq -1320(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $10, -1328(%rbp)
+  movq -1328(%rbp), %rax
+  negq %rax
+  movq %rax, -1336(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1336(%rbp)
+  movq %rax, -1344(%rbp)
+  movq $10, -1352(%rbp)
+  movq -1352(%rbp), %rax
+  negq %rax
+  movq %rax, -1360(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1360(%rbp)
+  movq %rdx, -1368(%rbp)
+  movq $10, -1376(%rbp)
+  movq -1376(%rbp), %rax
+  negq %rax
+  movq %rax, -1384(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1344(%rbp), %rsi
+  movq -1368(%rbp), %rdx
+  movq -1384(%rbp), %rcx
+  call check
+  movq %rax, -1392(%rbp)
+  movq -16(%rbp), %rax
+  addq -1392(%rbp), %rax
+  movq %rax, -1400(%rbp)
+  movq -1400(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1000, -1408(%rbp)
+  movq -1408(%rbp), %rax
+  negq %rax
+  movq %rax, -1416(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1416(%rbp)
+  movq %rax, -1424(%rbp)
+  movq $1000, -1432(%rbp)
+  movq -1432(%rbp), %rax
+  negq %rax
+  movq %rax, -1440(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1440(%rbp)
+  movq %rdx, -1448(%rbp)
+  movq $1000, -1456(%rbp)
+  movq -1456(%rbp), %rax
+  negq %rax
+  movq %rax, -1464(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1424(%rbp), %rsi
+  movq -1448(%rbp), %rdx
+  movq -1464(%rbp), %rcx
+  call check
+  movq %rax, -1472(%rbp)
+  movq -16(%rbp), %rax
+  addq -1472(%rbp), %rax
+  movq %rax, -1480(%rbp)
+  movq -1480(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $65536, -1488(%rbp)
+  movq -1488(%rbp), %rax
+  negq %rax
+  movq %rax, -1496(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1496(%rbp)
+  movq %rax, -1504(%rbp)
+  movq $65536, -1512(%rbp)
+  movq -1512(%rbp), %rax
+  negq %rax
+  movq %rax, -1520(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -1520(%rbp)
+  movq %rdx, -1528(%rbp)
+  movq $65536, -1536(%rbp)
+  movq -1536(%rbp), %rax
+  negq %rax
+  movq %rax, -1544(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1504(%rbp), %rsi
+  movq -1528(%rbp), %rdx
+  movq -1544(%rbp), %rcx
+  call check
+  movq %rax, -1552(%rbp)
+  movq -16(%rbp), %rax
+  addq -1552(%rbp), %rax
+  movq %rax, -1560(%rbp)
+  movq -1560(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+.L_leave_errors:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl checksum
+checksum:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $208, %rsp
+  movq %rdi, -8(%rbp)
+  movq $7, -16(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -16(%rbp)
+  movq %rax, -24(%rbp)
+  movq $7, -32(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -32(%rbp)
+  movq %rdx, -40(%rbp)
+  movq -24(%rbp), %rax
+  addq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $10, -56(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -56(%rbp)
+  movq %rax, -64(%rbp)
+  movq -48(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $16, -80(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -80(%rbp)
+  movq %rdx, -88(%rbp)
+  movq -72(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq $16, -104(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -104(%rbp)
+  movq %rax, -112(%rbp)
+  movq -96(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq $1000, -128(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -128(%rbp)
+  movq %rdx, -136(%rbp)
+  movq -120(%rbp), %rax
+  addq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq $3, -152(%rbp)
+  movq -152(%rbp), %rax
+  negq %rax
+  movq %rax, -160(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -160(%rbp)
+  movq %rax, -168(%rbp)
+  movq -144(%rbp), %rax
+  addq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq $8, -184(%rbp)
+  movq -184(%rbp), %rax
+  negq %rax
+  movq %rax, -192(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -192(%rbp)
+  movq %rdx, -200(%rbp)
+  movq -176(%rbp), %rax
+  addq -200(%rbp), %rax
+  movq %rax, -208(%rbp)
+  movq -208(%rbp), %rax
+.L_leave_checksum:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $368, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $2147483647, -40(%rbp)
+  movq -40(%rbp), %rax
+  negq %rax
+  movq %rax, -48(%rbp)
+  movq $1, -56(%rbp)
+  movq -48(%rbp), %rax
+  subq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+_L8:
+  movq $2147483647, -80(%rbp)
+  movq $65521, -88(%rbp)
+  movq -80(%rbp), %rax
+  subq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -72(%rbp), %rax
+  cmpq -96(%rbp), %rax
+  jg _L9
+  movq -72(%rbp), %rdi
+  call errors
+  movq %rax, -104(%rbp)
+  movq -16(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -72(%rbp), %rdi
+  call checksum
+  movq %rax, -120(%rbp)
+  movq -32(%rbp), %rax
+  addq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $65521, -136(%rbp)
+  movq -72(%rbp), %rax
+  addq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq -144(%rbp), %rax
+  movq %rax, -72(%rbp)
+  jmp _L8
+_L9:
+  movq $2147483647, -152(%rbp)
+  movq -152(%rbp), %rdi
+  call errors
+  movq %rax, -160(%rbp)
+  movq -16(%rbp), %rax
+  addq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq $2147483647, -176(%rbp)
+  movq -176(%rbp), %rax
+  negq %rax
+  movq %rax, -184(%rbp)
+  movq $1, -192(%rbp)
+  movq -184(%rbp), %rax
+  subq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq -200(%rbp), %rdi
+  call errors
+  movq %rax, -208(%rbp)
+  movq -168(%rbp), %rax
+  addq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq $2147483646, -224(%rbp)
+  movq -224(%rbp), %rdi
+  call errors
+  movq %rax, -232(%rbp)
+  movq -216(%rbp), %rax
+  addq -232(%rbp), %rax
+  movq %rax, -240(%rbp)
+  movq -240(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $70000, -248(%rbp)
+  movq -248(%rbp), %rax
+  negq %rax
+  movq %rax, -256(%rbp)
+  movq -256(%rbp), %rax
+  movq %rax, -72(%rbp)
+_L10:
+  movq $70000, -264(%rbp)
+  movq -72(%rbp), %rax
+  cmpq -264(%rbp), %rax
+  jg _L11
+  movq -72(%rbp), %rdi
+  call errors
+  movq %rax, -272(%rbp)
+  movq -16(%rbp), %rax
+  addq -272(%rbp), %rax
+  movq %rax, -280(%rbp)
+  movq -280(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -72(%rbp), %rdi
+  call checksum
+  movq %rax, -288(%rbp)
+  movq -32(%rbp), %rax
+  addq -288(%rbp), %rax
+  movq %rax, -296(%rbp)
+  movq -296(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -304(%rbp)
+  movq -72(%rbp), %rax
+  addq -304(%rbp), %rax
+  movq %rax, -312(%rbp)
+  movq -312(%rbp), %rax
+  movq %rax, -72(%rbp)
+  jmp _L10
+_L11:
+  movq $1000000, -320(%rbp)
+  movq -16(%rbp), %rax
+  imulq -320(%rbp), %rax
+  movq %rax, -328(%rbp)
+  movq $1000000, -336(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -336(%rbp)
+  movq %rdx, -344(%rbp)
+  movq -328(%rbp), %rax
+  addq -344(%rbp), %rax
+  movq %rax, -352(%rbp)
+  movq -352(%rbp), %rdi
+  call print_int
+  movq %rax, -360(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,702 @@
+.text
+.extern print_int
+
+.globl times
+times:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_times:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl errors
+errors:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $1344, %rsp
+  movq %rdi, -24(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -32(%rbp)
+  movq -24(%rbp), %rax
+  imulq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $0, -48(%rbp)
+  movq -24(%rbp), %rdi
+  movq -48(%rbp), %rsi
+  call times
+  movq %rax, -56(%rbp)
+  movq -40(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  je _L0
+  movq $1, -64(%rbp)
+  movq -16(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L1
+_L0:
+_L1:
+  movq $1, -80(%rbp)
+  movq -24(%rbp), %rax
+  imulq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $1, -96(%rbp)
+  movq -24(%rbp), %rdi
+  movq -96(%rbp), %rsi
+  call times
+  movq %rax, -104(%rbp)
+  movq -88(%rbp), %rax
+  cmpq -104(%rbp), %rax
+  je _L2
+  movq $1, -112(%rbp)
+  movq -16(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L3
+_L2:
+_L3:
+  movq $2, -128(%rbp)
+  movq -24(%rbp), %rax
+  imulq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq $2, -144(%rbp)
+  movq -24(%rbp), %rdi
+  movq -144(%rbp), %rsi
+  call times
+  movq %rax, -152(%rbp)
+  movq -136(%rbp), %rax
+  cmpq -152(%rbp), %rax
+  je _L4
+  movq $1, -160(%rbp)
+  movq -16(%rbp), %rax
+  addq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq -168(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L5
+_L4:
+_L5:
+  movq $3, -176(%rbp)
+  movq -24(%rbp), %rax
+  imulq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq $3, -192(%rbp)
+  movq -24(%rbp), %rdi
+  movq -192(%rbp), %rsi
+  call times
+  movq %rax, -200(%rbp)
+  movq -184(%rbp), %rax
+  cmpq -200(%rbp), %rax
+  je _L6
+  movq $1, -208(%rbp)
+  movq -16(%rbp), %rax
+  addq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -216(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L7
+_L6:
+_L7:
+  movq $5, -224(%rbp)
+  movq -24(%rbp), %rax
+  imulq -224(%rbp), %rax
+  movq %rax, -232(%rbp)
+  movq $5, -240(%rbp)
+  movq -24(%rbp), %rdi
+  movq -240(%rbp), %rsi
+  call times
+  movq %rax, -248(%rbp)
+  movq -232(%rbp), %rax
+  cmpq -248(%rbp), %rax
+  je _L8
+  movq $1, -256(%rbp)
+  movq -16(%rbp), %rax
+  addq -256(%rbp), %rax
+  movq %rax, -264(%rbp)
+  movq -264(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L9
+_L8:
+_L9:
+  movq $8, -272(%rbp)
+  movq -24(%rbp), %rax
+  imulq -272(%rbp), %rax
+  movq %rax, -280(%rbp)
+  movq $8, -288(%rbp)
+  movq -24(%rbp), %rdi
+  movq -288(%rbp), %rsi
+  call times
+  movq %rax, -296(%rbp)
+  movq -280(%rbp), %rax
+  cmpq -296(%rbp), %rax
+  je _L10
+  movq $1, -304(%rbp)
+  movq -16(%rbp), %rax
+  addq -304(%rbp), %rax
+  movq %rax, -312(%rbp)
+  movq -312(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L11
+_L10:
+_L11:
+  movq $9, -320(%rbp)
+  movq -24(%rbp), %rax
+  imulq -320(%rbp), %rax
+  movq %rax, -328(%rbp)
+  movq $9, -336(%rbp)
+  movq -24(%rbp), %rdi
+  movq -336(%rbp), %rsi
+  call times
+  movq %rax, -344(%rbp)
+  movq -328(%rbp), %rax
+  cmpq -344(%rbp), %rax
+  je _L12
+  movq $1, -352(%rbp)
+  movq -16(%rbp), %rax
+  addq -352(%rbp), %rax
+  movq %rax, -360(%rbp)
+  movq -360(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L13
+_L12:
+_L13:
+  movq $10, -368(%rbp)
+  movq -24(%rbp), %rax
+  imulq -368(%rbp), %rax
+  movq %rax, -376(%rbp)
+  movq $10, -384(%rbp)
+  movq -24(%rbp), %rdi
+  movq -384(%rbp), %rsi
+  call times
+  movq %rax, -392(%rbp)
+  movq -376(%rbp), %rax
+  cmpq -392(%rbp), %rax
+  je _L14
+  movq $1, -400(%rbp)
+  movq -16(%rbp), %rax
+  addq -400(%rbp), %rax
+  movq %rax, -408(%rbp)
+  movq -408(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L15
+_L14:
+_L15:
+  movq $11, -416(%rbp)
+  movq -24(%rbp), %rax
+  imulq -416(%rbp), %rax
+  movq %rax, -424(%rbp)
+  movq $11, -432(%rbp)
+  movq -24(%rbp), %rdi
+  movq -432(%rbp), %rsi
+  call times
+  movq %rax, -440(%rbp)
+  movq -424(%rbp), %rax
+  cmpq -440(%rbp), %rax
+  je _L16
+  movq $1, -448(%rbp)
+  movq -16(%rbp), %rax
+  addq -448(%rbp), %rax
+  movq %rax, -456(%rbp)
+  movq -456(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L17
+_L16:
+_L17:
+  movq $15, -464(%rbp)
+  movq -24(%rbp), %rax
+  imulq -464(%rbp), %rax
+  movq %rax, -472(%rbp)
+  movq $15, -480(%rbp)
+  movq -24(%rbp), %rdi
+  movq -480(%rbp), %rsi
+  call times
+  movq %rax, -488(%rbp)
+  movq -472(%rbp), %rax
+  cmpq -488(%rbp), %rax
+  je _L18
+  movq $1, -496(%rbp)
+  movq -16(%rbp), %rax
+  addq -496(%rbp), %rax
+  movq %rax, -504(%rbp)
+  movq -504(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L19
+_L18:
+_L19:
+  movq $17, -512(%rbp)
+  movq -24(%rbp), %rax
+  imulq -512(%rbp), %rax
+  movq %rax, -520(%rbp)
+  movq $17, -528(%rbp)
+  movq -24(%rbp), %rdi
+  movq -528(%rbp), %rsi
+  call times
+  movq %rax, -536(%rbp)
+  movq -520(%rbp), %rax
+  cmpq -536(%rbp), %rax
+  je _L20
+  movq $1, -544(%rbp)
+  movq -16(%rbp), %rax
+  addq -544(%rbp), %rax
+  movq %rax, -552(%rbp)
+  movq -552(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L21
+_L20:
+_L21:
+  movq $18, -560(%rbp)
+  movq -24(%rbp), %rax
+  imulq -560(%rbp), %rax
+  movq %rax, -568(%rbp)
+  movq $18, -576(%rbp)
+  movq -24(%rbp), %rdi
+  movq -576(%rbp), %rsi
+  call times
+  movq %rax, -584(%rbp)
+  movq -568(%rbp), %rax
+  cmpq -584(%rbp), %rax
+  je _L22
+  movq $1, -592(%rbp)
+  movq -16(%rbp), %rax
+  addq -592(%rbp), %rax
+  movq %rax, -600(%rbp)
+  movq -600(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L23
+_L22:
+_L23:
+  movq $21, -608(%rbp)
+  movq -24(%rbp), %rax
+  imulq -608(%rbp), %rax
+  movq %rax, -616(%rbp)
+  movq $21, -624(%rbp)
+  movq -24(%rbp), %rdi
+  movq -624(%rbp), %rsi
+  call times
+  movq %rax, -632(%rbp)
+  movq -616(%rbp), %rax
+  cmpq -632(%rbp), %rax
+  je _L24
+  movq $1, -640(%rbp)
+  movq -16(%rbp), %rax
+  addq -640(%rbp), %rax
+  movq %rax, -648(%rbp)
+  movq -648(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L25
+_L24:
+_L25:
+  movq $24, -656(%rbp)
+  movq -24(%rbp), %rax
+  imulq -656(%rbp), %rax
+  movq %rax, -664(%rbp)
+  movq $24, -672(%rbp)
+  movq -24(%rbp), %rdi
+  movq -672(%rbp), %rsi
+  call times
+  movq %rax, -680(%rbp)
+  movq -664(%rbp), %rax
+  cmpq -680(%rbp), %rax
+  je _L26
+  movq $1, -688(%rbp)
+  movq -16(%rbp), %rax
+  addq -688(%rbp), %rax
+  movq %rax, -696(%rbp)
+  movq -696(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L27
+_L26:
+_L27:
+  movq $27, -704(%rbp)
+  movq -24(%rbp), %rax
+  imulq -704(%rbp), %rax
+  movq %rax, -712(%rbp)
+  movq $27, -720(%rbp)
+  movq -24(%rbp), %rdi
+  movq -720(%rbp), %rsi
+  call times
+  movq %rax, -728(%rbp)
+  movq -712(%rbp), %rax
+  cmpq -728(%rbp), %rax
+  je _L28
+  movq $1, -736(%rbp)
+  movq -16(%rbp), %rax
+  addq -736(%rbp), %rax
+  movq %rax, -744(%rbp)
+  movq -744(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L29
+_L28:
+_L29:
+  movq $41, -752(%rbp)
+  movq -24(%rbp), %rax
+  imulq -752(%rbp), %rax
+  movq %rax, -760(%rbp)
+  movq $41, -768(%rbp)
+  movq -24(%rbp), %rdi
+  movq -768(%rbp), %rsi
+  call times
+  movq %rax, -776(%rbp)
+  movq -760(%rbp), %rax
+  cmpq -776(%rbp), %rax
+  je _L30
+  movq $1, -784(%rbp)
+  movq -16(%rbp), %rax
+  addq -784(%rbp), %rax
+  movq %rax, -792(%rbp)
+  movq -792(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L31
+_L30:
+_L31:
+  movq $45, -800(%rbp)
+  movq -24(%rbp), %rax
+  imulq -800(%rbp), %rax
+  movq %rax, -808(%rbp)
+  movq $45, -816(%rbp)
+  movq -24(%rbp), %rdi
+  movq -816(%rbp), %rsi
+  call times
+  movq %rax, -824(%rbp)
+  movq -808(%rbp), %rax
+  cmpq -824(%rbp), %rax
+  je _L32
+  movq $1, -832(%rbp)
+  movq -16(%rbp), %rax
+  addq -832(%rbp), %rax
+  movq %rax, -840(%rbp)
+  movq -840(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L33
+_L32:
+_L33:
+  movq $63, -848(%rbp)
+  movq -24(%rbp), %rax
+  imulq -848(%rbp), %rax
+  movq %rax, -856(%rbp)
+  movq $63, -864(%rbp)
+  movq -24(%rbp), %rdi
+  movq -864(%rbp), %rsi
+  call times
+  movq %rax, -872(%rbp)
+  movq -856(%rbp), %rax
+  cmpq -872(%rbp), %rax
+  je _L34
+  movq $1, -880(%rbp)
+  movq -16(%rbp), %rax
+  addq -880(%rbp), %rax
+  movq %rax, -888(%rbp)
+  movq -888(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L35
+_L34:
+_L35:
+  movq $100, -896(%rbp)
+  movq -24(%rbp), %rax
+  imulq -896(%rbp), %rax
+  movq %rax, -904(%rbp)
+  movq $100, -912(%rbp)
+  movq -24(%rbp), %rdi
+  movq -912(%rbp), %rsi
+  call times
+  movq %rax, -920(%rbp)
+  movq -904(%rbp), %rax
+  cmpq -920(%rbp), %rax
+  je _L36
+  movq $1, -928(%rbp)
+  movq -16(%rbp), %rax
+  addq -928(%rbp), %rax
+  movq %rax, -936(%rbp)
+  movq -936(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L37
+_L36:
+_L37:
+  movq $1000, -944(%rbp)
+  movq -24(%rbp), %rax
+  imulq -944(%rbp), %rax
+  movq %rax, -952(%rbp)
+  movq $1000, -960(%rbp)
+  movq -24(%rbp), %rdi
+  movq -960(%rbp), %rsi
+  call times
+  movq %rax, -968(%rbp)
+  movq -952(%rbp), %rax
+  cmpq -968(%rbp), %rax
+  je _L38
+  movq $1, -976(%rbp)
+  movq -16(%rbp), %rax
+  addq -976(%rbp), %rax
+  movq %rax, -984(%rbp)
+  movq -984(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L39
+_L38:
+_L39:
+  movq $1, -992(%rbp)
+  movq -992(%rbp), %rax
+  negq %rax
+  movq %rax, -1000(%rbp)
+  movq -24(%rbp), %rax
+  imulq -1000(%rbp), %rax
+  movq %rax, -1008(%rbp)
+  movq $1, -1016(%rbp)
+  movq -1016(%rbp), %rax
+  negq %rax
+  movq %rax, -1024(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1024(%rbp), %rsi
+  call times
+  movq %rax, -1032(%rbp)
+  movq -1008(%rbp), %rax
+  cmpq -1032(%rbp), %rax
+  je _L40
+  movq $1, -1040(%rbp)
+  movq -16(%rbp), %rax
+  addq -1040(%rbp), %rax
+  movq %rax, -1048(%rbp)
+  movq -1048(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L41
+_L40:
+_L41:
+  movq $3, -1056(%rbp)
+  movq -1056(%rbp), %rax
+  negq %rax
+  movq %rax, -1064(%rbp)
+  movq -24(%rbp), %rax
+  imulq -1064(%rbp), %rax
+  movq %rax, -1072(%rbp)
+  movq $3, -1080(%rbp)
+  movq -1080(%rbp), %rax
+  negq %rax
+  movq %rax, -1088(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1088(%rbp), %rsi
+  call times
+  movq %rax, -1096(%rbp)
+  movq -1072(%rbp), %rax
+  cmpq -1096(%rbp), %rax
+  je _L42
+  movq $1, -1104(%rbp)
+  movq -16(%rbp), %rax
+  addq -1104(%rbp), %rax
+  movq %rax, -1112(%rbp)
+  movq -1112(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L43
+_L42:
+_L43:
+  movq $10, -1120(%rbp)
+  movq -1120(%rbp), %rax
+  negq %rax
+  movq %rax, -1128(%rbp)
+  movq -24(%rbp), %rax
+  imulq -1128(%rbp), %rax
+  movq %rax, -1136(%rbp)
+  movq $10, -1144(%rbp)
+  movq -1144(%rbp), %rax
+  negq %rax
+  movq %rax, -1152(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1152(%rbp), %rsi
+  call times
+  movq %rax, -1160(%rbp)
+  movq -1136(%rbp), %rax
+  cmpq -1160(%rbp), %rax
+  je _L44
+  movq $1, -1168(%rbp)
+  movq -16(%rbp), %rax
+  addq -1168(%rbp), %rax
+  movq %rax, -1176(%rbp)
+  movq -1176(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L45
+_L44:
+_L45:
+  movq $24, -1184(%rbp)
+  movq -1184(%rbp), %rax
+  negq %rax
+  movq %rax, -1192(%rbp)
+  movq -24(%rbp), %rax
+  imulq -1192(%rbp), %rax
+  movq %rax, -1200(%rbp)
+  movq $24, -1208(%rbp)
+  movq -1208(%rbp), %rax
+  negq %rax
+  movq %rax, -1216(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1216(%rbp), %rsi
+  call times
+  movq %rax, -1224(%rbp)
+  movq -1200(%rbp), %rax
+  cmpq -1224(%rbp), %rax
+  je _L46
+  movq $1, -1232(%rbp)
+  movq -16(%rbp), %rax
+  addq -1232(%rbp), %rax
+  movq %rax, -1240(%rbp)
+  movq -1240(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L47
+_L46:
+_L47:
+  movq $9, -1248(%rbp)
+  movq -1248(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -1256(%rbp)
+  movq $9, -1264(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1264(%rbp), %rsi
+  call times
+  movq %rax, -1272(%rbp)
+  movq -1256(%rbp), %rax
+  cmpq -1272(%rbp), %rax
+  jne _L50
+  movq $5, -1280(%rbp)
+  movq -1280(%rbp), %rax
+  negq %rax
+  movq %rax, -1288(%rbp)
+  movq -1288(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -1296(%rbp)
+  movq $5, -1304(%rbp)
+  movq -1304(%rbp), %rax
+  negq %rax
+  movq %rax, -1312(%rbp)
+  movq -24(%rbp), %rdi
+  movq -1312(%rbp), %rsi
+  call times
+  movq %rax, -1320(%rbp)
+  movq -1296(%rbp), %rax
+  cmpq -1320(%rbp), %rax
+  je _L48
+_L50:
+  movq $1, -1328(%rbp)
+  movq -16(%rbp), %rax
+  addq -1328(%rbp), %rax
+  movq %rax, -1336(%rbp)
+  movq -1336(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L49
+_L48:
+_L49:
+  movq -16(%rbp), %rax
+.L_leave_errors:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $288, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $99990, -40(%rbp)
+  movq -40(%rbp), %rax
+  negq %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+_L51:
+  movq $100000, -64(%rbp)
+  movq -56(%rbp), %rax
+  cmpq -64(%rbp), %rax
+  jg _L52
+  movq -56(%rbp), %rdi
+  call errors
+  movq %rax, -72(%rbp)
+  movq -16(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $9973, -88(%rbp)
+  movq -56(%rbp), %rax
+  imulq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rdi
+  call errors
+  movq %rax, -104(%rbp)
+  movq -80(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $45, -120(%rbp)
+  movq -56(%rbp), %rax
+  imulq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -32(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq $24, -144(%rbp)
+  movq -144(%rbp), %rax
+  negq %rax
+  movq %rax, -152(%rbp)
+  movq -56(%rbp), %rax
+  imulq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -136(%rbp), %rax
+  addq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq $17, -176(%rbp)
+  movq -56(%rbp), %rax
+  imulq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq -168(%rbp), %rax
+  addq -184(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq $7, -200(%rbp)
+  movq -56(%rbp), %rax
+  imulq -200(%rbp), %rax
+  movq %rax, -208(%rbp)
+  movq -192(%rbp), %rax
+  addq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -216(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -224(%rbp)
+  movq -56(%rbp), %rax
+  addq -224(%rbp), %rax
+  movq %rax, -232(%rbp)
+  movq -232(%rbp), %rax
+  movq %rax, -56(%rbp)
+  jmp _L51
+_L52:
+  movq $1000000, -240(%rbp)
+  movq -16(%rbp), %rax
+  imulq -240(%rbp), %rax
+  movq %rax, -248(%rbp)
+  movq $1000000, -256(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -256(%rbp)
+  movq %rdx, -264(%rbp)
+  movq -248(%rbp), %rax
+  addq -264(%rbp), %rax
+  movq %rax, -272(%rbp)
+  movq -272(%rbp), %rdi
+  call print_int
+  movq %rax, -280(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,96 @@
+.text
+.extern print_int
+.extern print_bool
+.extern get_int
+
+.globl helper
+helper:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -16(%rbp)
+  call get_int
+  movq %rax, -8(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_helper:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl unused
+unused:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq -8(%rbp), %rdi
+  call helper
+  movq %rax, -16(%rbp)
+  movq $2, -24(%rbp)
+  movq -16(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rax
+.L_leave_unused:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl square
+square:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $16, %rsp
+  movq %rdi, -8(%rbp)
+  movq -8(%rbp), %rax
+  imulq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+.L_leave_square:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl norm
+norm:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -24(%rbp)
+  movq -8(%rbp), %rdi
+  call square
+  movq %rax, -16(%rbp)
+  movq -24(%rbp), %rdi
+  call square
+  movq %rax, -32(%rbp)
+  movq -16(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+.L_leave_norm:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq $12, -8(%rbp)
+  movq $35, -16(%rbp)
+  movq -8(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  call norm
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rdi
+  call print_int
+  movq %rax, -32(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
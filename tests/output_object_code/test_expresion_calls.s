@@ -0,0 +1,79 @@
+.text
+.extern print_int
+
+.globl inc
+inc:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq $1, -16(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_inc:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl twice
+twice:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -24(%rbp)
+  movq %rsi, -8(%rbp)
+  movq -8(%rbp), %rax
+  addq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rax
+.L_leave_twice:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl caller
+caller:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq $2, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call inc
+  movq %rax, -24(%rbp)
+  movq $3, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call inc
+  movq %rax, -40(%rbp)
+  movq -24(%rbp), %rdi
+  movq -40(%rbp), %rsi
+  call twice
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+.L_leave_caller:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $16, %rsp
+  call caller
+  movq %rax, -8(%rbp)
+  movq -8(%rbp), %rdi
+  call print_int
+  movq %rax, -16(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,151 @@
+.text
+.extern print_int
+
+.globl setup
+setup:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq $7, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $3, -32(%rbp)
+  movq -24(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+.L_leave_setup:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl step
+step:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -8(%rbp)
+  movq $31, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $7, -32(%rbp)
+  movq -24(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $10007, -48(%rbp)
+  movq -40(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rdx, -56(%rbp)
+  movq -56(%rbp), %rax
+.L_leave_step:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl scale
+scale:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $1009, -32(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -32(%rbp)
+  movq %rdx, -40(%rbp)
+  movq -40(%rbp), %rax
+.L_leave_scale:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl advance
+advance:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -32(%rbp)
+  movq %rsi, -24(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L0:
+  movq -16(%rbp), %rax
+  cmpq -24(%rbp), %rax
+  jge _L1
+  movq -32(%rbp), %rdi
+  call step
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -48(%rbp)
+  movq -16(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L0
+_L1:
+  movq -32(%rbp), %rax
+.L_leave_advance:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq $5, -8(%rbp)
+  movq -8(%rbp), %rdi
+  call setup
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $0, -32(%rbp)
+  movq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+_L2:
+  movq $100, -48(%rbp)
+  movq -40(%rbp), %rax
+  cmpq -48(%rbp), %rax
+  jge _L3
+  movq $20, -56(%rbp)
+  movq -24(%rbp), %rdi
+  movq -56(%rbp), %rsi
+  call advance
+  movq %rax, -64(%rbp)
+  movq $3, -72(%rbp)
+  movq -40(%rbp), %rdi
+  movq -72(%rbp), %rsi
+  call scale
+  movq %rax, -80(%rbp)
+  movq -64(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $1, -96(%rbp)
+  movq -40(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -40(%rbp)
+  jmp _L2
+_L3:
+  movq -24(%rbp), %rdi
+  call print_int
+  movq %rax, -112(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
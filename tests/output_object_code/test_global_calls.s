@@ -0,0 +1,142 @@
+.data
+g$global:
+  .quad 0
+activo$global:
+  .quad 0
+.text
+.extern print_int
+
+.globl cambiar
+cambiar:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, g$global(%rip)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  setg %al
+  movzbq %al, %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, activo$global(%rip)
+.L_leave_cambiar:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $288, %rsp
+  movq $8, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, g$global(%rip)
+  movq $1, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, activo$global(%rip)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $0, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $0, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $6, -72(%rbp)
+  movq -72(%rbp), %rax
+  negq %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rdi
+  call cambiar
+  movq %rax, -88(%rbp)
+  movq activo$global(%rip), %rax
+  testq %rax, %rax
+  jz _L0
+  movq $1, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L1
+_L0:
+  movq $2, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L1:
+  movq $1000, -112(%rbp)
+  movq -32(%rbp), %rax
+  imulq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq $4, -128(%rbp)
+  movq g$global(%rip), %rax
+  cqto
+  idivq -128(%rbp)
+  movq %rax, -136(%rbp)
+  movq -120(%rbp), %rax
+  addq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq $4, -152(%rbp)
+  movq g$global(%rip), %rax
+  cqto
+  idivq -152(%rbp)
+  movq %rdx, -160(%rbp)
+  movq -144(%rbp), %rax
+  addq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq -168(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $3, -176(%rbp)
+  movq -176(%rbp), %rax
+  movq %rax, g$global(%rip)
+_L2:
+  movq $5, -184(%rbp)
+  movq -48(%rbp), %rax
+  cmpq -184(%rbp), %rax
+  jge _L3
+  movq $100, -192(%rbp)
+  movq -192(%rbp), %rax
+  cqto
+  idivq g$global(%rip)
+  movq %rax, -200(%rbp)
+  movq -64(%rbp), %rax
+  addq -200(%rbp), %rax
+  movq %rax, -208(%rbp)
+  movq -208(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $1, -216(%rbp)
+  movq g$global(%rip), %rax
+  addq -216(%rbp), %rax
+  movq %rax, -224(%rbp)
+  movq -224(%rbp), %rdi
+  call cambiar
+  movq %rax, -232(%rbp)
+  movq $1, -240(%rbp)
+  movq -48(%rbp), %rax
+  addq -240(%rbp), %rax
+  movq %rax, -248(%rbp)
+  movq -248(%rbp), %rax
+  movq %rax, -48(%rbp)
+  jmp _L2
+_L3:
+  movq $1000, -256(%rbp)
+  movq -32(%rbp), %rax
+  imulq -256(%rbp), %rax
+  movq %rax, -264(%rbp)
+  movq -264(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -272(%rbp)
+  movq -272(%rbp), %rax
+  addq g$global(%rip), %rax
+  movq %rax, -280(%rbp)
+  movq -280(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call print_int
+  movq %rax, -288(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
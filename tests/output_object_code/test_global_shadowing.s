@@ -0,0 +1,124 @@
+.data
+x$global:
+  .quad 0
+.text
+.extern print_int
+
+.globl f
+f:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq $1, -16(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -8(%rbp)
+  movq -8(%rbp), %rax
+.L_leave_f:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl g
+g:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $16, %rsp
+  movq $2, -8(%rbp)
+  movq x$global(%rip), %rax
+  imulq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+.L_leave_g:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl h
+h:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $16, %rsp
+  movq $9, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, x$global(%rip)
+.L_leave_h:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $192, %rsp
+  movq $5, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, x$global(%rip)
+  movq $3, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $10, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call f
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $1, -56(%rbp)
+  movq -24(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $100, -72(%rbp)
+  movq -48(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  call g
+  movq %rax, -88(%rbp)
+  movq -80(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $100, -104(%rbp)
+  movq -48(%rbp), %rax
+  imulq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  addq -24(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -48(%rbp)
+  call h
+  movq %rax, -128(%rbp)
+  movq $100, -136(%rbp)
+  movq -48(%rbp), %rax
+  imulq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  call g
+  movq %rax, -152(%rbp)
+  movq -144(%rbp), %rax
+  addq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -160(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $10, -168(%rbp)
+  movq -48(%rbp), %rax
+  imulq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq -176(%rbp), %rax
+  addq -24(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq -184(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rdi
+  call print_int
+  movq %rax, -192(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
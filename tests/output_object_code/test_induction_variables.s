@@ -0,0 +1,324 @@
+.text
+.extern print_int
+
+.globl affine
+affine:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -40(%rbp)
+  movq %rsi, -56(%rbp)
+  movq %rdx, -48(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L1
+  movq -32(%rbp), %rax
+  imulq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -48(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $1000, -80(%rbp)
+  movq -72(%rbp), %rax
+  cqto
+  idivq -80(%rbp)
+  movq %rdx, -88(%rbp)
+  movq -16(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -104(%rbp)
+  movq -32(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L0
+_L1:
+  movq -16(%rbp), %rax
+.L_leave_affine:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl stride
+stride:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -40(%rbp)
+  movq %rsi, -48(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $2, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L2:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jg _L3
+  movq -32(%rbp), %rax
+  imulq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $5, -64(%rbp)
+  movq -56(%rbp), %rax
+  subq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $97, -80(%rbp)
+  movq -72(%rbp), %rax
+  cqto
+  idivq -80(%rbp)
+  movq %rdx, -88(%rbp)
+  movq -16(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $3, -104(%rbp)
+  movq -32(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L2
+_L3:
+  movq -16(%rbp), %rax
+.L_leave_stride:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl down
+down:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $300, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L4:
+  movq $0, -40(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jle _L5
+  movq $4, -48(%rbp)
+  movq -48(%rbp), %rax
+  negq %rax
+  movq %rax, -56(%rbp)
+  movq -32(%rbp), %rax
+  imulq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -16(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $1, -80(%rbp)
+  movq -72(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $7, -96(%rbp)
+  movq -32(%rbp), %rax
+  subq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L4
+_L5:
+  movq -16(%rbp), %rax
+.L_leave_down:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl last
+last:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -88(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L6:
+  movq $50, -40(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L7
+  movq $3, -48(%rbp)
+  movq -48(%rbp), %rax
+  imulq -32(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -16(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $2, -72(%rbp)
+  movq -32(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L6
+_L7:
+  movq -32(%rbp), %rax
+  imulq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -16(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+.L_leave_last:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl products
+products:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -40(%rbp)
+  movq %rsi, -48(%rbp)
+  movq %rdx, -72(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L8:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L9
+  movq -32(%rbp), %rax
+  imulq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -16(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -32(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $11, -88(%rbp)
+  movq -80(%rbp), %rax
+  cqto
+  idivq -88(%rbp)
+  movq %rdx, -96(%rbp)
+  movq -64(%rbp), %rax
+  subq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -120(%rbp)
+  movq -32(%rbp), %rax
+  addq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L8
+_L9:
+  movq -16(%rbp), %rax
+.L_leave_products:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $240, %rsp
+  movq $25, -8(%rbp)
+  movq $7, -16(%rbp)
+  movq $40, -24(%rbp)
+  movq -24(%rbp), %rax
+  negq %rax
+  movq %rax, -32(%rbp)
+  movq -8(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  movq -32(%rbp), %rdx
+  call affine
+  movq %rax, -40(%rbp)
+  movq $40, -48(%rbp)
+  movq $13, -56(%rbp)
+  movq -48(%rbp), %rdi
+  movq -56(%rbp), %rsi
+  call stride
+  movq %rax, -64(%rbp)
+  movq -40(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $10000, -88(%rbp)
+  movq -80(%rbp), %rax
+  imulq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  call down
+  movq %rax, -104(%rbp)
+  movq $10, -112(%rbp)
+  movq -104(%rbp), %rax
+  cqto
+  idivq -112(%rbp)
+  movq %rax, -120(%rbp)
+  movq -96(%rbp), %rax
+  subq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $10, -136(%rbp)
+  movq -80(%rbp), %rax
+  imulq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq $3, -152(%rbp)
+  movq -152(%rbp), %rdi
+  call last
+  movq %rax, -160(%rbp)
+  movq $30, -168(%rbp)
+  movq $2, -176(%rbp)
+  movq $5, -184(%rbp)
+  movq -168(%rbp), %rdi
+  movq -176(%rbp), %rsi
+  movq -184(%rbp), %rdx
+  call products
+  movq %rax, -192(%rbp)
+  movq -160(%rbp), %rax
+  addq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq $10, -208(%rbp)
+  movq -200(%rbp), %rax
+  cqto
+  idivq -208(%rbp)
+  movq %rdx, -216(%rbp)
+  movq -144(%rbp), %rax
+  addq -216(%rbp), %rax
+  movq %rax, -224(%rbp)
+  movq -224(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rdi
+  call print_int
+  movq %rax, -232(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
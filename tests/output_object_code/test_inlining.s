@@ -0,0 +1,265 @@
+.text
+.extern print_int
+
+.globl inc
+inc:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq $1, -16(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_inc:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl pick
+pick:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -24(%rbp)
+  movq -8(%rbp), %rax
+  testq %rax, %rax
+  jz _L0
+  movq -16(%rbp), %rax
+  jmp .L_leave_pick
+  jmp _L1
+_L0:
+_L1:
+  movq -16(%rbp), %rax
+  cmpq -24(%rbp), %rax
+  jle _L2
+  movq -16(%rbp), %rax
+  subq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rax
+  jmp .L_leave_pick
+  jmp _L3
+_L2:
+_L3:
+  movq -24(%rbp), %rax
+.L_leave_pick:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl sum_to
+sum_to:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L4:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L5
+  movq -32(%rbp), %rdi
+  call inc
+  movq %rax, -48(%rbp)
+  movq $3, -56(%rbp)
+  movq -48(%rbp), %rax
+  imulq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $11, -72(%rbp)
+  movq -64(%rbp), %rax
+  cqto
+  idivq -72(%rbp)
+  movq %rdx, -80(%rbp)
+  movq -16(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -96(%rbp)
+  movq -32(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L4
+_L5:
+  movq -16(%rbp), %rax
+.L_leave_sum_to:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl twice
+twice:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq $2, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_twice:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl fib
+fib:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -8(%rbp)
+  movq $2, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jge _L6
+  movq -8(%rbp), %rax
+  jmp .L_leave_fib
+  jmp _L7
+_L6:
+_L7:
+  movq $1, -24(%rbp)
+  movq -8(%rbp), %rax
+  subq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call fib
+  movq %rax, -40(%rbp)
+  movq $2, -48(%rbp)
+  movq -8(%rbp), %rax
+  subq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rdi
+  call fib
+  movq %rax, -64(%rbp)
+  movq -40(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+.L_leave_fib:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl show
+show:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $16, %rsp
+  movq %rdi, -8(%rbp)
+  movq -8(%rbp), %rdi
+  call print_int
+  movq %rax, -16(%rbp)
+.L_leave_show:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $256, %rsp
+  movq $5, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $0, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+_L8:
+  movq $40, -56(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jge _L9
+  movq $3, -64(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -64(%rbp)
+  movq %rdx, -72(%rbp)
+  movq $0, -80(%rbp)
+  movq -72(%rbp), %rax
+  cmpq -80(%rbp), %rax
+  sete %al
+  movzbq %al, %rax
+  movq %rax, -88(%rbp)
+  movq -32(%rbp), %rdi
+  call inc
+  movq %rax, -96(%rbp)
+  movq -88(%rbp), %rdi
+  movq -96(%rbp), %rsi
+  movq -16(%rbp), %rdx
+  call pick
+  movq %rax, -104(%rbp)
+  movq -48(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $7, -120(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -120(%rbp)
+  movq %rdx, -128(%rbp)
+  movq -128(%rbp), %rdi
+  call sum_to
+  movq %rax, -136(%rbp)
+  movq -112(%rbp), %rax
+  addq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq -144(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -16(%rbp), %rdi
+  call inc
+  movq %rax, -152(%rbp)
+  movq $13, -160(%rbp)
+  movq -152(%rbp), %rax
+  cqto
+  idivq -160(%rbp)
+  movq %rdx, -168(%rbp)
+  movq -168(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -176(%rbp)
+  movq -32(%rbp), %rax
+  addq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq -184(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L8
+_L9:
+  movq -48(%rbp), %rdi
+  call twice
+  movq %rax, -192(%rbp)
+  movq $12, -200(%rbp)
+  movq -200(%rbp), %rdi
+  call fib
+  movq %rax, -208(%rbp)
+  movq -192(%rbp), %rax
+  addq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq $100000, -224(%rbp)
+  movq -16(%rbp), %rax
+  imulq -224(%rbp), %rax
+  movq %rax, -232(%rbp)
+  movq -216(%rbp), %rax
+  addq -232(%rbp), %rax
+  movq %rax, -240(%rbp)
+  movq -240(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rdi
+  call show
+  movq %rax, -248(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
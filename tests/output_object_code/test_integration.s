@@ -0,0 +1,53 @@
+.text
+
+.globl inc
+inc:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq $1, -16(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_inc:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+.extern get_int
+.extern print_int
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq $10, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -32(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jne _L0
+  movq -16(%rbp), %rdi
+  call print_int
+  movq %rax, -40(%rbp)
+  jmp _L1
+_L0:
+  movq -16(%rbp), %rdi
+  call inc
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rdi
+  call print_int
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  jmp .L_leave_main
+_L1:
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,261 @@
+.text
+.extern print_int
+
+.globl limit
+limit:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq $2, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $1, -32(%rbp)
+  movq -24(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+.L_leave_limit:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl nested
+nested:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $192, %rsp
+  movq %rdi, -40(%rbp)
+  movq %rsi, -72(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq -40(%rbp), %rdi
+  call limit
+  movq %rax, -48(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -48(%rbp), %rax
+  jge _L1
+  movq $0, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+_L2:
+  movq -64(%rbp), %rax
+  cmpq -72(%rbp), %rax
+  jge _L3
+  movq $1, -80(%rbp)
+  movq -40(%rbp), %rax
+  subq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $3, -96(%rbp)
+  movq -72(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -88(%rbp), %rax
+  imulq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -16(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -64(%rbp), %rax
+  imulq -32(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -120(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq $3, -144(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -144(%rbp)
+  movq %rax, -152(%rbp)
+  movq -136(%rbp), %rax
+  addq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -160(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -168(%rbp)
+  movq -64(%rbp), %rax
+  addq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq -176(%rbp), %rax
+  movq %rax, -64(%rbp)
+  jmp _L2
+_L3:
+  movq $1, -184(%rbp)
+  movq -32(%rbp), %rax
+  addq -184(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq -192(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L0
+_L1:
+  movq -16(%rbp), %rax
+.L_leave_nested:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl empty
+empty:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -40(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -24(%rbp)
+_L4:
+  movq $0, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jge _L5
+  movq $7, -48(%rbp)
+  movq -40(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rax, -56(%rbp)
+  movq $5, -64(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -64(%rbp)
+  movq %rdx, -72(%rbp)
+  movq -56(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -16(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -96(%rbp)
+  movq -24(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -24(%rbp)
+  jmp _L4
+_L5:
+  movq -16(%rbp), %rax
+.L_leave_empty:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl flags
+flags:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -40(%rbp)
+  movq %rsi, -48(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L6:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L7
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  jnz _L8
+  movq $3, -56(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jge _L7
+_L8:
+  movq $4, -64(%rbp)
+  movq -40(%rbp), %rax
+  imulq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $1, -80(%rbp)
+  movq -72(%rbp), %rax
+  subq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -16(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -104(%rbp)
+  movq -32(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L6
+_L7:
+  movq -16(%rbp), %rax
+.L_leave_flags:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $176, %rsp
+  movq $3, -8(%rbp)
+  movq $4, -16(%rbp)
+  movq -8(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  call nested
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $100, -40(%rbp)
+  movq -32(%rbp), %rax
+  imulq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $5, -56(%rbp)
+  movq $0, -64(%rbp)
+  movq -56(%rbp), %rdi
+  movq -64(%rbp), %rsi
+  call empty
+  movq %rax, -72(%rbp)
+  movq -48(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1000, -88(%rbp)
+  movq -32(%rbp), %rax
+  imulq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq $6, -104(%rbp)
+  movq $0, -112(%rbp)
+  movq -104(%rbp), %rdi
+  movq -112(%rbp), %rsi
+  call flags
+  movq %rax, -120(%rbp)
+  movq -96(%rbp), %rax
+  addq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq $2, -136(%rbp)
+  movq $1, -144(%rbp)
+  movq -136(%rbp), %rdi
+  movq -144(%rbp), %rsi
+  call flags
+  movq %rax, -152(%rbp)
+  movq -128(%rbp), %rax
+  addq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -160(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call print_int
+  movq %rax, -168(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
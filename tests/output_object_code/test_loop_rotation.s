@@ -0,0 +1,200 @@
+.data
+limite$global:
+  .quad 0
+.text
+.extern print_int
+
+.globl zero_trips
+zero_trips:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -24(%rbp)
+  movq $7, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq $0, -40(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L1
+  movq -16(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -56(%rbp)
+  movq -32(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L0
+_L1:
+  movq -16(%rbp), %rax
+.L_leave_zero_trips:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl branches
+branches:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L2:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L3
+  movq $3, -48(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rdx, -56(%rbp)
+  movq $0, -64(%rbp)
+  movq -56(%rbp), %rax
+  cmpq -64(%rbp), %rax
+  jne _L4
+  movq $2, -72(%rbp)
+  movq -32(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -16(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L5
+_L4:
+  movq $1, -96(%rbp)
+  movq -16(%rbp), %rax
+  subq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L5:
+  movq $1, -112(%rbp)
+  movq -32(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L2
+_L3:
+  movq -16(%rbp), %rax
+.L_leave_branches:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl nested
+nested:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L6:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L7
+  movq -32(%rbp), %rax
+  movq %rax, -48(%rbp)
+_L8:
+  movq -48(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L9
+  movq -48(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $4, -64(%rbp)
+  movq -56(%rbp), %rax
+  cmpq -64(%rbp), %rax
+  jge _L9
+  movq -16(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -80(%rbp)
+  movq -48(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -48(%rbp)
+  jmp _L8
+_L9:
+  movq $1, -96(%rbp)
+  movq -32(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L6
+_L7:
+  movq -16(%rbp), %rax
+.L_leave_nested:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq $10, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, limite$global(%rip)
+  movq $5, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call zero_trips
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1000, -40(%rbp)
+  movq -32(%rbp), %rax
+  imulq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq limite$global(%rip), %rdi
+  call branches
+  movq %rax, -56(%rbp)
+  movq -48(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1000, -72(%rbp)
+  movq -32(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $6, -88(%rbp)
+  movq -88(%rbp), %rdi
+  call nested
+  movq %rax, -96(%rbp)
+  movq -80(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call print_int
+  movq %rax, -112(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,368 @@
+.data
+base$global:
+  .quad 0
+.text
+.extern print_int
+
+.globl stepped
+stepped:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L1
+  movq -16(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $3, -56(%rbp)
+  movq -32(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L0
+_L1:
+  movq -16(%rbp), %rax
+.L_leave_stepped:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl down
+down:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -24(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L2:
+  movq $0, -40(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jl _L3
+  movq $2, -48(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rdx, -56(%rbp)
+  movq $0, -64(%rbp)
+  movq -56(%rbp), %rax
+  cmpq -64(%rbp), %rax
+  jne _L4
+  movq $2, -72(%rbp)
+  movq -16(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L5
+_L4:
+  movq $1, -96(%rbp)
+  movq -16(%rbp), %rax
+  subq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L5:
+  movq $2, -112(%rbp)
+  movq -32(%rbp), %rax
+  subq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L2
+_L3:
+  movq -16(%rbp), %rax
+.L_leave_down:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl fixed
+fixed:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -48(%rbp)
+  movq $1, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L6:
+  movq $4, -40(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jg _L7
+  movq -16(%rbp), %rax
+  imulq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -72(%rbp)
+  movq -32(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L6
+_L7:
+  movq -16(%rbp), %rax
+.L_leave_fixed:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl nested
+nested:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L8:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L9
+  movq $0, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+_L10:
+  movq -56(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jge _L11
+  movq -56(%rbp), %rax
+  imulq -32(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -16(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -80(%rbp)
+  movq -56(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -56(%rbp)
+  jmp _L10
+_L11:
+  movq $1, -96(%rbp)
+  movq -32(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L8
+_L9:
+  movq -16(%rbp), %rax
+.L_leave_nested:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl edge
+edge:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq $2, -8(%rbp)
+  movq base$global(%rip), %rax
+  imulq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -24(%rbp)
+  movq -16(%rbp), %rax
+  addq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $0, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $2, -64(%rbp)
+  movq base$global(%rip), %rax
+  imulq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+_L12:
+  movq -80(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L13
+  movq $2, -88(%rbp)
+  movq -56(%rbp), %rax
+  imulq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq $1, -104(%rbp)
+  movq -96(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $1, -120(%rbp)
+  movq -80(%rbp), %rax
+  addq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+  movq %rax, -80(%rbp)
+  jmp _L12
+_L13:
+  movq -56(%rbp), %rax
+.L_leave_edge:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $384, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, base$global(%rip)
+  movq $1073741824, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $0, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call stepped
+  movq %rax, -40(%rbp)
+  movq $2, -48(%rbp)
+  movq -48(%rbp), %rdi
+  call stepped
+  movq %rax, -56(%rbp)
+  movq -40(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $11, -72(%rbp)
+  movq -72(%rbp), %rdi
+  call stepped
+  movq %rax, -80(%rbp)
+  movq -64(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $14, -96(%rbp)
+  movq -96(%rbp), %rdi
+  call stepped
+  movq %rax, -104(%rbp)
+  movq -88(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $15, -120(%rbp)
+  movq -120(%rbp), %rdi
+  call stepped
+  movq %rax, -128(%rbp)
+  movq -112(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq $1000, -152(%rbp)
+  movq -144(%rbp), %rax
+  imulq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq $9, -168(%rbp)
+  movq -168(%rbp), %rdi
+  call down
+  movq %rax, -176(%rbp)
+  movq -160(%rbp), %rax
+  addq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq $10, -192(%rbp)
+  movq -192(%rbp), %rdi
+  call down
+  movq %rax, -200(%rbp)
+  movq -184(%rbp), %rax
+  addq -200(%rbp), %rax
+  movq %rax, -208(%rbp)
+  movq $1, -216(%rbp)
+  movq -216(%rbp), %rax
+  negq %rax
+  movq %rax, -224(%rbp)
+  movq -224(%rbp), %rdi
+  call down
+  movq %rax, -232(%rbp)
+  movq -208(%rbp), %rax
+  addq -232(%rbp), %rax
+  movq %rax, -240(%rbp)
+  movq -240(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq $1000, -248(%rbp)
+  movq -144(%rbp), %rax
+  imulq -248(%rbp), %rax
+  movq %rax, -256(%rbp)
+  movq $3, -264(%rbp)
+  movq -264(%rbp), %rdi
+  call fixed
+  movq %rax, -272(%rbp)
+  movq -256(%rbp), %rax
+  addq -272(%rbp), %rax
+  movq %rax, -280(%rbp)
+  movq $7, -288(%rbp)
+  movq -288(%rbp), %rdi
+  call nested
+  movq %rax, -296(%rbp)
+  movq -280(%rbp), %rax
+  addq -296(%rbp), %rax
+  movq %rax, -304(%rbp)
+  movq -304(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq $0, -312(%rbp)
+  movq -24(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -320(%rbp)
+  movq $4, -328(%rbp)
+  movq -320(%rbp), %rax
+  imulq -328(%rbp), %rax
+  movq %rax, -336(%rbp)
+  movq -312(%rbp), %rax
+  subq -336(%rbp), %rax
+  movq %rax, -344(%rbp)
+  movq -344(%rbp), %rax
+  movq %rax, base$global(%rip)
+  movq $10, -352(%rbp)
+  movq -144(%rbp), %rax
+  imulq -352(%rbp), %rax
+  movq %rax, -360(%rbp)
+  call edge
+  movq %rax, -368(%rbp)
+  movq -360(%rbp), %rax
+  addq -368(%rbp), %rax
+  movq %rax, -376(%rbp)
+  movq -376(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq -144(%rbp), %rdi
+  call print_int
+  movq %rax, -384(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,265 @@
+.data
+g$global:
+  .quad 0
+.text
+.extern print_int
+
+.globl mode
+mode:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq %rdi, -40(%rbp)
+  movq %rsi, -48(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L1
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  jz _L2
+  movq $3, -56(%rbp)
+  movq -32(%rbp), %rax
+  imulq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -16(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L3
+_L2:
+  movq $5, -80(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -80(%rbp)
+  movq %rdx, -88(%rbp)
+  movq -16(%rbp), %rax
+  subq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L3:
+  movq $1, -104(%rbp)
+  movq -32(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L0
+_L1:
+  movq -16(%rbp), %rax
+.L_leave_mode:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl limit
+limit:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $144, %rsp
+  movq %rdi, -40(%rbp)
+  movq %rsi, -48(%rbp)
+  movq %rdx, -56(%rbp)
+  movq $1, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L4:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L5
+  movq -48(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jge _L6
+  movq $3, -64(%rbp)
+  movq -16(%rbp), %rax
+  imulq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $10007, -80(%rbp)
+  movq -72(%rbp), %rax
+  cqto
+  idivq -80(%rbp)
+  movq %rdx, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L7
+_L6:
+_L7:
+  movq $0, -96(%rbp)
+  movq $1, -104(%rbp)
+  movq -96(%rbp), %rax
+  subq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -112(%rbp), %rax
+  jne _L8
+  movq -32(%rbp), %rax
+  jmp .L_leave_limit
+  jmp _L9
+_L8:
+_L9:
+  movq -16(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -128(%rbp)
+  movq -32(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L4
+_L5:
+  movq -16(%rbp), %rax
+.L_leave_limit:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl bump
+bump:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $16, %rsp
+  movq $1, -8(%rbp)
+  movq g$global(%rip), %rax
+  addq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, g$global(%rip)
+.L_leave_bump:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl global_cond
+global_cond:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L10:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L11
+  movq $6, -48(%rbp)
+  movq g$global(%rip), %rax
+  cmpq -48(%rbp), %rax
+  jge _L12
+  call bump
+  movq %rax, -56(%rbp)
+  jmp _L13
+_L12:
+_L13:
+  movq -16(%rbp), %rax
+  addq g$global(%rip), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -72(%rbp)
+  movq -32(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L10
+_L11:
+  movq -16(%rbp), %rax
+.L_leave_global_cond:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $224, %rsp
+  movq $3, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, g$global(%rip)
+  movq $0, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $100, -32(%rbp)
+  movq $1, -40(%rbp)
+  movq -32(%rbp), %rdi
+  movq -40(%rbp), %rsi
+  call mode
+  movq %rax, -48(%rbp)
+  movq $37, -56(%rbp)
+  movq $0, -64(%rbp)
+  movq -56(%rbp), %rdi
+  movq -64(%rbp), %rsi
+  call mode
+  movq %rax, -72(%rbp)
+  movq -48(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $7, -88(%rbp)
+  movq -24(%rbp), %rax
+  imulq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq $50, -104(%rbp)
+  movq $1, -112(%rbp)
+  movq $2, -120(%rbp)
+  movq -104(%rbp), %rdi
+  movq -112(%rbp), %rsi
+  movq -120(%rbp), %rdx
+  call limit
+  movq %rax, -128(%rbp)
+  movq -96(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq $20, -144(%rbp)
+  movq $5, -152(%rbp)
+  movq $4, -160(%rbp)
+  movq -144(%rbp), %rdi
+  movq -152(%rbp), %rsi
+  movq -160(%rbp), %rdx
+  call limit
+  movq %rax, -168(%rbp)
+  movq -136(%rbp), %rax
+  addq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq -176(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $10, -184(%rbp)
+  movq -184(%rbp), %rdi
+  call global_cond
+  movq %rax, -192(%rbp)
+  movq $1000, -200(%rbp)
+  movq -192(%rbp), %rax
+  imulq -200(%rbp), %rax
+  movq %rax, -208(%rbp)
+  movq -24(%rbp), %rax
+  addq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -216(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rdi
+  call print_int
+  movq %rax, -224(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
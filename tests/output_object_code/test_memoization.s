@@ -0,0 +1,341 @@
+.text
+.extern print_int
+
+.globl fib
+fib:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -8(%rbp)
+  movq $2, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jge _L0
+  movq -8(%rbp), %rax
+  jmp .L_leave_fib
+  jmp _L1
+_L0:
+_L1:
+  movq $1, -24(%rbp)
+  movq -8(%rbp), %rax
+  subq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call fib
+  movq %rax, -40(%rbp)
+  movq $2, -48(%rbp)
+  movq -8(%rbp), %rax
+  subq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rdi
+  call fib
+  movq %rax, -64(%rbp)
+  movq -40(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+.L_leave_fib:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl binomial
+binomial:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -24(%rbp)
+  movq %rsi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  je _L4
+  movq -8(%rbp), %rax
+  cmpq -24(%rbp), %rax
+  jne _L2
+_L4:
+  movq $1, -32(%rbp)
+  movq -32(%rbp), %rax
+  jmp .L_leave_binomial
+  jmp _L3
+_L2:
+_L3:
+  movq $1, -40(%rbp)
+  movq -24(%rbp), %rax
+  subq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $1, -56(%rbp)
+  movq -8(%rbp), %rax
+  subq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -48(%rbp), %rdi
+  movq -64(%rbp), %rsi
+  call binomial
+  movq %rax, -72(%rbp)
+  movq $1, -80(%rbp)
+  movq -24(%rbp), %rax
+  subq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rdi
+  movq -8(%rbp), %rsi
+  call binomial
+  movq %rax, -96(%rbp)
+  movq -72(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq $1000003, -112(%rbp)
+  movq -104(%rbp), %rax
+  cqto
+  idivq -112(%rbp)
+  movq %rdx, -120(%rbp)
+  movq -120(%rbp), %rax
+.L_leave_binomial:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl steps
+steps:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $224, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -32(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jg _L5
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_steps
+  jmp _L6
+_L5:
+_L6:
+  movq -32(%rbp), %rax
+  testq %rax, %rax
+  jz _L7
+  movq $1, -40(%rbp)
+  movq -8(%rbp), %rax
+  subq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $0, -56(%rbp)
+  movq -48(%rbp), %rdi
+  movq -56(%rbp), %rsi
+  call steps
+  movq %rax, -64(%rbp)
+  movq $2, -72(%rbp)
+  movq -8(%rbp), %rax
+  subq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $1, -88(%rbp)
+  movq -80(%rbp), %rdi
+  movq -88(%rbp), %rsi
+  call steps
+  movq %rax, -96(%rbp)
+  movq -64(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq $1, -112(%rbp)
+  movq -104(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq $1000003, -128(%rbp)
+  movq -120(%rbp), %rax
+  cqto
+  idivq -128(%rbp)
+  movq %rdx, -136(%rbp)
+  movq -136(%rbp), %rax
+  jmp .L_leave_steps
+  jmp _L8
+_L7:
+_L8:
+  movq $1, -144(%rbp)
+  movq -8(%rbp), %rax
+  subq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rdi
+  call walk
+  movq %rax, -160(%rbp)
+  movq $3, -168(%rbp)
+  movq -8(%rbp), %rax
+  subq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq $1, -184(%rbp)
+  movq -176(%rbp), %rdi
+  movq -184(%rbp), %rsi
+  call steps
+  movq %rax, -192(%rbp)
+  movq -160(%rbp), %rax
+  addq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq $1000003, -208(%rbp)
+  movq -200(%rbp), %rax
+  cqto
+  idivq -208(%rbp)
+  movq %rdx, -216(%rbp)
+  movq -216(%rbp), %rax
+.L_leave_steps:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl walk
+walk:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $96, %rsp
+  movq %rdi, -8(%rbp)
+  movq $1, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jg _L9
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_walk
+  jmp _L10
+_L9:
+_L10:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rdi
+  movq -32(%rbp), %rsi
+  call steps
+  movq %rax, -40(%rbp)
+  movq $2, -48(%rbp)
+  movq -8(%rbp), %rax
+  subq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rdi
+  call walk
+  movq %rax, -64(%rbp)
+  movq -40(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $1000003, -80(%rbp)
+  movq -72(%rbp), %rax
+  cqto
+  idivq -80(%rbp)
+  movq %rdx, -88(%rbp)
+  movq -88(%rbp), %rax
+.L_leave_walk:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl grid
+grid:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -24(%rbp)
+  movq %rdx, -40(%rbp)
+  movq %rcx, -48(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  je _L13
+  movq $0, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jne _L11
+_L13:
+  movq -40(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  jmp .L_leave_grid
+  jmp _L12
+_L11:
+_L12:
+  movq $1, -64(%rbp)
+  movq -8(%rbp), %rax
+  subq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rdi
+  movq -24(%rbp), %rsi
+  movq -40(%rbp), %rdx
+  movq -48(%rbp), %rcx
+  call grid
+  movq %rax, -80(%rbp)
+  movq $1, -88(%rbp)
+  movq -24(%rbp), %rax
+  subq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -8(%rbp), %rdi
+  movq -96(%rbp), %rsi
+  movq -48(%rbp), %rdx
+  movq -40(%rbp), %rcx
+  call grid
+  movq %rax, -104(%rbp)
+  movq -80(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $1000003, -120(%rbp)
+  movq -112(%rbp), %rax
+  cqto
+  idivq -120(%rbp)
+  movq %rdx, -128(%rbp)
+  movq -128(%rbp), %rax
+.L_leave_grid:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $176, %rsp
+  movq $25, -8(%rbp)
+  movq -8(%rbp), %rdi
+  call fib
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $18, -32(%rbp)
+  movq $9, -40(%rbp)
+  movq -32(%rbp), %rdi
+  movq -40(%rbp), %rsi
+  call binomial
+  movq %rax, -48(%rbp)
+  movq -24(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $22, -64(%rbp)
+  movq $1, -72(%rbp)
+  movq -64(%rbp), %rdi
+  movq -72(%rbp), %rsi
+  call steps
+  movq %rax, -80(%rbp)
+  movq -56(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $20, -96(%rbp)
+  movq -96(%rbp), %rdi
+  call walk
+  movq %rax, -104(%rbp)
+  movq -88(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $6, -120(%rbp)
+  movq $6, -128(%rbp)
+  movq $1, -136(%rbp)
+  movq $2, -144(%rbp)
+  movq -120(%rbp), %rdi
+  movq -128(%rbp), %rsi
+  movq -136(%rbp), %rdx
+  movq -144(%rbp), %rcx
+  call grid
+  movq %rax, -152(%rbp)
+  movq -112(%rbp), %rax
+  addq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -160(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rdi
+  call print_int
+  movq %rax, -168(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
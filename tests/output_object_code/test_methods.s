@@ -0,0 +1,145 @@
+.text
+
+.globl mega_add
+mega_add:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $96, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -32(%rbp)
+  movq %rcx, -48(%rbp)
+  movq %r8, -64(%rbp)
+  movq %r9, -80(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  addq 16(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+.L_leave_mega_add:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl add
+add:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_add:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl inc
+inc:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq $1, -16(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_inc:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl isPositive
+isPositive:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jle _L0
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_isPositive
+  jmp _L1
+_L0:
+  movq $0, -32(%rbp)
+  movq -32(%rbp), %rax
+  jmp .L_leave_isPositive
+_L1:
+.L_leave_isPositive:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+.extern print_int
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $112, %rsp
+  movq $1, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  movq -16(%rbp), %rdx
+  movq -16(%rbp), %rcx
+  movq -16(%rbp), %r8
+  movq -16(%rbp), %r9
+  subq $8, %rsp
+  pushq -16(%rbp)
+  call mega_add
+  movq %rax, -24(%rbp)
+  addq $16, %rsp
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -16(%rbp), %rdi
+  call inc
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $10, -48(%rbp)
+  movq -16(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  call add
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rdi
+  call isPositive
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -32(%rbp), %rdi
+  call print_int
+  movq %rax, -104(%rbp)
+  movq -32(%rbp), %rax
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,131 @@
+.text
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $192, %rsp
+  movq $5, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $10, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $0, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -16(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  imulq -32(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -32(%rbp)
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -32(%rbp)
+  movq %rdx, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -32(%rbp), %rax
+  negq %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  setl %al
+  movzbq %al, %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  setle %al
+  movzbq %al, %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  setg %al
+  movzbq %al, %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  setge %al
+  movzbq %al, %rax
+  movq %rax, -144(%rbp)
+  movq -144(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  sete %al
+  movzbq %al, %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  setne %al
+  movzbq %al, %rax
+  movq %rax, -160(%rbp)
+  movq -160(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  jz _L0
+  movq -64(%rbp), %rax
+  testq %rax, %rax
+  jz _L0
+  movq $1, -168(%rbp)
+  jmp _L1
+_L0:
+  movq $0, -168(%rbp)
+_L1:
+  movq -168(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  jnz _L4
+  movq -64(%rbp), %rax
+  testq %rax, %rax
+  jz _L2
+_L4:
+  movq $1, -176(%rbp)
+  jmp _L3
+_L2:
+  movq $0, -176(%rbp)
+_L3:
+  movq -176(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  sete %al
+  movzbq %al, %rax
+  movq %rax, -184(%rbp)
+  movq -184(%rbp), %rax
+  movq %rax, -48(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
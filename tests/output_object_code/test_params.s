@@ -0,0 +1,76 @@
+.text
+.extern print_int
+
+.globl zero
+zero:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $16, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+.L_leave_zero:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl sum2
+sum2:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_sum2:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl sum3
+sum3:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -32(%rbp)
+  movq -8(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  call sum2
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+.L_leave_sum3:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+.extern get_int
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq $1, -8(%rbp)
+  movq $2, -16(%rbp)
+  call zero
+  movq %rax, -24(%rbp)
+  movq -8(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  movq -24(%rbp), %rdx
+  call sum3
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call print_int
+  movq %rax, -48(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,135 @@
+.text
+.extern get_int
+.extern print_int
+.extern print_bool
+
+.globl factorial
+factorial:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L0
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_factorial
+  jmp _L1
+_L0:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call factorial
+  movq %rax, -48(%rbp)
+  movq -8(%rbp), %rax
+  imulq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  jmp .L_leave_factorial
+_L1:
+.L_leave_factorial:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl is_even
+is_even:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L2
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_is_even
+  jmp _L3
+_L2:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call is_odd
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  jmp .L_leave_is_even
+_L3:
+.L_leave_is_even:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl is_odd
+is_odd:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L4
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_is_odd
+  jmp _L5
+_L4:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call is_even
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  jmp .L_leave_is_odd
+_L5:
+.L_leave_is_odd:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq $2, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call is_even
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  testq %rax, %rax
+  jz _L6
+  movq -16(%rbp), %rdi
+  call factorial
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call print_int
+  movq %rax, -40(%rbp)
+  jmp _L7
+_L6:
+  movq $1, -48(%rbp)
+  movq -16(%rbp), %rax
+  subq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rdi
+  call factorial
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rdi
+  call print_int
+  movq %rax, -72(%rbp)
+_L7:
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
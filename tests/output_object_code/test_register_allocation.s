@@ -0,0 +1,496 @@
+.text
+.extern print_int
+
+.globl crowded
+crowded:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $480, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -40(%rbp)
+  movq %rdx, -72(%rbp)
+  movq $1, -16(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $2, -48(%rbp)
+  movq -40(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $3, -80(%rbp)
+  movq -72(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -8(%rbp), %rax
+  imulq -40(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -40(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -8(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq -8(%rbp), %rax
+  subq -40(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -40(%rbp), %rax
+  subq -72(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq -72(%rbp), %rax
+  subq -8(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq -184(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq -8(%rbp), %rax
+  addq -40(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq -200(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -208(%rbp)
+  movq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -32(%rbp), %rax
+  imulq -64(%rbp), %rax
+  movq %rax, -224(%rbp)
+  movq -224(%rbp), %rax
+  movq %rax, -232(%rbp)
+  movq -96(%rbp), %rax
+  imulq -112(%rbp), %rax
+  movq %rax, -240(%rbp)
+  movq -240(%rbp), %rax
+  movq %rax, -248(%rbp)
+  movq $2, -256(%rbp)
+  movq -64(%rbp), %rax
+  imulq -256(%rbp), %rax
+  movq %rax, -264(%rbp)
+  movq -32(%rbp), %rax
+  addq -264(%rbp), %rax
+  movq %rax, -272(%rbp)
+  movq $3, -280(%rbp)
+  movq -96(%rbp), %rax
+  imulq -280(%rbp), %rax
+  movq %rax, -288(%rbp)
+  movq -272(%rbp), %rax
+  addq -288(%rbp), %rax
+  movq %rax, -296(%rbp)
+  movq $4, -304(%rbp)
+  movq -112(%rbp), %rax
+  imulq -304(%rbp), %rax
+  movq %rax, -312(%rbp)
+  movq -296(%rbp), %rax
+  addq -312(%rbp), %rax
+  movq %rax, -320(%rbp)
+  movq $5, -328(%rbp)
+  movq -128(%rbp), %rax
+  imulq -328(%rbp), %rax
+  movq %rax, -336(%rbp)
+  movq -320(%rbp), %rax
+  addq -336(%rbp), %rax
+  movq %rax, -344(%rbp)
+  movq $6, -352(%rbp)
+  movq -144(%rbp), %rax
+  imulq -352(%rbp), %rax
+  movq %rax, -360(%rbp)
+  movq -344(%rbp), %rax
+  addq -360(%rbp), %rax
+  movq %rax, -368(%rbp)
+  movq $7, -376(%rbp)
+  movq -160(%rbp), %rax
+  imulq -376(%rbp), %rax
+  movq %rax, -384(%rbp)
+  movq -368(%rbp), %rax
+  addq -384(%rbp), %rax
+  movq %rax, -392(%rbp)
+  movq $8, -400(%rbp)
+  movq -176(%rbp), %rax
+  imulq -400(%rbp), %rax
+  movq %rax, -408(%rbp)
+  movq -392(%rbp), %rax
+  addq -408(%rbp), %rax
+  movq %rax, -416(%rbp)
+  movq $9, -424(%rbp)
+  movq -192(%rbp), %rax
+  imulq -424(%rbp), %rax
+  movq %rax, -432(%rbp)
+  movq -416(%rbp), %rax
+  addq -432(%rbp), %rax
+  movq %rax, -440(%rbp)
+  movq $10, -448(%rbp)
+  movq -216(%rbp), %rax
+  imulq -448(%rbp), %rax
+  movq %rax, -456(%rbp)
+  movq -440(%rbp), %rax
+  addq -456(%rbp), %rax
+  movq %rax, -464(%rbp)
+  movq -464(%rbp), %rax
+  addq -232(%rbp), %rax
+  movq %rax, -472(%rbp)
+  movq -472(%rbp), %rax
+  addq -248(%rbp), %rax
+  movq %rax, -480(%rbp)
+  movq -480(%rbp), %rax
+.L_leave_crowded:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl mix
+mix:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -32(%rbp)
+  movq $31, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $1009, -48(%rbp)
+  movq -40(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rdx, -56(%rbp)
+  movq -56(%rbp), %rax
+.L_leave_mix:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl across
+across:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $304, %rsp
+  movq %rdi, -136(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $2, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $3, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $4, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $5, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq $6, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $0, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+_L0:
+  movq -128(%rbp), %rax
+  cmpq -136(%rbp), %rax
+  jge _L1
+  movq -32(%rbp), %rdi
+  movq -128(%rbp), %rsi
+  call mix
+  movq %rax, -144(%rbp)
+  movq -16(%rbp), %rax
+  addq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -48(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  call mix
+  movq %rax, -160(%rbp)
+  movq -160(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -64(%rbp), %rdi
+  movq -32(%rbp), %rsi
+  call mix
+  movq %rax, -168(%rbp)
+  movq -168(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq -176(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -96(%rbp), %rdi
+  movq -48(%rbp), %rsi
+  call mix
+  movq %rax, -184(%rbp)
+  movq -184(%rbp), %rax
+  subq -112(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq -192(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $1, -200(%rbp)
+  movq -80(%rbp), %rax
+  addq -200(%rbp), %rax
+  movq %rax, -208(%rbp)
+  movq -208(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -96(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -216(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq $7, -224(%rbp)
+  movq -96(%rbp), %rax
+  cqto
+  idivq -224(%rbp)
+  movq %rdx, -232(%rbp)
+  movq -112(%rbp), %rax
+  addq -232(%rbp), %rax
+  movq %rax, -240(%rbp)
+  movq -240(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $1, -248(%rbp)
+  movq -128(%rbp), %rax
+  addq -248(%rbp), %rax
+  movq %rax, -256(%rbp)
+  movq -256(%rbp), %rax
+  movq %rax, -128(%rbp)
+  jmp _L0
+_L1:
+  movq -16(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -264(%rbp)
+  movq -264(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -272(%rbp)
+  movq -272(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -280(%rbp)
+  movq -280(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -288(%rbp)
+  movq -288(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -296(%rbp)
+  movq -296(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -304(%rbp)
+  movq -304(%rbp), %rax
+.L_leave_across:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl many
+many:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -32(%rbp)
+  movq %rcx, -40(%rbp)
+  movq %r8, -64(%rbp)
+  movq %r9, -80(%rbp)
+  movq -8(%rbp), %rax
+  subq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -32(%rbp), %rax
+  imulq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -24(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  subq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -80(%rbp), %rax
+  imulq 16(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -72(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  subq 24(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq 32(%rbp), %rax
+  imulq 40(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -104(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+.L_leave_many:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl small
+small:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq $500, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  setl %al
+  movzbq %al, %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+.L_leave_small:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $352, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L2:
+  movq $50, -40(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L3
+  movq $1, -48(%rbp)
+  movq -32(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $2, -64(%rbp)
+  movq -32(%rbp), %rax
+  imulq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -32(%rbp), %rdi
+  movq -56(%rbp), %rsi
+  movq -72(%rbp), %rdx
+  call crowded
+  movq %rax, -80(%rbp)
+  movq $997, -88(%rbp)
+  movq -80(%rbp), %rax
+  cqto
+  idivq -88(%rbp)
+  movq %rdx, -96(%rbp)
+  movq -16(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -112(%rbp)
+  movq -32(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq $2, -128(%rbp)
+  movq -32(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq $3, -144(%rbp)
+  movq -32(%rbp), %rax
+  addq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq $4, -160(%rbp)
+  movq -32(%rbp), %rax
+  addq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq $5, -176(%rbp)
+  movq -32(%rbp), %rax
+  addq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq $6, -192(%rbp)
+  movq -32(%rbp), %rax
+  addq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq $7, -208(%rbp)
+  movq -32(%rbp), %rax
+  addq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -32(%rbp), %rdi
+  movq -120(%rbp), %rsi
+  movq -136(%rbp), %rdx
+  movq -32(%rbp), %rcx
+  movq -152(%rbp), %r8
+  movq -168(%rbp), %r9
+  pushq -216(%rbp)
+  pushq -200(%rbp)
+  pushq -184(%rbp)
+  pushq -32(%rbp)
+  call many
+  movq %rax, -224(%rbp)
+  addq $32, %rsp
+  movq -16(%rbp), %rax
+  addq -224(%rbp), %rax
+  movq %rax, -232(%rbp)
+  movq -232(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1000, -240(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -240(%rbp)
+  movq %rdx, -248(%rbp)
+  movq -248(%rbp), %rdi
+  call small
+  movq %rax, -256(%rbp)
+  movq -256(%rbp), %rax
+  testq %rax, %rax
+  jz _L4
+  movq $3, -264(%rbp)
+  movq -16(%rbp), %rax
+  addq -264(%rbp), %rax
+  movq %rax, -272(%rbp)
+  movq -272(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L5
+_L4:
+_L5:
+  movq $1, -280(%rbp)
+  movq -32(%rbp), %rax
+  addq -280(%rbp), %rax
+  movq %rax, -288(%rbp)
+  movq -288(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L2
+_L3:
+  movq $7, -296(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -296(%rbp)
+  movq %rdx, -304(%rbp)
+  movq $40, -312(%rbp)
+  movq -304(%rbp), %rax
+  addq -312(%rbp), %rax
+  movq %rax, -320(%rbp)
+  movq -320(%rbp), %rdi
+  call across
+  movq %rax, -328(%rbp)
+  movq -16(%rbp), %rax
+  addq -328(%rbp), %rax
+  movq %rax, -336(%rbp)
+  movq -336(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call print_int
+  movq %rax, -344(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
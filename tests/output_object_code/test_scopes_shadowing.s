@@ -0,0 +1,39 @@
+.text
+.extern print_int
+
+.globl helper
+helper:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq $3, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $7, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -16(%rbp)
+.L_leave_helper:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq $1, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  call helper
+  movq %rax, -24(%rbp)
+  movq $42, -32(%rbp)
+  movq -32(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call print_int
+  movq %rax, -40(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,195 @@
+.text
+.extern print_int
+
+.globl guarded_div
+guarded_div:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $160, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -40(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jg _L1
+  movq $0, -48(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -48(%rbp), %rax
+  je _L2
+  movq $100, -56(%rbp)
+  movq -56(%rbp), %rax
+  cqto
+  idivq -16(%rbp)
+  movq %rax, -64(%rbp)
+  movq $10, -72(%rbp)
+  movq -64(%rbp), %rax
+  cmpq -72(%rbp), %rax
+  jle _L2
+  movq $1, -80(%rbp)
+  movq -32(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L3
+_L2:
+_L3:
+  movq $0, -96(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -96(%rbp), %rax
+  je _L6
+  movq $100, -104(%rbp)
+  movq -104(%rbp), %rax
+  cqto
+  idivq -16(%rbp)
+  movq %rdx, -112(%rbp)
+  movq $0, -120(%rbp)
+  movq -112(%rbp), %rax
+  cmpq -120(%rbp), %rax
+  jne _L4
+_L6:
+  movq $10, -128(%rbp)
+  movq -32(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L5
+_L4:
+_L5:
+  movq $1, -144(%rbp)
+  movq -16(%rbp), %rax
+  addq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L0
+_L1:
+  movq -32(%rbp), %rax
+.L_leave_guarded_div:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl as_values
+as_values:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $160, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L7:
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L8
+  movq $100, -48(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -48(%rbp), %rax
+  jg _L8
+  movq $0, -56(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jl _L8
+  movq $2, -64(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -64(%rbp)
+  movq %rdx, -72(%rbp)
+  movq $0, -80(%rbp)
+  movq -72(%rbp), %rax
+  cmpq -80(%rbp), %rax
+  sete %al
+  movzbq %al, %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  testq %rax, %rax
+  jz _L12
+  movq $2, -104(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -104(%rbp), %rax
+  jg _L11
+_L12:
+  movq -96(%rbp), %rax
+  testq %rax, %rax
+  jnz _L9
+  movq $1, -112(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -112(%rbp), %rax
+  jne _L9
+_L11:
+  movq $1, -120(%rbp)
+  jmp _L10
+_L9:
+  movq $0, -120(%rbp)
+_L10:
+  movq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+  testq %rax, %rax
+  jz _L13
+  movq -32(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L14
+_L13:
+_L14:
+  movq $1, -144(%rbp)
+  movq -16(%rbp), %rax
+  addq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L7
+_L8:
+  movq -32(%rbp), %rax
+.L_leave_as_values:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq $5, -8(%rbp)
+  movq -8(%rbp), %rax
+  negq %rax
+  movq %rax, -16(%rbp)
+  movq $12, -24(%rbp)
+  movq -16(%rbp), %rdi
+  movq -24(%rbp), %rsi
+  call guarded_div
+  movq %rax, -32(%rbp)
+  movq $1000, -40(%rbp)
+  movq -32(%rbp), %rax
+  imulq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $10, -56(%rbp)
+  movq -56(%rbp), %rdi
+  call as_values
+  movq %rax, -64(%rbp)
+  movq -48(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rdi
+  call print_int
+  movq %rax, -80(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,254 @@
+.text
+.extern print_int
+
+.globl counter
+counter:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L1
+  movq $5, -48(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rdx, -56(%rbp)
+  movq -32(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -72(%rbp)
+  movq -16(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L0
+_L1:
+  movq -32(%rbp), %rax
+.L_leave_counter:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl mix
+mix:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -56(%rbp)
+  movq %rdx, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jle _L2
+  movq -8(%rbp), %rax
+  subq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_mix
+  jmp _L3
+_L2:
+_L3:
+  movq -16(%rbp), %rax
+  subq -8(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -40(%rbp)
+  movq -32(%rbp), %rax
+  addq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+.L_leave_mix:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl status
+status:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -8(%rbp)
+  movq $2, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $10, -40(%rbp)
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jle _L4
+  movq $0, -48(%rbp)
+  movq -48(%rbp), %rax
+  jmp .L_leave_status
+  jmp _L5
+_L4:
+_L5:
+  movq $0, -56(%rbp)
+  movq -56(%rbp), %rax
+.L_leave_status:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl log_value
+log_value:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq -8(%rbp), %rdi
+  call print_int
+  movq %rax, -16(%rbp)
+  movq $3, -24(%rbp)
+  movq -8(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rax
+.L_leave_log_value:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl pick
+pick:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -24(%rbp)
+  movq -8(%rbp), %rax
+  testq %rax, %rax
+  jz _L6
+  movq -16(%rbp), %rax
+  jmp .L_leave_pick
+  jmp _L7
+_L6:
+_L7:
+  movq -24(%rbp), %rax
+.L_leave_pick:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $256, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $0, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+_L8:
+  movq $50, -72(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -72(%rbp), %rax
+  jge _L9
+  movq -16(%rbp), %rdi
+  call counter
+  movq %rax, -80(%rbp)
+  movq $25, -88(%rbp)
+  movq -16(%rbp), %rdi
+  movq -80(%rbp), %rsi
+  movq -88(%rbp), %rdx
+  call mix
+  movq %rax, -96(%rbp)
+  movq -32(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -16(%rbp), %rdi
+  call status
+  movq %rax, -112(%rbp)
+  movq $7, -120(%rbp)
+  movq -112(%rbp), %rax
+  imulq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -104(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  jz _L10
+  movq -64(%rbp), %rax
+  testq %rax, %rax
+  jz _L10
+  movq $1, -144(%rbp)
+  jmp _L11
+_L10:
+  movq $0, -144(%rbp)
+_L11:
+  movq $100, -152(%rbp)
+  movq $3, -160(%rbp)
+  movq -144(%rbp), %rdi
+  movq -152(%rbp), %rsi
+  movq -160(%rbp), %rdx
+  call pick
+  movq %rax, -168(%rbp)
+  movq -32(%rbp), %rax
+  addq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  jnz _L14
+  movq -64(%rbp), %rax
+  testq %rax, %rax
+  jz _L12
+_L14:
+  movq $1, -184(%rbp)
+  jmp _L13
+_L12:
+  movq $0, -184(%rbp)
+_L13:
+  movq $1, -192(%rbp)
+  movq $2, -200(%rbp)
+  movq -184(%rbp), %rdi
+  movq -192(%rbp), %rsi
+  movq -200(%rbp), %rdx
+  call pick
+  movq %rax, -208(%rbp)
+  movq -176(%rbp), %rax
+  addq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -216(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -16(%rbp), %rdi
+  call counter
+  movq %rax, -224(%rbp)
+  movq $1, -232(%rbp)
+  movq -16(%rbp), %rax
+  addq -232(%rbp), %rax
+  movq %rax, -240(%rbp)
+  movq -240(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L8
+_L9:
+  movq -32(%rbp), %rdi
+  call log_value
+  movq %rax, -248(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,377 @@
+.text
+.extern print_int
+
+.globl transform
+transform:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $224, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -40(%rbp)
+  movq %rdx, -72(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -48(%rbp)
+  movq -40(%rbp), %rax
+  cmpq -48(%rbp), %rax
+  jne _L0
+  movq $3, -56(%rbp)
+  movq -16(%rbp), %rax
+  imulq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L1
+_L0:
+  movq $2, -88(%rbp)
+  movq -40(%rbp), %rax
+  cmpq -88(%rbp), %rax
+  jne _L2
+  movq -16(%rbp), %rax
+  subq -72(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L4:
+  movq -32(%rbp), %rax
+  cmpq -72(%rbp), %rax
+  jge _L5
+  movq $3, -104(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -104(%rbp)
+  movq %rdx, -112(%rbp)
+  movq -16(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -128(%rbp)
+  movq -32(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L4
+_L5:
+  jmp _L3
+_L2:
+  movq $2, -144(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -144(%rbp)
+  movq %rax, -152(%rbp)
+  movq $5, -160(%rbp)
+  movq -72(%rbp), %rax
+  imulq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq -152(%rbp), %rax
+  addq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq -176(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $97, -184(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -184(%rbp)
+  movq %rdx, -192(%rbp)
+  movq $89, -200(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -200(%rbp)
+  movq %rdx, -208(%rbp)
+  movq -192(%rbp), %rax
+  addq -208(%rbp), %rax
+  movq %rax, -216(%rbp)
+  movq -216(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L3:
+_L1:
+  movq -16(%rbp), %rax
+.L_leave_transform:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl walk
+walk:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $144, %rsp
+  movq %rdi, -24(%rbp)
+  movq %rsi, -48(%rbp)
+  movq %rdx, -80(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -32(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jg _L6
+  movq $0, -40(%rbp)
+  movq -40(%rbp), %rax
+  jmp .L_leave_walk
+  jmp _L7
+_L6:
+_L7:
+  movq -48(%rbp), %rax
+  testq %rax, %rax
+  jz _L8
+  movq $2, -56(%rbp)
+  movq -24(%rbp), %rax
+  cqto
+  idivq -56(%rbp)
+  movq %rdx, -64(%rbp)
+  movq $1, -72(%rbp)
+  movq -64(%rbp), %rax
+  cmpq -72(%rbp), %rax
+  jne _L10
+  movq -24(%rbp), %rax
+  cqto
+  idivq -80(%rbp)
+  movq %rdx, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L11
+_L10:
+_L11:
+  jmp _L9
+_L8:
+  movq -24(%rbp), %rax
+  cqto
+  idivq -80(%rbp)
+  movq %rdx, -96(%rbp)
+  movq $1, -104(%rbp)
+  movq -96(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L9:
+  movq $1, -120(%rbp)
+  movq -24(%rbp), %rax
+  subq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rdi
+  movq -48(%rbp), %rsi
+  movq -80(%rbp), %rdx
+  call walk
+  movq %rax, -136(%rbp)
+  movq -16(%rbp), %rax
+  addq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq -144(%rbp), %rax
+.L_leave_walk:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl table
+table:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $144, %rsp
+  movq %rdi, -40(%rbp)
+  movq %rsi, -48(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L12:
+  movq -32(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L13
+  movq -32(%rbp), %rax
+  imulq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $7, -64(%rbp)
+  movq -56(%rbp), %rax
+  cqto
+  idivq -64(%rbp)
+  movq %rdx, -72(%rbp)
+  movq -16(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -88(%rbp)
+  movq -32(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L12
+_L13:
+  movq $100, -104(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -104(%rbp), %rax
+  jle _L14
+  movq $100, -112(%rbp)
+  movq -16(%rbp), %rax
+  subq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L15
+_L14:
+_L15:
+  movq -40(%rbp), %rax
+  imulq -48(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -16(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+.L_leave_table:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $400, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L16:
+  movq $200, -40(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L17
+  movq $1, -48(%rbp)
+  movq $4, -56(%rbp)
+  movq -16(%rbp), %rdi
+  movq -48(%rbp), %rsi
+  movq -56(%rbp), %rdx
+  call transform
+  movq %rax, -64(%rbp)
+  movq $1000, -72(%rbp)
+  movq -64(%rbp), %rax
+  cqto
+  idivq -72(%rbp)
+  movq %rdx, -80(%rbp)
+  movq -32(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $2, -96(%rbp)
+  movq $7, -104(%rbp)
+  movq -16(%rbp), %rdi
+  movq -96(%rbp), %rsi
+  movq -104(%rbp), %rdx
+  call transform
+  movq %rax, -112(%rbp)
+  movq -32(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $12, -128(%rbp)
+  movq $5, -136(%rbp)
+  movq -128(%rbp), %rdi
+  movq -136(%rbp), %rsi
+  call table
+  movq %rax, -144(%rbp)
+  movq -32(%rbp), %rax
+  addq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -160(%rbp)
+  movq -16(%rbp), %rax
+  addq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq -168(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L16
+_L17:
+  movq $3, -176(%rbp)
+  movq $0, -184(%rbp)
+  movq -32(%rbp), %rdi
+  movq -176(%rbp), %rsi
+  movq -184(%rbp), %rdx
+  call transform
+  movq %rax, -192(%rbp)
+  movq -32(%rbp), %rax
+  addq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq $3, -208(%rbp)
+  movq $0, -216(%rbp)
+  movq -32(%rbp), %rdi
+  movq -208(%rbp), %rsi
+  movq -216(%rbp), %rdx
+  call transform
+  movq %rax, -224(%rbp)
+  movq -200(%rbp), %rax
+  addq -224(%rbp), %rax
+  movq %rax, -232(%rbp)
+  movq -232(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $50, -240(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -240(%rbp)
+  movq %rdx, -248(%rbp)
+  movq $250, -256(%rbp)
+  movq -248(%rbp), %rax
+  addq -256(%rbp), %rax
+  movq %rax, -264(%rbp)
+  movq $1, -272(%rbp)
+  movq $13, -280(%rbp)
+  movq -264(%rbp), %rdi
+  movq -272(%rbp), %rsi
+  movq -280(%rbp), %rdx
+  call walk
+  movq %rax, -288(%rbp)
+  movq -32(%rbp), %rax
+  addq -288(%rbp), %rax
+  movq %rax, -296(%rbp)
+  movq $250, -304(%rbp)
+  movq $0, -312(%rbp)
+  movq $11, -320(%rbp)
+  movq -304(%rbp), %rdi
+  movq -312(%rbp), %rsi
+  movq -320(%rbp), %rdx
+  call walk
+  movq %rax, -328(%rbp)
+  movq -296(%rbp), %rax
+  addq -328(%rbp), %rax
+  movq %rax, -336(%rbp)
+  movq $30, -344(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -344(%rbp)
+  movq %rdx, -352(%rbp)
+  movq $1, -360(%rbp)
+  movq $13, -368(%rbp)
+  movq -352(%rbp), %rdi
+  movq -360(%rbp), %rsi
+  movq -368(%rbp), %rdx
+  call walk
+  movq %rax, -376(%rbp)
+  movq -336(%rbp), %rax
+  addq -376(%rbp), %rax
+  movq %rax, -384(%rbp)
+  movq -384(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call print_int
+  movq %rax, -392(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
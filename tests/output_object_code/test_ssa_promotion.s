@@ -0,0 +1,301 @@
+.text
+.extern print_int
+
+.globl fib_pairs
+fib_pairs:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -56(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $0, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+_L0:
+  movq -48(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jge _L1
+  movq -16(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -32(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -64(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -80(%rbp)
+  movq -48(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -48(%rbp)
+  jmp _L0
+_L1:
+  movq $100, -96(%rbp)
+  movq -16(%rbp), %rax
+  imulq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq $100, -112(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -112(%rbp)
+  movq %rdx, -120(%rbp)
+  movq -104(%rbp), %rax
+  addq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+.L_leave_fib_pairs:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl clamp_sum
+clamp_sum:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -24(%rbp)
+  movq %rsi, -32(%rbp)
+  movq %rdx, -48(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -24(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jge _L2
+  movq -32(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $1, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L3
+_L2:
+  movq -24(%rbp), %rax
+  cmpq -48(%rbp), %rax
+  jle _L4
+  movq -48(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $2, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L5
+_L4:
+_L5:
+_L3:
+  movq $10, -64(%rbp)
+  movq -24(%rbp), %rax
+  imulq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+.L_leave_clamp_sum:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl nested
+nested:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $144, %rsp
+  movq %rdi, -64(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -40(%rbp)
+  movq -40(%rbp), %rax
+  negq %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+_L6:
+  movq -16(%rbp), %rax
+  cmpq -64(%rbp), %rax
+  jge _L7
+  movq -16(%rbp), %rax
+  movq %rax, -72(%rbp)
+_L8:
+  movq $0, -80(%rbp)
+  movq -72(%rbp), %rax
+  cmpq -80(%rbp), %rax
+  jle _L9
+  movq -32(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $2, -96(%rbp)
+  movq -72(%rbp), %rax
+  subq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -72(%rbp)
+  jmp _L8
+_L9:
+  movq $1, -112(%rbp)
+  movq -16(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L6
+_L7:
+  movq $10, -128(%rbp)
+  movq -32(%rbp), %rax
+  imulq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq -144(%rbp), %rax
+.L_leave_nested:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl first_multiple
+first_multiple:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -24(%rbp)
+  movq %rsi, -32(%rbp)
+  movq $1, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L10:
+  movq -16(%rbp), %rax
+  cmpq -24(%rbp), %rax
+  jg _L11
+  movq -16(%rbp), %rax
+  cqto
+  idivq -32(%rbp)
+  movq %rdx, -40(%rbp)
+  movq $0, -48(%rbp)
+  movq -40(%rbp), %rax
+  cmpq -48(%rbp), %rax
+  jne _L12
+  movq -16(%rbp), %rax
+  jmp .L_leave_first_multiple
+  jmp _L13
+_L12:
+_L13:
+  movq $1, -56(%rbp)
+  movq -16(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L10
+_L11:
+  movq -16(%rbp), %rax
+  negq %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+.L_leave_first_multiple:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $272, %rsp
+  movq $15, -8(%rbp)
+  movq -8(%rbp), %rdi
+  call fib_pairs
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $5, -32(%rbp)
+  movq -32(%rbp), %rax
+  negq %rax
+  movq %rax, -40(%rbp)
+  movq $0, -48(%rbp)
+  movq $9, -56(%rbp)
+  movq -40(%rbp), %rdi
+  movq -48(%rbp), %rsi
+  movq -56(%rbp), %rdx
+  call clamp_sum
+  movq %rax, -64(%rbp)
+  movq -24(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $4, -80(%rbp)
+  movq $0, -88(%rbp)
+  movq $9, -96(%rbp)
+  movq -80(%rbp), %rdi
+  movq -88(%rbp), %rsi
+  movq -96(%rbp), %rdx
+  call clamp_sum
+  movq %rax, -104(%rbp)
+  movq -72(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $12, -120(%rbp)
+  movq $0, -128(%rbp)
+  movq $9, -136(%rbp)
+  movq -120(%rbp), %rdi
+  movq -128(%rbp), %rsi
+  movq -136(%rbp), %rdx
+  call clamp_sum
+  movq %rax, -144(%rbp)
+  movq -112(%rbp), %rax
+  addq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $100, -160(%rbp)
+  movq -24(%rbp), %rax
+  imulq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq $7, -176(%rbp)
+  movq -176(%rbp), %rdi
+  call nested
+  movq %rax, -184(%rbp)
+  movq -168(%rbp), %rax
+  addq -184(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq -192(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq $20, -200(%rbp)
+  movq $7, -208(%rbp)
+  movq -200(%rbp), %rdi
+  movq -208(%rbp), %rsi
+  call first_multiple
+  movq %rax, -216(%rbp)
+  movq -24(%rbp), %rax
+  addq -216(%rbp), %rax
+  movq %rax, -224(%rbp)
+  movq $5, -232(%rbp)
+  movq $9, -240(%rbp)
+  movq -232(%rbp), %rdi
+  movq -240(%rbp), %rsi
+  call first_multiple
+  movq %rax, -248(%rbp)
+  movq -224(%rbp), %rax
+  addq -248(%rbp), %rax
+  movq %rax, -256(%rbp)
+  movq -256(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rdi
+  call print_int
+  movq %rax, -264(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,1248 @@
+.text
+.extern print_int
+
+.globl churn
+churn:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $3056, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -16(%rbp)
+  movq %rdx, -40(%rbp)
+  movq %rcx, -48(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -40(%rbp), %rax
+  subq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $2, -72(%rbp)
+  movq -8(%rbp), %rax
+  imulq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $3, -96(%rbp)
+  movq -16(%rbp), %rax
+  imulq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $2, -120(%rbp)
+  movq -48(%rbp), %rax
+  imulq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq $7, -144(%rbp)
+  movq -136(%rbp), %rax
+  cqto
+  idivq -144(%rbp)
+  movq %rdx, -152(%rbp)
+  movq -8(%rbp), %rax
+  addq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq $3, -168(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -168(%rbp)
+  movq %rax, -176(%rbp)
+  movq -160(%rbp), %rax
+  subq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq -184(%rbp), %rax
+  movq %rax, -8(%rbp)
+  movq $3, -192(%rbp)
+  movq -32(%rbp), %rax
+  imulq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq -200(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -208(%rbp)
+  movq $8, -216(%rbp)
+  movq -208(%rbp), %rax
+  cqto
+  idivq -216(%rbp)
+  movq %rdx, -224(%rbp)
+  movq -16(%rbp), %rax
+  addq -224(%rbp), %rax
+  movq %rax, -232(%rbp)
+  movq $4, -240(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -240(%rbp)
+  movq %rax, -248(%rbp)
+  movq -232(%rbp), %rax
+  subq -248(%rbp), %rax
+  movq %rax, -256(%rbp)
+  movq -256(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $4, -264(%rbp)
+  movq -64(%rbp), %rax
+  imulq -264(%rbp), %rax
+  movq %rax, -272(%rbp)
+  movq -272(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -280(%rbp)
+  movq $9, -288(%rbp)
+  movq -280(%rbp), %rax
+  cqto
+  idivq -288(%rbp)
+  movq %rdx, -296(%rbp)
+  movq -40(%rbp), %rax
+  addq -296(%rbp), %rax
+  movq %rax, -304(%rbp)
+  movq $5, -312(%rbp)
+  movq -40(%rbp), %rax
+  cqto
+  idivq -312(%rbp)
+  movq %rax, -320(%rbp)
+  movq -304(%rbp), %rax
+  subq -320(%rbp), %rax
+  movq %rax, -328(%rbp)
+  movq -328(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $5, -336(%rbp)
+  movq -88(%rbp), %rax
+  imulq -336(%rbp), %rax
+  movq %rax, -344(%rbp)
+  movq -344(%rbp), %rax
+  addq -8(%rbp), %rax
+  movq %rax, -352(%rbp)
+  movq $10, -360(%rbp)
+  movq -352(%rbp), %rax
+  cqto
+  idivq -360(%rbp)
+  movq %rdx, -368(%rbp)
+  movq -48(%rbp), %rax
+  addq -368(%rbp), %rax
+  movq %rax, -376(%rbp)
+  movq $6, -384(%rbp)
+  movq -48(%rbp), %rax
+  cqto
+  idivq -384(%rbp)
+  movq %rax, -392(%rbp)
+  movq -376(%rbp), %rax
+  subq -392(%rbp), %rax
+  movq %rax, -400(%rbp)
+  movq -400(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $6, -408(%rbp)
+  movq -112(%rbp), %rax
+  imulq -408(%rbp), %rax
+  movq %rax, -416(%rbp)
+  movq -416(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -424(%rbp)
+  movq $11, -432(%rbp)
+  movq -424(%rbp), %rax
+  cqto
+  idivq -432(%rbp)
+  movq %rdx, -440(%rbp)
+  movq -32(%rbp), %rax
+  addq -440(%rbp), %rax
+  movq %rax, -448(%rbp)
+  movq $7, -456(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -456(%rbp)
+  movq %rax, -464(%rbp)
+  movq -448(%rbp), %rax
+  subq -464(%rbp), %rax
+  movq %rax, -472(%rbp)
+  movq -472(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $7, -480(%rbp)
+  movq -8(%rbp), %rax
+  imulq -480(%rbp), %rax
+  movq %rax, -488(%rbp)
+  movq -488(%rbp), %rax
+  addq -40(%rbp), %rax
+  movq %rax, -496(%rbp)
+  movq $12, -504(%rbp)
+  movq -496(%rbp), %rax
+  cqto
+  idivq -504(%rbp)
+  movq %rdx, -512(%rbp)
+  movq -64(%rbp), %rax
+  addq -512(%rbp), %rax
+  movq %rax, -520(%rbp)
+  movq $3, -528(%rbp)
+  movq -64(%rbp), %rax
+  cqto
+  idivq -528(%rbp)
+  movq %rax, -536(%rbp)
+  movq -520(%rbp), %rax
+  subq -536(%rbp), %rax
+  movq %rax, -544(%rbp)
+  movq -544(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $8, -552(%rbp)
+  movq -16(%rbp), %rax
+  imulq -552(%rbp), %rax
+  movq %rax, -560(%rbp)
+  movq -560(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -568(%rbp)
+  movq $13, -576(%rbp)
+  movq -568(%rbp), %rax
+  cqto
+  idivq -576(%rbp)
+  movq %rdx, -584(%rbp)
+  movq -88(%rbp), %rax
+  addq -584(%rbp), %rax
+  movq %rax, -592(%rbp)
+  movq $4, -600(%rbp)
+  movq -88(%rbp), %rax
+  cqto
+  idivq -600(%rbp)
+  movq %rax, -608(%rbp)
+  movq -592(%rbp), %rax
+  subq -608(%rbp), %rax
+  movq %rax, -616(%rbp)
+  movq -616(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $9, -624(%rbp)
+  movq -40(%rbp), %rax
+  imulq -624(%rbp), %rax
+  movq %rax, -632(%rbp)
+  movq -632(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -640(%rbp)
+  movq $14, -648(%rbp)
+  movq -640(%rbp), %rax
+  cqto
+  idivq -648(%rbp)
+  movq %rdx, -656(%rbp)
+  movq -112(%rbp), %rax
+  addq -656(%rbp), %rax
+  movq %rax, -664(%rbp)
+  movq $5, -672(%rbp)
+  movq -112(%rbp), %rax
+  cqto
+  idivq -672(%rbp)
+  movq %rax, -680(%rbp)
+  movq -664(%rbp), %rax
+  subq -680(%rbp), %rax
+  movq %rax, -688(%rbp)
+  movq -688(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $10, -696(%rbp)
+  movq -48(%rbp), %rax
+  imulq -696(%rbp), %rax
+  movq %rax, -704(%rbp)
+  movq -704(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -712(%rbp)
+  movq $15, -720(%rbp)
+  movq -712(%rbp), %rax
+  cqto
+  idivq -720(%rbp)
+  movq %rdx, -728(%rbp)
+  movq -8(%rbp), %rax
+  addq -728(%rbp), %rax
+  movq %rax, -736(%rbp)
+  movq $6, -744(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -744(%rbp)
+  movq %rax, -752(%rbp)
+  movq -736(%rbp), %rax
+  subq -752(%rbp), %rax
+  movq %rax, -760(%rbp)
+  movq -760(%rbp), %rax
+  movq %rax, -8(%rbp)
+  movq $2, -768(%rbp)
+  movq -32(%rbp), %rax
+  imulq -768(%rbp), %rax
+  movq %rax, -776(%rbp)
+  movq -776(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -784(%rbp)
+  movq $16, -792(%rbp)
+  movq -784(%rbp), %rax
+  cqto
+  idivq -792(%rbp)
+  movq %rdx, -800(%rbp)
+  movq -16(%rbp), %rax
+  addq -800(%rbp), %rax
+  movq %rax, -808(%rbp)
+  movq $7, -816(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -816(%rbp)
+  movq %rax, -824(%rbp)
+  movq -808(%rbp), %rax
+  subq -824(%rbp), %rax
+  movq %rax, -832(%rbp)
+  movq -832(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $3, -840(%rbp)
+  movq -64(%rbp), %rax
+  imulq -840(%rbp), %rax
+  movq %rax, -848(%rbp)
+  movq -848(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -856(%rbp)
+  movq $17, -864(%rbp)
+  movq -856(%rbp), %rax
+  cqto
+  idivq -864(%rbp)
+  movq %rdx, -872(%rbp)
+  movq -40(%rbp), %rax
+  addq -872(%rbp), %rax
+  movq %rax, -880(%rbp)
+  movq $3, -888(%rbp)
+  movq -40(%rbp), %rax
+  cqto
+  idivq -888(%rbp)
+  movq %rax, -896(%rbp)
+  movq -880(%rbp), %rax
+  subq -896(%rbp), %rax
+  movq %rax, -904(%rbp)
+  movq -904(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $4, -912(%rbp)
+  movq -88(%rbp), %rax
+  imulq -912(%rbp), %rax
+  movq %rax, -920(%rbp)
+  movq -920(%rbp), %rax
+  addq -8(%rbp), %rax
+  movq %rax, -928(%rbp)
+  movq $18, -936(%rbp)
+  movq -928(%rbp), %rax
+  cqto
+  idivq -936(%rbp)
+  movq %rdx, -944(%rbp)
+  movq -48(%rbp), %rax
+  addq -944(%rbp), %rax
+  movq %rax, -952(%rbp)
+  movq $4, -960(%rbp)
+  movq -48(%rbp), %rax
+  cqto
+  idivq -960(%rbp)
+  movq %rax, -968(%rbp)
+  movq -952(%rbp), %rax
+  subq -968(%rbp), %rax
+  movq %rax, -976(%rbp)
+  movq -976(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $5, -984(%rbp)
+  movq -112(%rbp), %rax
+  imulq -984(%rbp), %rax
+  movq %rax, -992(%rbp)
+  movq -992(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -1000(%rbp)
+  movq $19, -1008(%rbp)
+  movq -1000(%rbp), %rax
+  cqto
+  idivq -1008(%rbp)
+  movq %rdx, -1016(%rbp)
+  movq -32(%rbp), %rax
+  addq -1016(%rbp), %rax
+  movq %rax, -1024(%rbp)
+  movq $5, -1032(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -1032(%rbp)
+  movq %rax, -1040(%rbp)
+  movq -1024(%rbp), %rax
+  subq -1040(%rbp), %rax
+  movq %rax, -1048(%rbp)
+  movq -1048(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $6, -1056(%rbp)
+  movq -8(%rbp), %rax
+  imulq -1056(%rbp), %rax
+  movq %rax, -1064(%rbp)
+  movq -1064(%rbp), %rax
+  addq -40(%rbp), %rax
+  movq %rax, -1072(%rbp)
+  movq $7, -1080(%rbp)
+  movq -1072(%rbp), %rax
+  cqto
+  idivq -1080(%rbp)
+  movq %rdx, -1088(%rbp)
+  movq -64(%rbp), %rax
+  addq -1088(%rbp), %rax
+  movq %rax, -1096(%rbp)
+  movq $6, -1104(%rbp)
+  movq -64(%rbp), %rax
+  cqto
+  idivq -1104(%rbp)
+  movq %rax, -1112(%rbp)
+  movq -1096(%rbp), %rax
+  subq -1112(%rbp), %rax
+  movq %rax, -1120(%rbp)
+  movq -1120(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $7, -1128(%rbp)
+  movq -16(%rbp), %rax
+  imulq -1128(%rbp), %rax
+  movq %rax, -1136(%rbp)
+  movq -1136(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -1144(%rbp)
+  movq $8, -1152(%rbp)
+  movq -1144(%rbp), %rax
+  cqto
+  idivq -1152(%rbp)
+  movq %rdx, -1160(%rbp)
+  movq -88(%rbp), %rax
+  addq -1160(%rbp), %rax
+  movq %rax, -1168(%rbp)
+  movq $7, -1176(%rbp)
+  movq -88(%rbp), %rax
+  cqto
+  idivq -1176(%rbp)
+  movq %rax, -1184(%rbp)
+  movq -1168(%rbp), %rax
+  subq -1184(%rbp), %rax
+  movq %rax, -1192(%rbp)
+  movq -1192(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $8, -1200(%rbp)
+  movq -40(%rbp), %rax
+  imulq -1200(%rbp), %rax
+  movq %rax, -1208(%rbp)
+  movq -1208(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -1216(%rbp)
+  movq $9, -1224(%rbp)
+  movq -1216(%rbp), %rax
+  cqto
+  idivq -1224(%rbp)
+  movq %rdx, -1232(%rbp)
+  movq -112(%rbp), %rax
+  addq -1232(%rbp), %rax
+  movq %rax, -1240(%rbp)
+  movq $3, -1248(%rbp)
+  movq -112(%rbp), %rax
+  cqto
+  idivq -1248(%rbp)
+  movq %rax, -1256(%rbp)
+  movq -1240(%rbp), %rax
+  subq -1256(%rbp), %rax
+  movq %rax, -1264(%rbp)
+  movq -1264(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $9, -1272(%rbp)
+  movq -48(%rbp), %rax
+  imulq -1272(%rbp), %rax
+  movq %rax, -1280(%rbp)
+  movq -1280(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -1288(%rbp)
+  movq $10, -1296(%rbp)
+  movq -1288(%rbp), %rax
+  cqto
+  idivq -1296(%rbp)
+  movq %rdx, -1304(%rbp)
+  movq -8(%rbp), %rax
+  addq -1304(%rbp), %rax
+  movq %rax, -1312(%rbp)
+  movq $4, -1320(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -1320(%rbp)
+  movq %rax, -1328(%rbp)
+  movq -1312(%rbp), %rax
+  subq -1328(%rbp), %rax
+  movq %rax, -1336(%rbp)
+  movq -1336(%rbp), %rax
+  movq %rax, -8(%rbp)
+  movq $10, -1344(%rbp)
+  movq -32(%rbp), %rax
+  imulq -1344(%rbp), %rax
+  movq %rax, -1352(%rbp)
+  movq -1352(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -1360(%rbp)
+  movq $11, -1368(%rbp)
+  movq -1360(%rbp), %rax
+  cqto
+  idivq -1368(%rbp)
+  movq %rdx, -1376(%rbp)
+  movq -16(%rbp), %rax
+  addq -1376(%rbp), %rax
+  movq %rax, -1384(%rbp)
+  movq $5, -1392(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -1392(%rbp)
+  movq %rax, -1400(%rbp)
+  movq -1384(%rbp), %rax
+  subq -1400(%rbp), %rax
+  movq %rax, -1408(%rbp)
+  movq -1408(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $2, -1416(%rbp)
+  movq -64(%rbp), %rax
+  imulq -1416(%rbp), %rax
+  movq %rax, -1424(%rbp)
+  movq -1424(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -1432(%rbp)
+  movq $12, -1440(%rbp)
+  movq -1432(%rbp), %rax
+  cqto
+  idivq -1440(%rbp)
+  movq %rdx, -1448(%rbp)
+  movq -40(%rbp), %rax
+  addq -1448(%rbp), %rax
+  movq %rax, -1456(%rbp)
+  movq $6, -1464(%rbp)
+  movq -40(%rbp), %rax
+  cqto
+  idivq -1464(%rbp)
+  movq %rax, -1472(%rbp)
+  movq -1456(%rbp), %rax
+  subq -1472(%rbp), %rax
+  movq %rax, -1480(%rbp)
+  movq -1480(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $3, -1488(%rbp)
+  movq -88(%rbp), %rax
+  imulq -1488(%rbp), %rax
+  movq %rax, -1496(%rbp)
+  movq -1496(%rbp), %rax
+  addq -8(%rbp), %rax
+  movq %rax, -1504(%rbp)
+  movq $13, -1512(%rbp)
+  movq -1504(%rbp), %rax
+  cqto
+  idivq -1512(%rbp)
+  movq %rdx, -1520(%rbp)
+  movq -48(%rbp), %rax
+  addq -1520(%rbp), %rax
+  movq %rax, -1528(%rbp)
+  movq $7, -1536(%rbp)
+  movq -48(%rbp), %rax
+  cqto
+  idivq -1536(%rbp)
+  movq %rax, -1544(%rbp)
+  movq -1528(%rbp), %rax
+  subq -1544(%rbp), %rax
+  movq %rax, -1552(%rbp)
+  movq -1552(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $4, -1560(%rbp)
+  movq -112(%rbp), %rax
+  imulq -1560(%rbp), %rax
+  movq %rax, -1568(%rbp)
+  movq -1568(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -1576(%rbp)
+  movq $14, -1584(%rbp)
+  movq -1576(%rbp), %rax
+  cqto
+  idivq -1584(%rbp)
+  movq %rdx, -1592(%rbp)
+  movq -32(%rbp), %rax
+  addq -1592(%rbp), %rax
+  movq %rax, -1600(%rbp)
+  movq $3, -1608(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -1608(%rbp)
+  movq %rax, -1616(%rbp)
+  movq -1600(%rbp), %rax
+  subq -1616(%rbp), %rax
+  movq %rax, -1624(%rbp)
+  movq -1624(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $5, -1632(%rbp)
+  movq -8(%rbp), %rax
+  imulq -1632(%rbp), %rax
+  movq %rax, -1640(%rbp)
+  movq -1640(%rbp), %rax
+  addq -40(%rbp), %rax
+  movq %rax, -1648(%rbp)
+  movq $15, -1656(%rbp)
+  movq -1648(%rbp), %rax
+  cqto
+  idivq -1656(%rbp)
+  movq %rdx, -1664(%rbp)
+  movq -64(%rbp), %rax
+  addq -1664(%rbp), %rax
+  movq %rax, -1672(%rbp)
+  movq $4, -1680(%rbp)
+  movq -64(%rbp), %rax
+  cqto
+  idivq -1680(%rbp)
+  movq %rax, -1688(%rbp)
+  movq -1672(%rbp), %rax
+  subq -1688(%rbp), %rax
+  movq %rax, -1696(%rbp)
+  movq -1696(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $6, -1704(%rbp)
+  movq -16(%rbp), %rax
+  imulq -1704(%rbp), %rax
+  movq %rax, -1712(%rbp)
+  movq -1712(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -1720(%rbp)
+  movq $16, -1728(%rbp)
+  movq -1720(%rbp), %rax
+  cqto
+  idivq -1728(%rbp)
+  movq %rdx, -1736(%rbp)
+  movq -88(%rbp), %rax
+  addq -1736(%rbp), %rax
+  movq %rax, -1744(%rbp)
+  movq $5, -1752(%rbp)
+  movq -88(%rbp), %rax
+  cqto
+  idivq -1752(%rbp)
+  movq %rax, -1760(%rbp)
+  movq -1744(%rbp), %rax
+  subq -1760(%rbp), %rax
+  movq %rax, -1768(%rbp)
+  movq -1768(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $7, -1776(%rbp)
+  movq -40(%rbp), %rax
+  imulq -1776(%rbp), %rax
+  movq %rax, -1784(%rbp)
+  movq -1784(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -1792(%rbp)
+  movq $17, -1800(%rbp)
+  movq -1792(%rbp), %rax
+  cqto
+  idivq -1800(%rbp)
+  movq %rdx, -1808(%rbp)
+  movq -112(%rbp), %rax
+  addq -1808(%rbp), %rax
+  movq %rax, -1816(%rbp)
+  movq $6, -1824(%rbp)
+  movq -112(%rbp), %rax
+  cqto
+  idivq -1824(%rbp)
+  movq %rax, -1832(%rbp)
+  movq -1816(%rbp), %rax
+  subq -1832(%rbp), %rax
+  movq %rax, -1840(%rbp)
+  movq -1840(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $8, -1848(%rbp)
+  movq -48(%rbp), %rax
+  imulq -1848(%rbp), %rax
+  movq %rax, -1856(%rbp)
+  movq -1856(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -1864(%rbp)
+  movq $18, -1872(%rbp)
+  movq -1864(%rbp), %rax
+  cqto
+  idivq -1872(%rbp)
+  movq %rdx, -1880(%rbp)
+  movq -8(%rbp), %rax
+  addq -1880(%rbp), %rax
+  movq %rax, -1888(%rbp)
+  movq $7, -1896(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -1896(%rbp)
+  movq %rax, -1904(%rbp)
+  movq -1888(%rbp), %rax
+  subq -1904(%rbp), %rax
+  movq %rax, -1912(%rbp)
+  movq -1912(%rbp), %rax
+  movq %rax, -8(%rbp)
+  movq $9, -1920(%rbp)
+  movq -32(%rbp), %rax
+  imulq -1920(%rbp), %rax
+  movq %rax, -1928(%rbp)
+  movq -1928(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -1936(%rbp)
+  movq $19, -1944(%rbp)
+  movq -1936(%rbp), %rax
+  cqto
+  idivq -1944(%rbp)
+  movq %rdx, -1952(%rbp)
+  movq -16(%rbp), %rax
+  addq -1952(%rbp), %rax
+  movq %rax, -1960(%rbp)
+  movq $3, -1968(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -1968(%rbp)
+  movq %rax, -1976(%rbp)
+  movq -1960(%rbp), %rax
+  subq -1976(%rbp), %rax
+  movq %rax, -1984(%rbp)
+  movq -1984(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $10, -1992(%rbp)
+  movq -64(%rbp), %rax
+  imulq -1992(%rbp), %rax
+  movq %rax, -2000(%rbp)
+  movq -2000(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -2008(%rbp)
+  movq $7, -2016(%rbp)
+  movq -2008(%rbp), %rax
+  cqto
+  idivq -2016(%rbp)
+  movq %rdx, -2024(%rbp)
+  movq -40(%rbp), %rax
+  addq -2024(%rbp), %rax
+  movq %rax, -2032(%rbp)
+  movq $4, -2040(%rbp)
+  movq -40(%rbp), %rax
+  cqto
+  idivq -2040(%rbp)
+  movq %rax, -2048(%rbp)
+  movq -2032(%rbp), %rax
+  subq -2048(%rbp), %rax
+  movq %rax, -2056(%rbp)
+  movq -2056(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $2, -2064(%rbp)
+  movq -88(%rbp), %rax
+  imulq -2064(%rbp), %rax
+  movq %rax, -2072(%rbp)
+  movq -2072(%rbp), %rax
+  addq -8(%rbp), %rax
+  movq %rax, -2080(%rbp)
+  movq $8, -2088(%rbp)
+  movq -2080(%rbp), %rax
+  cqto
+  idivq -2088(%rbp)
+  movq %rdx, -2096(%rbp)
+  movq -48(%rbp), %rax
+  addq -2096(%rbp), %rax
+  movq %rax, -2104(%rbp)
+  movq $5, -2112(%rbp)
+  movq -48(%rbp), %rax
+  cqto
+  idivq -2112(%rbp)
+  movq %rax, -2120(%rbp)
+  movq -2104(%rbp), %rax
+  subq -2120(%rbp), %rax
+  movq %rax, -2128(%rbp)
+  movq -2128(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $3, -2136(%rbp)
+  movq -112(%rbp), %rax
+  imulq -2136(%rbp), %rax
+  movq %rax, -2144(%rbp)
+  movq -2144(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -2152(%rbp)
+  movq $9, -2160(%rbp)
+  movq -2152(%rbp), %rax
+  cqto
+  idivq -2160(%rbp)
+  movq %rdx, -2168(%rbp)
+  movq -32(%rbp), %rax
+  addq -2168(%rbp), %rax
+  movq %rax, -2176(%rbp)
+  movq $6, -2184(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -2184(%rbp)
+  movq %rax, -2192(%rbp)
+  movq -2176(%rbp), %rax
+  subq -2192(%rbp), %rax
+  movq %rax, -2200(%rbp)
+  movq -2200(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $4, -2208(%rbp)
+  movq -8(%rbp), %rax
+  imulq -2208(%rbp), %rax
+  movq %rax, -2216(%rbp)
+  movq -2216(%rbp), %rax
+  addq -40(%rbp), %rax
+  movq %rax, -2224(%rbp)
+  movq $10, -2232(%rbp)
+  movq -2224(%rbp), %rax
+  cqto
+  idivq -2232(%rbp)
+  movq %rdx, -2240(%rbp)
+  movq -64(%rbp), %rax
+  addq -2240(%rbp), %rax
+  movq %rax, -2248(%rbp)
+  movq $7, -2256(%rbp)
+  movq -64(%rbp), %rax
+  cqto
+  idivq -2256(%rbp)
+  movq %rax, -2264(%rbp)
+  movq -2248(%rbp), %rax
+  subq -2264(%rbp), %rax
+  movq %rax, -2272(%rbp)
+  movq -2272(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $5, -2280(%rbp)
+  movq -16(%rbp), %rax
+  imulq -2280(%rbp), %rax
+  movq %rax, -2288(%rbp)
+  movq -2288(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -2296(%rbp)
+  movq $11, -2304(%rbp)
+  movq -2296(%rbp), %rax
+  cqto
+  idivq -2304(%rbp)
+  movq %rdx, -2312(%rbp)
+  movq -88(%rbp), %rax
+  addq -2312(%rbp), %rax
+  movq %rax, -2320(%rbp)
+  movq $3, -2328(%rbp)
+  movq -88(%rbp), %rax
+  cqto
+  idivq -2328(%rbp)
+  movq %rax, -2336(%rbp)
+  movq -2320(%rbp), %rax
+  subq -2336(%rbp), %rax
+  movq %rax, -2344(%rbp)
+  movq -2344(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $6, -2352(%rbp)
+  movq -40(%rbp), %rax
+  imulq -2352(%rbp), %rax
+  movq %rax, -2360(%rbp)
+  movq -2360(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -2368(%rbp)
+  movq $12, -2376(%rbp)
+  movq -2368(%rbp), %rax
+  cqto
+  idivq -2376(%rbp)
+  movq %rdx, -2384(%rbp)
+  movq -112(%rbp), %rax
+  addq -2384(%rbp), %rax
+  movq %rax, -2392(%rbp)
+  movq $4, -2400(%rbp)
+  movq -112(%rbp), %rax
+  cqto
+  idivq -2400(%rbp)
+  movq %rax, -2408(%rbp)
+  movq -2392(%rbp), %rax
+  subq -2408(%rbp), %rax
+  movq %rax, -2416(%rbp)
+  movq -2416(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $7, -2424(%rbp)
+  movq -48(%rbp), %rax
+  imulq -2424(%rbp), %rax
+  movq %rax, -2432(%rbp)
+  movq -2432(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -2440(%rbp)
+  movq $13, -2448(%rbp)
+  movq -2440(%rbp), %rax
+  cqto
+  idivq -2448(%rbp)
+  movq %rdx, -2456(%rbp)
+  movq -8(%rbp), %rax
+  addq -2456(%rbp), %rax
+  movq %rax, -2464(%rbp)
+  movq $5, -2472(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -2472(%rbp)
+  movq %rax, -2480(%rbp)
+  movq -2464(%rbp), %rax
+  subq -2480(%rbp), %rax
+  movq %rax, -2488(%rbp)
+  movq -2488(%rbp), %rax
+  movq %rax, -8(%rbp)
+  movq $8, -2496(%rbp)
+  movq -32(%rbp), %rax
+  imulq -2496(%rbp), %rax
+  movq %rax, -2504(%rbp)
+  movq -2504(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -2512(%rbp)
+  movq $14, -2520(%rbp)
+  movq -2512(%rbp), %rax
+  cqto
+  idivq -2520(%rbp)
+  movq %rdx, -2528(%rbp)
+  movq -16(%rbp), %rax
+  addq -2528(%rbp), %rax
+  movq %rax, -2536(%rbp)
+  movq $6, -2544(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -2544(%rbp)
+  movq %rax, -2552(%rbp)
+  movq -2536(%rbp), %rax
+  subq -2552(%rbp), %rax
+  movq %rax, -2560(%rbp)
+  movq -2560(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $9, -2568(%rbp)
+  movq -64(%rbp), %rax
+  imulq -2568(%rbp), %rax
+  movq %rax, -2576(%rbp)
+  movq -2576(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -2584(%rbp)
+  movq $15, -2592(%rbp)
+  movq -2584(%rbp), %rax
+  cqto
+  idivq -2592(%rbp)
+  movq %rdx, -2600(%rbp)
+  movq -40(%rbp), %rax
+  addq -2600(%rbp), %rax
+  movq %rax, -2608(%rbp)
+  movq $7, -2616(%rbp)
+  movq -40(%rbp), %rax
+  cqto
+  idivq -2616(%rbp)
+  movq %rax, -2624(%rbp)
+  movq -2608(%rbp), %rax
+  subq -2624(%rbp), %rax
+  movq %rax, -2632(%rbp)
+  movq -2632(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq $10, -2640(%rbp)
+  movq -88(%rbp), %rax
+  imulq -2640(%rbp), %rax
+  movq %rax, -2648(%rbp)
+  movq -2648(%rbp), %rax
+  addq -8(%rbp), %rax
+  movq %rax, -2656(%rbp)
+  movq $16, -2664(%rbp)
+  movq -2656(%rbp), %rax
+  cqto
+  idivq -2664(%rbp)
+  movq %rdx, -2672(%rbp)
+  movq -48(%rbp), %rax
+  addq -2672(%rbp), %rax
+  movq %rax, -2680(%rbp)
+  movq $3, -2688(%rbp)
+  movq -48(%rbp), %rax
+  cqto
+  idivq -2688(%rbp)
+  movq %rax, -2696(%rbp)
+  movq -2680(%rbp), %rax
+  subq -2696(%rbp), %rax
+  movq %rax, -2704(%rbp)
+  movq -2704(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $2, -2712(%rbp)
+  movq -112(%rbp), %rax
+  imulq -2712(%rbp), %rax
+  movq %rax, -2720(%rbp)
+  movq -2720(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -2728(%rbp)
+  movq $17, -2736(%rbp)
+  movq -2728(%rbp), %rax
+  cqto
+  idivq -2736(%rbp)
+  movq %rdx, -2744(%rbp)
+  movq -32(%rbp), %rax
+  addq -2744(%rbp), %rax
+  movq %rax, -2752(%rbp)
+  movq $4, -2760(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -2760(%rbp)
+  movq %rax, -2768(%rbp)
+  movq -2752(%rbp), %rax
+  subq -2768(%rbp), %rax
+  movq %rax, -2776(%rbp)
+  movq -2776(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $3, -2784(%rbp)
+  movq -8(%rbp), %rax
+  imulq -2784(%rbp), %rax
+  movq %rax, -2792(%rbp)
+  movq -2792(%rbp), %rax
+  addq -40(%rbp), %rax
+  movq %rax, -2800(%rbp)
+  movq $18, -2808(%rbp)
+  movq -2800(%rbp), %rax
+  cqto
+  idivq -2808(%rbp)
+  movq %rdx, -2816(%rbp)
+  movq -64(%rbp), %rax
+  addq -2816(%rbp), %rax
+  movq %rax, -2824(%rbp)
+  movq $5, -2832(%rbp)
+  movq -64(%rbp), %rax
+  cqto
+  idivq -2832(%rbp)
+  movq %rax, -2840(%rbp)
+  movq -2824(%rbp), %rax
+  subq -2840(%rbp), %rax
+  movq %rax, -2848(%rbp)
+  movq -2848(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $4, -2856(%rbp)
+  movq -16(%rbp), %rax
+  imulq -2856(%rbp), %rax
+  movq %rax, -2864(%rbp)
+  movq -2864(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -2872(%rbp)
+  movq $19, -2880(%rbp)
+  movq -2872(%rbp), %rax
+  cqto
+  idivq -2880(%rbp)
+  movq %rdx, -2888(%rbp)
+  movq -88(%rbp), %rax
+  addq -2888(%rbp), %rax
+  movq %rax, -2896(%rbp)
+  movq $6, -2904(%rbp)
+  movq -88(%rbp), %rax
+  cqto
+  idivq -2904(%rbp)
+  movq %rax, -2912(%rbp)
+  movq -2896(%rbp), %rax
+  subq -2912(%rbp), %rax
+  movq %rax, -2920(%rbp)
+  movq -2920(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $5, -2928(%rbp)
+  movq -40(%rbp), %rax
+  imulq -2928(%rbp), %rax
+  movq %rax, -2936(%rbp)
+  movq -2936(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -2944(%rbp)
+  movq $7, -2952(%rbp)
+  movq -2944(%rbp), %rax
+  cqto
+  idivq -2952(%rbp)
+  movq %rdx, -2960(%rbp)
+  movq -112(%rbp), %rax
+  addq -2960(%rbp), %rax
+  movq %rax, -2968(%rbp)
+  movq $7, -2976(%rbp)
+  movq -112(%rbp), %rax
+  cqto
+  idivq -2976(%rbp)
+  movq %rax, -2984(%rbp)
+  movq -2968(%rbp), %rax
+  subq -2984(%rbp), %rax
+  movq %rax, -2992(%rbp)
+  movq -2992(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -8(%rbp), %rax
+  addq -16(%rbp), %rax
+  movq %rax, -3000(%rbp)
+  movq -3000(%rbp), %rax
+  addq -40(%rbp), %rax
+  movq %rax, -3008(%rbp)
+  movq -3008(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -3016(%rbp)
+  movq -3016(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -3024(%rbp)
+  movq -3024(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -3032(%rbp)
+  movq -3032(%rbp), %rax
+  addq -88(%rbp), %rax
+  movq %rax, -3040(%rbp)
+  movq -3040(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -3048(%rbp)
+  movq -3048(%rbp), %rax
+.L_leave_churn:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl step
+step:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $144, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -32(%rbp)
+  movq $3, -16(%rbp)
+  movq -8(%rbp), %rax
+  imulq -16(%rbp), %rax
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  addq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq $17, -56(%rbp)
+  movq -48(%rbp), %rax
+  cqto
+  idivq -56(%rbp)
+  movq %rdx, -64(%rbp)
+  movq $3, -72(%rbp)
+  movq -8(%rbp), %rax
+  cqto
+  idivq -72(%rbp)
+  movq %rax, -80(%rbp)
+  movq -64(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  imulq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  subq -48(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq $1009, -128(%rbp)
+  movq -120(%rbp), %rax
+  cqto
+  idivq -128(%rbp)
+  movq %rdx, -136(%rbp)
+  movq -136(%rbp), %rax
+.L_leave_step:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl stages
+stages:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -8(%rbp)
+  movq $1, -16(%rbp)
+  movq -8(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  call step
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  movq -8(%rbp), %rsi
+  call step
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rdi
+  movq -32(%rbp), %rsi
+  call step
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rdi
+  movq -48(%rbp), %rsi
+  call step
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq -80(%rbp), %rdi
+  movq -64(%rbp), %rsi
+  call step
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rdi
+  movq -80(%rbp), %rsi
+  call step
+  movq %rax, -104(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rdi
+  movq -8(%rbp), %rsi
+  call step
+  movq %rax, -120(%rbp)
+  movq -112(%rbp), %rax
+  addq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+.L_leave_stages:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $208, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq $30, -40(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L1
+  movq $1, -48(%rbp)
+  movq -16(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $100, -64(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -64(%rbp)
+  movq %rdx, -72(%rbp)
+  movq $3, -80(%rbp)
+  movq -16(%rbp), %rax
+  imulq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq -16(%rbp), %rdi
+  movq -56(%rbp), %rsi
+  movq -72(%rbp), %rdx
+  movq -88(%rbp), %rcx
+  call churn
+  movq %rax, -96(%rbp)
+  movq -32(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq $1000003, -112(%rbp)
+  movq -104(%rbp), %rax
+  cqto
+  idivq -112(%rbp)
+  movq %rdx, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $50, -128(%rbp)
+  movq -32(%rbp), %rax
+  cqto
+  idivq -128(%rbp)
+  movq %rdx, -136(%rbp)
+  movq -16(%rbp), %rax
+  addq -136(%rbp), %rax
+  movq %rax, -144(%rbp)
+  movq -144(%rbp), %rdi
+  call stages
+  movq %rax, -152(%rbp)
+  movq -32(%rbp), %rax
+  addq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq $1000003, -168(%rbp)
+  movq -160(%rbp), %rax
+  cqto
+  idivq -168(%rbp)
+  movq %rdx, -176(%rbp)
+  movq -176(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $1, -184(%rbp)
+  movq -16(%rbp), %rax
+  addq -184(%rbp), %rax
+  movq %rax, -192(%rbp)
+  movq -192(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L0
+_L1:
+  movq -32(%rbp), %rdi
+  call print_int
+  movq %rax, -200(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,334 @@
+.text
+.extern print_int
+
+.globl gcd
+gcd:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -24(%rbp)
+  movq %rsi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L0
+  movq -24(%rbp), %rax
+  jmp .L_leave_gcd
+  jmp _L1
+_L0:
+_L1:
+  movq -24(%rbp), %rax
+  cqto
+  idivq -8(%rbp)
+  movq %rdx, -32(%rbp)
+  movq -8(%rbp), %rdi
+  movq -32(%rbp), %rsi
+  call gcd
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+.L_leave_gcd:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl sum
+sum:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jg _L2
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_sum
+  jmp _L3
+_L2:
+_L3:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call sum
+  movq %rax, -48(%rbp)
+  movq -8(%rbp), %rax
+  addq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+.L_leave_sum:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl power
+power:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -32(%rbp)
+  movq %rsi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L4
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_power
+  jmp _L5
+_L4:
+_L5:
+  movq $1, -40(%rbp)
+  movq -8(%rbp), %rax
+  subq -40(%rbp), %rax
+  movq %rax, -48(%rbp)
+  movq -32(%rbp), %rdi
+  movq -48(%rbp), %rsi
+  call power
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rax
+  imulq -32(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -64(%rbp), %rax
+.L_leave_power:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl fib
+fib:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -8(%rbp)
+  movq $2, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jge _L6
+  movq -8(%rbp), %rax
+  jmp .L_leave_fib
+  jmp _L7
+_L6:
+_L7:
+  movq $1, -24(%rbp)
+  movq -8(%rbp), %rax
+  subq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rdi
+  call fib
+  movq %rax, -40(%rbp)
+  movq $2, -48(%rbp)
+  movq -8(%rbp), %rax
+  subq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -56(%rbp), %rdi
+  call fib
+  movq %rax, -64(%rbp)
+  movq -40(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq -72(%rbp), %rax
+.L_leave_fib:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl is_even
+is_even:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L8
+  movq $1, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_is_even
+  jmp _L9
+_L8:
+_L9:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call is_odd
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+.L_leave_is_even:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl is_odd
+is_odd:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L10
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_is_odd
+  jmp _L11
+_L10:
+_L11:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  subq -32(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call is_even
+  movq %rax, -48(%rbp)
+  movq -48(%rbp), %rax
+.L_leave_is_odd:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl last
+last:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $64, %rsp
+  movq %rdi, -8(%rbp)
+  movq %rsi, -24(%rbp)
+  movq %rdx, -32(%rbp)
+  movq %rcx, -40(%rbp)
+  movq %r8, -48(%rbp)
+  movq %r9, -56(%rbp)
+  movq 16(%rbp), %rax
+  subq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rax
+.L_leave_last:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl forward
+forward:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $80, %rsp
+  movq %rdi, -8(%rbp)
+  movq $2, -16(%rbp)
+  movq $3, -24(%rbp)
+  movq $4, -32(%rbp)
+  movq $5, -40(%rbp)
+  movq $6, -48(%rbp)
+  movq $3, -56(%rbp)
+  movq -8(%rbp), %rax
+  imulq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -8(%rbp), %rdi
+  movq -16(%rbp), %rsi
+  movq -24(%rbp), %rdx
+  movq -32(%rbp), %rcx
+  movq -40(%rbp), %r8
+  movq -48(%rbp), %r9
+  subq $8, %rsp
+  pushq -64(%rbp)
+  call last
+  movq %rax, -72(%rbp)
+  addq $16, %rsp
+  movq -72(%rbp), %rax
+.L_leave_forward:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $240, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $1071, -24(%rbp)
+  movq $462, -32(%rbp)
+  movq -24(%rbp), %rdi
+  movq -32(%rbp), %rsi
+  call gcd
+  movq %rax, -40(%rbp)
+  movq $50000, -48(%rbp)
+  movq -48(%rbp), %rdi
+  call sum
+  movq %rax, -56(%rbp)
+  movq $1000000, -64(%rbp)
+  movq -56(%rbp), %rax
+  cqto
+  idivq -64(%rbp)
+  movq %rdx, -72(%rbp)
+  movq -40(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -80(%rbp)
+  movq $3, -88(%rbp)
+  movq $13, -96(%rbp)
+  movq -88(%rbp), %rdi
+  movq -96(%rbp), %rsi
+  call power
+  movq %rax, -104(%rbp)
+  movq $1000, -112(%rbp)
+  movq -104(%rbp), %rax
+  cqto
+  idivq -112(%rbp)
+  movq %rdx, -120(%rbp)
+  movq -80(%rbp), %rax
+  addq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq $20, -136(%rbp)
+  movq -136(%rbp), %rdi
+  call fib
+  movq %rax, -144(%rbp)
+  movq -128(%rbp), %rax
+  addq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $10001, -160(%rbp)
+  movq -160(%rbp), %rdi
+  call is_even
+  movq %rax, -168(%rbp)
+  movq -168(%rbp), %rax
+  testq %rax, %rax
+  jz _L12
+  movq $1, -176(%rbp)
+  movq -16(%rbp), %rax
+  addq -176(%rbp), %rax
+  movq %rax, -184(%rbp)
+  movq -184(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L13
+_L12:
+  movq $2, -192(%rbp)
+  movq -16(%rbp), %rax
+  addq -192(%rbp), %rax
+  movq %rax, -200(%rbp)
+  movq -200(%rbp), %rax
+  movq %rax, -16(%rbp)
+_L13:
+  movq $7, -208(%rbp)
+  movq -208(%rbp), %rdi
+  call forward
+  movq %rax, -216(%rbp)
+  movq -16(%rbp), %rax
+  addq -216(%rbp), %rax
+  movq %rax, -224(%rbp)
+  movq -224(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call print_int
+  movq %rax, -232(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,26 @@
+.data
+x$global:
+  .quad 0
+flag$global:
+  .quad 0
+.text
+.extern print_bool
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq $10, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, x$global(%rip)
+  movq $1, -16(%rbp)
+  movq -16(%rbp), %rax
+  movq %rax, flag$global(%rip)
+  movq flag$global(%rip), %rdi
+  call print_bool
+  movq %rax, -24(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,274 @@
+.text
+.extern print_int
+
+.globl count_up
+count_up:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $176, %rsp
+  movq %rdi, -40(%rbp)
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L0:
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jge _L1
+  movq $8, -48(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rax, -56(%rbp)
+  movq -32(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $8, -72(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -72(%rbp)
+  movq %rdx, -80(%rbp)
+  movq -64(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $5, -96(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -96(%rbp)
+  movq %rax, -104(%rbp)
+  movq -88(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $5, -120(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -120(%rbp)
+  movq %rdx, -128(%rbp)
+  movq -112(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $0, -144(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -144(%rbp), %rax
+  jl _L2
+  movq $1, -152(%rbp)
+  movq -32(%rbp), %rax
+  addq -152(%rbp), %rax
+  movq %rax, -160(%rbp)
+  movq -160(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L3
+_L2:
+_L3:
+  movq $1, -168(%rbp)
+  movq -16(%rbp), %rax
+  addq -168(%rbp), %rax
+  movq %rax, -176(%rbp)
+  movq -176(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L0
+_L1:
+  movq -32(%rbp), %rax
+.L_leave_count_up:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl count_down
+count_down:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $176, %rsp
+  movq %rdi, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+_L4:
+  movq -8(%rbp), %rax
+  negq %rax
+  movq %rax, -40(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -40(%rbp), %rax
+  jle _L5
+  movq $4, -48(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -48(%rbp)
+  movq %rax, -56(%rbp)
+  movq -32(%rbp), %rax
+  addq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq $4, -72(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -72(%rbp)
+  movq %rdx, -80(%rbp)
+  movq -64(%rbp), %rax
+  addq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+  movq $3, -96(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -96(%rbp)
+  movq %rax, -104(%rbp)
+  movq -88(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq $3, -120(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -120(%rbp)
+  movq %rdx, -128(%rbp)
+  movq -112(%rbp), %rax
+  addq -128(%rbp), %rax
+  movq %rax, -136(%rbp)
+  movq -136(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -8(%rbp), %rax
+  jle _L6
+  movq $1000, -144(%rbp)
+  movq -32(%rbp), %rax
+  addq -144(%rbp), %rax
+  movq %rax, -152(%rbp)
+  movq -152(%rbp), %rax
+  movq %rax, -32(%rbp)
+  jmp _L7
+_L6:
+_L7:
+  movq $1, -160(%rbp)
+  movq -16(%rbp), %rax
+  subq -160(%rbp), %rax
+  movq %rax, -168(%rbp)
+  movq -168(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L4
+_L5:
+  movq -32(%rbp), %rax
+.L_leave_count_down:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl clamp_div
+clamp_div:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq $0, -24(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -24(%rbp), %rax
+  jge _L8
+  movq $0, -32(%rbp)
+  movq -32(%rbp), %rax
+  subq -16(%rbp), %rax
+  movq %rax, -40(%rbp)
+  movq -40(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L9
+_L8:
+_L9:
+  movq $0, -48(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -48(%rbp), %rax
+  jl _L12
+  movq $100, -56(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -56(%rbp), %rax
+  jle _L10
+_L12:
+  movq $100, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -16(%rbp)
+  jmp _L11
+_L10:
+_L11:
+  movq $100, -72(%rbp)
+  movq -16(%rbp), %rax
+  cmpq -72(%rbp), %rax
+  jg _L13
+  movq $16, -80(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -80(%rbp)
+  movq %rax, -88(%rbp)
+  movq $16, -96(%rbp)
+  movq -16(%rbp), %rax
+  cqto
+  idivq -96(%rbp)
+  movq %rdx, -104(%rbp)
+  movq -88(%rbp), %rax
+  addq -104(%rbp), %rax
+  movq %rax, -112(%rbp)
+  movq -112(%rbp), %rax
+  jmp .L_leave_clamp_div
+  jmp _L14
+_L13:
+_L14:
+  movq $1, -120(%rbp)
+  movq -120(%rbp), %rax
+  negq %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rax
+.L_leave_clamp_div:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $144, %rsp
+  movq $50, -8(%rbp)
+  movq -8(%rbp), %rdi
+  call count_up
+  movq %rax, -16(%rbp)
+  movq $10000, -24(%rbp)
+  movq -16(%rbp), %rax
+  imulq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq $13, -40(%rbp)
+  movq -40(%rbp), %rdi
+  call count_down
+  movq %rax, -48(%rbp)
+  movq $100, -56(%rbp)
+  movq -48(%rbp), %rax
+  imulq -56(%rbp), %rax
+  movq %rax, -64(%rbp)
+  movq -32(%rbp), %rax
+  addq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $77, -80(%rbp)
+  movq -80(%rbp), %rax
+  negq %rax
+  movq %rax, -88(%rbp)
+  movq -88(%rbp), %rdi
+  call clamp_div
+  movq %rax, -96(%rbp)
+  movq -72(%rbp), %rax
+  addq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq $500, -112(%rbp)
+  movq -112(%rbp), %rdi
+  call clamp_div
+  movq %rax, -120(%rbp)
+  movq -104(%rbp), %rax
+  addq -120(%rbp), %rax
+  movq %rax, -128(%rbp)
+  movq -128(%rbp), %rdi
+  call print_int
+  movq %rax, -136(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,34 @@
+.data
+counter$global:
+  .quad 0
+.text
+.extern print_int
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $48, %rsp
+  movq $0, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, counter$global(%rip)
+_L0:
+  movq $5, -16(%rbp)
+  movq counter$global(%rip), %rax
+  cmpq -16(%rbp), %rax
+  jge _L1
+  movq $1, -24(%rbp)
+  movq counter$global(%rip), %rax
+  addq -24(%rbp), %rax
+  movq %rax, -32(%rbp)
+  movq -32(%rbp), %rax
+  movq %rax, counter$global(%rip)
+  jmp _L0
+_L1:
+  movq counter$global(%rip), %rdi
+  call print_int
+  movq %rax, -40(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
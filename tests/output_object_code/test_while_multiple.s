@@ -0,0 +1,84 @@
+.text
+.extern print_int
+
+.globl fib
+fib:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $128, %rsp
+  movq %rdi, -8(%rbp)
+  movq $0, -16(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -16(%rbp), %rax
+  jne _L0
+  movq $0, -24(%rbp)
+  movq -24(%rbp), %rax
+  jmp .L_leave_fib
+  jmp _L1
+_L0:
+  movq $1, -32(%rbp)
+  movq -8(%rbp), %rax
+  cmpq -32(%rbp), %rax
+  jne _L2
+  movq $1, -40(%rbp)
+  movq -40(%rbp), %rax
+  jmp .L_leave_fib
+  jmp _L3
+_L2:
+  movq $0, -48(%rbp)
+  movq -48(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq $1, -64(%rbp)
+  movq -64(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $2, -80(%rbp)
+  movq -80(%rbp), %rax
+  movq %rax, -88(%rbp)
+_L4:
+  movq -88(%rbp), %rax
+  cmpq -8(%rbp), %rax
+  jg _L5
+  movq -56(%rbp), %rax
+  addq -72(%rbp), %rax
+  movq %rax, -96(%rbp)
+  movq -96(%rbp), %rax
+  movq %rax, -104(%rbp)
+  movq -72(%rbp), %rax
+  movq %rax, -56(%rbp)
+  movq -104(%rbp), %rax
+  movq %rax, -72(%rbp)
+  movq $1, -112(%rbp)
+  movq -88(%rbp), %rax
+  addq -112(%rbp), %rax
+  movq %rax, -120(%rbp)
+  movq -120(%rbp), %rax
+  movq %rax, -88(%rbp)
+  jmp _L4
+_L5:
+  movq -72(%rbp), %rax
+  jmp .L_leave_fib
+_L3:
+_L1:
+.L_leave_fib:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
+
+.globl main
+main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $32, %rsp
+  movq $2, -8(%rbp)
+  movq -8(%rbp), %rax
+  movq %rax, -16(%rbp)
+  movq -16(%rbp), %rdi
+  call fib
+  movq %rax, -24(%rbp)
+  movq -24(%rbp), %rdi
+  call print_int
+  movq %rax, -32(%rbp)
+.L_leave_main:
+  movq %rbp, %rsp
+  popq %rbp
+  ret
@@ -0,0 +1,2 @@
+main advance 100
+advance step 2000
@@ -113,9 +113,52 @@ if [ "$TEST_DIR" != "tests/error_tests" ]; then
         fi
     done
 
+    # Same programs compiled with optimizations enabled, they must print the same results
+    OPT_EXE_DIR="tests/output_executables_opt"
+    mkdir -p "$OPT_EXE_DIR"
+    asm_failures=0
+    asm_total=0
+    asm_results=()
+
+    for file in tests/correct_tests/*; do
+        if [ -f "$file" ]; then
+            base=$(basename "$file" .ctds)
+            exefile="$OPT_EXE_DIR/${base}.exe"
+            echo ">>> Generating optimized executable for $file"
+            rm -f object_code/*.s
+            # A test can ask for more optimization flags with a "/* flags: ... */" line
+            flags=$(sed -n 's|^[[:space:]]*/\* flags: \(.*\) \*/$|\1|p' "$file" | head -1)
+            ./ctds "$file" -opt $flags -target assembly > /dev/null 2> /dev/null
+            obj_generated=$(ls object_code/*.s 2>/dev/null | head -1)
+            if [ -n "$obj_generated" ] && [ -f "$obj_generated" ]; then
+                gcc -no-pie "$obj_generated" libraries/ctdsio.o -o "$exefile" 2>/dev/null
+                # A test can also name with a "/* asm: ... */" line a pattern its optimized assembly must match, so a
+                # pass that stops running fails the test even if the result is still right
+                pattern=$(sed -n 's|^[[:space:]]*/\* asm: \(.*\) \*/$|\1|p' "$file" | head -1)
+                if [ -n "$pattern" ]; then
+                    ((asm_total++))
+                    if grep -Eq "$pattern" "$obj_generated"; then
+                        echo "[OK] $base: optimized assembly matches '$pattern'"
+                    else
+                        ((asm_failures++))
+                        asm_results+=("Test: $base expected '$pattern' in the optimized assembly")
+                        echo "[FAIL] $base: optimized assembly doesn't match '$pattern'"
+                    fi
+                fi
+            fi
+            if [ -f "$exefile" ]; then
+                echo "[OK] Generated optimized executable: $exefile"
+            else
+                echo "[WARN] No optimized executable generated for $file"
+            fi
+            echo "-----------------------------------"
+        fi
+    done
+    rm -f object_code/*.s
+
     # Use indexed arrays instead of associative arrays
-    expected_keys=(test_methods test_types test_complex_operators test_expresion_calls test_integration test_operations test_params test_recursive test_scopes_shadowing test_while_multiple test_while)
-    expected_values=(7 TRUE 2 24 1 "" 3 2 42 1 5)
+    expected_keys=(test_methods test_types test_complex_operators test_expresion_calls test_integration test_operations test_params test_recursive test_scopes_shadowing test_while_multiple test_while test_global_shadowing test_cfg_simplification test_short_circuit test_value_ranges test_global_calls test_const_division test_const_multiplication test_ssa_promotion test_loop_invariants test_loop_rotation test_loop_unrolling test_induction_variables test_closed_form_loops test_loop_unswitching test_branchless_select test_inlining test_tail_calls test_dead_methods test_specialization test_signatures test_memoization test_compile_time_eval test_calling_convention test_function_order test_register_allocation test_stack_slots)
+    expected_values=(7 TRUE 2 24 1 "" 3 2 42 1 5 111004184 116 109019 6760927 1997116 284680 997975 6122343 53805083 7030056 935114761 160226274 4437364 163943 144718 602718 32125 1369 101954 851 257428 9700 98048 4119 195797 32242)
 
     expected_value_for() {
         local key="$1"
@@ -132,10 +175,14 @@ if [ "$TEST_DIR" != "tests/error_tests" ]; then
     RESULTS_FILE="tests/output_final"
     > "$RESULTS_FILE"
 
-    failures=0
-    total=0
+    # The checks of the optimized assembly count as tests too
+    failures=$asm_failures
+    total=$asm_total
+    for result in "${asm_results[@]}"; do
+        echo "$result" >> "$RESULTS_FILE"
+    done
 
-    for exefile in "$EXE_DIR"/*.exe; do
+    for exefile in "$EXE_DIR"/*.exe "$OPT_EXE_DIR"/*.exe; do
         if [ -f "$exefile" ]; then
             base=$(basename "$exefile" .exe)
             echo ">>> Executing $exefile"
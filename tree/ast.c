@@ -116,6 +116,18 @@ AST_NODE* new_method_decl_node(const char* name, AST_NODE* block) {
     return node;
 }
 
+/* Function that creates a new node of type method_decl for a clone of the method method: it gets the name name
+ * and the arguments args, the rest of the declaration (return type, body block, scope) is shared with method.
+ */
+AST_NODE* new_method_clone_node(INFO* method, const char* name, ARGS_LIST* args, int num_args) {
+    AST_NODE* node = alloc_node();
+    *node->info = *method;
+    node->info->method_decl.name = my_strdup(name);
+    node->info->method_decl.args = args;
+    node->info->method_decl.num_args = num_args;
+    return node;
+}
+
 /* Function that creates a new node of type method_call, assigning its name and arguments.
  */
 AST_NODE* new_method_call_node(char* name, AST_NODE_LIST* args) {
@@ -60,6 +60,10 @@ AST_NODE* new_while_node(AST_NODE* condition, AST_NODE* block);
  * if it is externally defined.
  */
 AST_NODE* new_method_decl_node(const char* name, AST_NODE* block);
+/* Function that creates a new node of type method_decl for a clone of the method method: it gets the name name
+ * and the arguments args, the rest of the declaration (return type, body block, scope) is shared with method.
+ */
+AST_NODE* new_method_clone_node(INFO* method, const char* name, ARGS_LIST* args, int num_args);
 /* Function that creates a new node of type block, assigning its statements.
  */
 AST_NODE* new_block_node(AST_NODE_LIST* stmts);
@@ -61,6 +61,13 @@ typedef enum {
     I_LABEL,     // Label pseudo instruction
     I_JMP,       // Unconditional jump
     I_JMPF,      // Jump if false (0)
+    I_JMPT,      // Jump if true (not 0)
+    I_JLES,      // Jump if var1 < var2 (reg = label)
+    I_JGRT,      // Jump if var1 > var2 (reg = label)
+    I_JEQ,       // Jump if var1 == var2 (reg = label)
+    I_JNEQ,      // Jump if var1 != var2 (reg = label)
+    I_JLEQ,      // Jump if var1 <= var2 (reg = label)
+    I_JGEQ,      // Jump if var1 >= var2 (reg = label)
     I_PARAM,     // Pass parameter (argument) before a call
     I_CALL,      // Call a method (var1 = method name, reg = temp for return if any)
     I_ENTER,     // Method prologue (var1 = method name)
@@ -88,6 +95,12 @@ typedef enum {
 	RETURN_NULL
 } RETURN_TYPE;
 
+typedef enum {
+	INLINE_DEFAULT, // The optimizer decides if calls are inlined
+	INLINE_ALWAYS, // Marked as inline
+	INLINE_NEVER // Marked as noinline
+} INLINE_HINT;
+
 typedef enum {
 	TYPE_INT,
 	TYPE_BOOL,
@@ -140,6 +153,10 @@ typedef struct INFO {
 			AST_NODE* block; // Method body.
 			TABLE_STACK* scope; // Scope of the method.
 			int is_extern; // Flag to check if the method is externally defined.
+			INLINE_HINT inline_hint; // Attribute that forces or forbids inlining its calls.
+			struct INFO** callees; // Methods called in the body (edges of the call graph).
+			int num_callees;
+			int is_reachable; // Flag to check if main calls the method, directly or through other methods.
 		} method_decl;
 
 		struct {
@@ -1,4 +1,5 @@
 #include "utils.h"
+#include "error_handling.h"
 
 /* Portable strdup replacement to avoid implicit declaration issues. */
 char *my_strdup(const char *s) {
@@ -8,4 +9,58 @@ char *my_strdup(const char *s) {
     if (!r) return NULL;
     strcpy(r, s);
     return r;
-}
\ No newline at end of file
+}
+
+/* Returns the FNV-1a hash of name */
+static unsigned long hash_name(const char* name) {
+    unsigned long hash = 14695981039346656037UL;
+    for (; *name; name++) hash = (hash ^ (unsigned char)*name) * 1099511628211UL;
+    return hash;
+}
+
+/* Returns the bucket of name in the table: the one that has it, or the empty one where it goes */
+static int find_bucket(const NAME_TABLE* table, const char* name) {
+    int bucket = (int)(hash_name(name) & (unsigned long)(table->size - 1));
+    while (table->keys[bucket] && strcmp(table->keys[bucket], name) != 0) bucket = (bucket + 1) & (table->size - 1);
+    return bucket;
+}
+
+/* Function that saves value for name in the table, replacing the value it had */
+void table_put(NAME_TABLE* table, const char* name, int value) {
+    if ((table->count + 1) * 2 > table->size) {
+        // At most half of the buckets are used, so the probes stay short
+        NAME_TABLE bigger = {NULL, NULL, table->size ? table->size * 2 : 16, 0};
+        bigger.keys = calloc(bigger.size, sizeof(char*));
+        bigger.values = malloc(bigger.size * sizeof(int));
+        if (!bigger.keys || !bigger.values) error_allocate_mem();
+        for (int b = 0; b < table->size; b++) {
+            if (!table->keys[b]) continue;
+            int bucket = find_bucket(&bigger, table->keys[b]);
+            bigger.keys[bucket] = table->keys[b];
+            bigger.values[bucket] = table->values[b];
+            bigger.count++;
+        }
+        table_free(table);
+        *table = bigger;
+    }
+    int bucket = find_bucket(table, name);
+    if (!table->keys[bucket]) {
+        table->keys[bucket] = name;
+        table->count++;
+    }
+    table->values[bucket] = value;
+}
+
+/* Function that returns the value of name in the table (-1 if it has none) */
+int table_get(const NAME_TABLE* table, const char* name) {
+    if (table->size == 0) return -1;
+    int bucket = find_bucket(table, name);
+    return table->keys[bucket] ? table->values[bucket] : -1;
+}
+
+/* Function that frees the memory used by the table, leaving it empty */
+void table_free(NAME_TABLE* table) {
+    free(table->keys);
+    free(table->values);
+    *table = (NAME_TABLE){NULL, NULL, 0, 0};
+}
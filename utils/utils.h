@@ -4,7 +4,22 @@
 #include <string.h>
 #include <stdlib.h>
 
+// Hash table from names to integers (open addressing with linear probing). The names are not copied, they must
+// outlive the table
+typedef struct NAME_TABLE {
+    const char** keys;
+    int* values;
+    int size; // Number of buckets, a power of 2 (0 until the first name is saved)
+    int count;
+} NAME_TABLE;
+
 /* Portable strdup replacement to avoid implicit declaration issues. */
 char *my_strdup(const char *s);
+/* Function that saves value for name in the table, replacing the value it had */
+void table_put(NAME_TABLE* table, const char* name, int value);
+/* Function that returns the value of name in the table (-1 if it has none) */
+int table_get(const NAME_TABLE* table, const char* name);
+/* Function that frees the memory used by the table, leaving it empty */
+void table_free(NAME_TABLE* table);
 
-#endif
\ No newline at end of file
+#endif